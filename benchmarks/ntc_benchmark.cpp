@@ -0,0 +1,699 @@
+/**
+ * @file ntc_benchmark.cpp
+ * @brief Benchmark suite for the NTC conversion, lookup and driver paths.
+ *
+ * Times the conversion kernels, the lookup table searches, the batch paths
+ * and complete driver reads against a zero-latency ADC. Results are printed
+ * as a table or as JSON in the Google Benchmark layout, so release-to-release
+ * regressions can be compared with existing tooling (e.g. compare.py).
+ *
+ * Usage:
+ *   ntc_benchmark [--benchmark_format=console|json]
+ *                 [--benchmark_filter=<substring>]
+ *                 [--benchmark_min_time=<seconds>]
+ *                 [--benchmark_out=<file>]
+ *
+ * The suite only needs C++17 and std::chrono, so the same source can be
+ * built into a target application to compare host and MCU numbers.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#include "ntc_conversion.hpp"
+#include "ntc_lookup_table.hpp"
+#include "ntc_packed.hpp"
+#include "ntc_table_generator.hpp"
+#include "ntc_thermistor.hpp"
+#include "ntc_thermistor_array.hpp"
+#include "ntc_thermistor_q.hpp"
+#include "ntc_thermistor_static.hpp"
+#include "zero_latency_adc.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+namespace {
+
+//--------------------------------------
+//  Benchmark Harness
+//--------------------------------------
+
+/**
+ * @brief Result of one benchmark
+ */
+struct BenchmarkResult {
+  const char *name;        ///< Benchmark name
+  uint64_t iterations;     ///< Timed iterations
+  double real_time_ns;     ///< Wall time per item (ns)
+  double cpu_time_ns;      ///< CPU time per item (ns)
+  double items_per_second; ///< Items processed per second
+};
+
+/**
+ * @brief Command line options
+ */
+struct BenchmarkOptions {
+  bool json = false;              ///< Emit JSON instead of a table
+  const char *filter = nullptr;   ///< Run names containing this substring
+  double min_time_s = 0.2;        ///< Minimum timed duration per benchmark
+  const char *out_path = nullptr; ///< Write results to this file
+};
+
+/// Keeps benchmark results observable so the kernels are not optimized out
+volatile float g_sink = 0.0F;
+
+/**
+ * @brief Time a kernel until it runs for at least min_time_s
+ *
+ * The kernel is called with an iteration count and must process
+ * items_per_iteration items per iteration. The iteration count doubles
+ * until the run is long enough; only the final run is reported.
+ *
+ * @param options Command line options
+ * @param name Benchmark name
+ * @param items_per_iteration Items processed per iteration
+ * @param kernel Callable taking the iteration count
+ * @param results Results to append to
+ */
+template <typename Kernel>
+void runBenchmark(const BenchmarkOptions &options, const char *name,
+                  uint32_t items_per_iteration, Kernel &&kernel,
+                  std::vector<BenchmarkResult> *results) {
+  if (options.filter != nullptr &&
+      std::strstr(name, options.filter) == nullptr) {
+    return;
+  }
+
+  constexpr uint64_t MAX_ITERATIONS_ = 1ULL << 40U;
+  uint64_t iterations = 1U;
+  for (;;) {
+    const std::clock_t cpu_start = std::clock();
+    const auto start = std::chrono::steady_clock::now();
+    kernel(iterations);
+    const auto end = std::chrono::steady_clock::now();
+    const std::clock_t cpu_end = std::clock();
+
+    const double elapsed_s =
+        std::chrono::duration<double>(end - start).count();
+    if (elapsed_s >= options.min_time_s || iterations >= MAX_ITERATIONS_) {
+      const double items = static_cast<double>(iterations) *
+                           static_cast<double>(items_per_iteration);
+      const double cpu_s = static_cast<double>(cpu_end - cpu_start) /
+                           static_cast<double>(CLOCKS_PER_SEC);
+      results->push_back({name, iterations, elapsed_s * 1e9 / items,
+                          cpu_s * 1e9 / items, items / elapsed_s});
+      return;
+    }
+    iterations *= 2U;
+  }
+}
+
+/**
+ * @brief Print results as a table
+ * @param file Output stream
+ * @param results Benchmark results
+ */
+void printConsole(std::FILE *file, const std::vector<BenchmarkResult> &results) {
+  std::fprintf(file, "%-56s %12s %12s %14s\n", "Benchmark", "Time (ns)",
+               "CPU (ns)", "Iterations");
+  for (const BenchmarkResult &result : results) {
+    std::fprintf(file, "%-56s %12.2f %12.2f %14llu\n", result.name,
+                 result.real_time_ns, result.cpu_time_ns,
+                 static_cast<unsigned long long>(result.iterations));
+  }
+}
+
+/**
+ * @brief Print results as JSON (Google Benchmark layout)
+ * @param file Output stream
+ * @param options Command line options
+ * @param results Benchmark results
+ */
+void printJson(std::FILE *file, const BenchmarkOptions &options,
+               const std::vector<BenchmarkResult> &results) {
+  std::fprintf(file, "{\n  \"context\": {\n");
+  std::fprintf(file, "    \"library\": \"hf-ntc-thermistor\",\n");
+  std::fprintf(file, "    \"min_time_s\": %g\n  },\n", options.min_time_s);
+  std::fprintf(file, "  \"benchmarks\": [\n");
+  for (size_t i = 0; i < results.size(); ++i) {
+    const BenchmarkResult &result = results[i];
+    std::fprintf(file,
+                 "    {\"name\": \"%s\", \"run_type\": \"iteration\", "
+                 "\"iterations\": %llu, \"real_time\": %.4f, "
+                 "\"cpu_time\": %.4f, \"time_unit\": \"ns\", "
+                 "\"items_per_second\": %.1f}%s\n",
+                 result.name, static_cast<unsigned long long>(result.iterations),
+                 result.real_time_ns, result.cpu_time_ns,
+                 result.items_per_second,
+                 (i + 1U < results.size()) ? "," : "");
+  }
+  std::fprintf(file, "  ]\n}\n");
+}
+
+/**
+ * @brief Parse command line options
+ * @param argc Argument count
+ * @param argv Arguments
+ * @param options Pointer to store the options
+ * @return true if every argument was recognized
+ */
+bool parseOptions(int argc, char **argv, BenchmarkOptions *options) {
+  for (int i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    if (std::strcmp(arg, "--benchmark_format=json") == 0) {
+      options->json = true;
+    } else if (std::strcmp(arg, "--benchmark_format=console") == 0) {
+      options->json = false;
+    } else if (std::strncmp(arg, "--benchmark_filter=", 19) == 0) {
+      options->filter = arg + 19;
+    } else if (std::strncmp(arg, "--benchmark_min_time=", 21) == 0) {
+      options->min_time_s = std::atof(arg + 21);
+    } else if (std::strncmp(arg, "--benchmark_out=", 16) == 0) {
+      options->out_path = arg + 16;
+    } else {
+      std::fprintf(stderr, "Unknown argument: %s\n", arg);
+      return false;
+    }
+  }
+  return true;
+}
+
+//--------------------------------------
+//  Benchmark Inputs
+//--------------------------------------
+
+constexpr size_t INPUT_COUNT_ = ZeroLatencyAdc::COUNT_PATTERN_SIZE_;
+constexpr float SERIES_RESISTANCE_ = 10000.0F;
+constexpr float RESISTANCE_AT_25C_ = 10000.0F;
+constexpr float BETA_VALUE_ = 3435.0F;
+constexpr uint8_t ADC_RESOLUTION_BITS_ = 12U;
+
+/**
+ * @brief Resistances and counts shared by the kernel benchmarks
+ */
+struct BenchmarkInputs {
+  std::array<uint32_t, INPUT_COUNT_> counts;     ///< Raw ADC counts
+  std::array<float, INPUT_COUNT_> resistances;   ///< Matching resistances
+  float steinhart_hart_a;                        ///< Fitted coefficient A
+  float steinhart_hart_b;                        ///< Fitted coefficient B
+  float steinhart_hart_c;                        ///< Fitted coefficient C
+};
+
+/**
+ * @brief Build the kernel inputs from the zero-latency ADC pattern
+ * @return Benchmark inputs
+ */
+BenchmarkInputs makeInputs() {
+  BenchmarkInputs inputs = {};
+  const ZeroLatencyAdc adc;
+  const float full_scale =
+      static_cast<float>((1U << ADC_RESOLUTION_BITS_) - 1U);
+  for (size_t i = 0; i < INPUT_COUNT_; ++i) {
+    inputs.counts[i] = adc.PatternCount(i);
+    const float count = static_cast<float>(inputs.counts[i]);
+    inputs.resistances[i] =
+        SERIES_RESISTANCE_ * count / (full_scale - count);
+  }
+
+  std::array<float, 3> temperatures = {-30.0F, 40.0F, 110.0F};
+  std::array<float, 3> resistances = {};
+  for (size_t i = 0; i < temperatures.size(); ++i) {
+    (void)NTC::ConvertTemperatureToResistanceBeta(
+        temperatures[i], RESISTANCE_AT_25C_, BETA_VALUE_, &resistances[i]);
+  }
+  (void)NTC::CalculateSteinhartHartCoefficients(
+      temperatures[0], resistances[0], temperatures[1], resistances[1],
+      temperatures[2], resistances[2], &inputs.steinhart_hart_a,
+      &inputs.steinhart_hart_b, &inputs.steinhart_hart_c);
+  return inputs;
+}
+
+/**
+ * @brief Run a per-resistance kernel over the input pattern
+ * @param inputs Benchmark inputs
+ * @param iterations Iteration count
+ * @param convert Callable converting one resistance to a float result
+ */
+template <typename Convert>
+void sweepResistances(const BenchmarkInputs &inputs, uint64_t iterations,
+                      Convert &&convert) {
+  float sum = 0.0F;
+  for (uint64_t i = 0; i < iterations; ++i) {
+    sum += convert(inputs.resistances[i % INPUT_COUNT_]);
+  }
+  g_sink = sum;
+}
+
+/**
+ * @brief Build-time configuration for the static driver benchmark
+ */
+struct StaticBenchmarkConfig {
+  static constexpr ntc_config_t CONFIG = [] {
+    ntc_config_t config = GetDefaultNtcConfig();
+    config.conversion_method = NtcConversionMethod::AdcCountTable;
+    config.min_temperature = -40.0F;
+    config.max_temperature = 125.0F;
+    return config;
+  }();
+};
+
+/**
+ * @brief Benchmark ReadTemperatureCelsius() with one conversion method
+ * @param options Command line options
+ * @param name Benchmark name
+ * @param method Conversion method
+ * @param results Results to append to
+ * @param sample_count Samples per read
+ * @param strategy Reduction of the samples
+ */
+void benchmarkDriverRead(
+    const BenchmarkOptions &options, const char *name,
+    NtcConversionMethod method, std::vector<BenchmarkResult> *results,
+    uint32_t sample_count = 1U,
+    NtcSamplingStrategy strategy = NtcSamplingStrategy::Mean) {
+  ZeroLatencyAdc adc;
+  ntc_config_t config = GetDefaultNtcConfig();
+  config.conversion_method = method;
+  config.sample_count = sample_count;
+  config.sampling_strategy = strategy;
+  NtcThermistor<ZeroLatencyAdc> thermistor(config, &adc);
+  if (!thermistor.Initialize()) {
+    std::fprintf(stderr, "%s: initialization failed\n", name);
+    return;
+  }
+
+  runBenchmark(options, name, 1U,
+               [&](uint64_t iterations) {
+                 float sum = 0.0F;
+                 for (uint64_t i = 0; i < iterations; ++i) {
+                   float celsius = 0.0F;
+                   (void)thermistor.ReadTemperatureCelsius(&celsius);
+                   sum += celsius;
+                 }
+                 g_sink = sum;
+               },
+               results);
+}
+
+} // namespace
+
+//--------------------------------------
+//  Benchmarks
+//--------------------------------------
+
+int main(int argc, char **argv) {
+  BenchmarkOptions options;
+  if (!parseOptions(argc, argv, &options)) {
+    return EXIT_FAILURE;
+  }
+
+  const BenchmarkInputs inputs = makeInputs();
+  std::vector<BenchmarkResult> results;
+
+  // Resistance -> temperature kernels
+  runBenchmark(options, "BM_ConvertResistanceToTemperatureBeta", 1U,
+               [&](uint64_t iterations) {
+                 sweepResistances(inputs, iterations, [](float resistance) {
+                   float celsius = 0.0F;
+                   (void)NTC::ConvertResistanceToTemperatureBeta(
+                       resistance, RESISTANCE_AT_25C_, BETA_VALUE_, &celsius);
+                   return celsius;
+                 });
+               },
+               &results);
+
+  runBenchmark(options, "BM_ConvertResistanceToTemperatureBetaFast", 1U,
+               [&](uint64_t iterations) {
+                 sweepResistances(inputs, iterations, [](float resistance) {
+                   float celsius = 0.0F;
+                   (void)NTC::ConvertResistanceToTemperatureBetaFast(
+                       resistance, RESISTANCE_AT_25C_, BETA_VALUE_, &celsius);
+                   return celsius;
+                 });
+               },
+               &results);
+
+  runBenchmark(options, "BM_ConvertResistanceToTemperatureSteinhartHart", 1U,
+               [&](uint64_t iterations) {
+                 sweepResistances(inputs, iterations, [&](float resistance) {
+                   float celsius = 0.0F;
+                   (void)NTC::ConvertResistanceToTemperatureSteinhartHart(
+                       resistance, inputs.steinhart_hart_a,
+                       inputs.steinhart_hart_b, inputs.steinhart_hart_c,
+                       &celsius);
+                   return celsius;
+                 });
+               },
+               &results);
+
+  runBenchmark(options, "BM_ConvertResistanceToTemperatureSteinhartHartFast",
+               1U,
+               [&](uint64_t iterations) {
+                 sweepResistances(inputs, iterations, [&](float resistance) {
+                   float celsius = 0.0F;
+                   (void)NTC::ConvertResistanceToTemperatureSteinhartHartFast(
+                       resistance, inputs.steinhart_hart_a,
+                       inputs.steinhart_hart_b, inputs.steinhart_hart_c,
+                       &celsius);
+                   return celsius;
+                 });
+               },
+               &results);
+
+  // Lookup tables: built-in log-keyed table (O(1) index) and a 1°C table
+  // with uniform temperature steps (binary search)
+  const NTC::ValidatedLookupTable uniform_table(
+      NTC::GetNtcLookupTable(static_cast<int>(NtcType::NtcG163Jft103Ft1S)));
+  const NTC::ntc_lookup_table_t *linear_table =
+      NTC::MakeNtcTable<10000, 3435, -40, 125, 1>();
+
+  runBenchmark(options, "BM_FindTemperatureFromLookupTable/Uniform", 1U,
+               [&](uint64_t iterations) {
+                 sweepResistances(inputs, iterations, [&](float resistance) {
+                   float celsius = 0.0F;
+                   (void)NTC::FindTemperatureFromLookupTable(
+                       uniform_table, resistance, &celsius);
+                   return celsius;
+                 });
+               },
+               &results);
+
+  runBenchmark(options, "BM_FindTemperatureFromLookupTable/BinarySearch", 1U,
+               [&](uint64_t iterations) {
+                 const NTC::ValidatedLookupTable table(linear_table);
+                 sweepResistances(inputs, iterations, [&](float resistance) {
+                   float celsius = 0.0F;
+                   (void)NTC::FindTemperatureFromLookupTable(table, resistance,
+                                                             &celsius);
+                   return celsius;
+                 });
+               },
+               &results);
+
+  runBenchmark(options, "BM_FindTemperatureFromLookupTable/Unvalidated", 1U,
+               [&](uint64_t iterations) {
+                 sweepResistances(inputs, iterations, [&](float resistance) {
+                   float celsius = 0.0F;
+                   (void)NTC::FindTemperatureFromLookupTable(
+                       uniform_table.Get(), resistance, &celsius);
+                   return celsius;
+                 });
+               },
+               &results);
+
+  runBenchmark(options, "BM_BinarySearchLookupTable", 1U,
+               [&](uint64_t iterations) {
+                 sweepResistances(inputs, iterations, [&](float resistance) {
+                   size_t lower = 0;
+                   size_t upper = 0;
+                   (void)NTC::BinarySearchLookupTable(linear_table, resistance,
+                                                      &lower, &upper);
+                   return static_cast<float>(lower);
+                 });
+               },
+               &results);
+
+  runBenchmark(options, "BM_UniformIndexLookupTable", 1U,
+               [&](uint64_t iterations) {
+                 sweepResistances(inputs, iterations, [&](float resistance) {
+                   size_t lower = 0;
+                   float fraction = 0.0F;
+                   (void)NTC::UniformIndexLookupTable(
+                       uniform_table.Get(), resistance, &lower, &fraction);
+                   return static_cast<float>(lower) + fraction;
+                 });
+               },
+               &results);
+
+  // Batch paths, one item per element
+  runBenchmark(options, "BM_ConvertResistanceToTemperatureBeta/Batch64",
+               INPUT_COUNT_,
+               [&](uint64_t iterations) {
+                 std::array<float, INPUT_COUNT_> temperatures = {};
+                 std::array<uint8_t, NTC::BatchMaskBytes(INPUT_COUNT_)> mask =
+                     {};
+                 for (uint64_t i = 0; i < iterations; ++i) {
+                   (void)NTC::ConvertResistanceToTemperatureBeta(
+                       inputs.resistances.data(), temperatures.data(),
+                       INPUT_COUNT_, RESISTANCE_AT_25C_, BETA_VALUE_,
+                       mask.data());
+                   g_sink = temperatures[i % INPUT_COUNT_];
+                 }
+               },
+               &results);
+
+  runBenchmark(options,
+               "BM_ConvertResistanceToTemperatureSteinhartHart/Batch64",
+               INPUT_COUNT_,
+               [&](uint64_t iterations) {
+                 std::array<float, INPUT_COUNT_> temperatures = {};
+                 std::array<uint8_t, NTC::BatchMaskBytes(INPUT_COUNT_)> mask =
+                     {};
+                 for (uint64_t i = 0; i < iterations; ++i) {
+                   (void)NTC::ConvertResistanceToTemperatureSteinhartHart(
+                       inputs.resistances.data(), temperatures.data(),
+                       INPUT_COUNT_, inputs.steinhart_hart_a,
+                       inputs.steinhart_hart_b, inputs.steinhart_hart_c,
+                       mask.data());
+                   g_sink = temperatures[i % INPUT_COUNT_];
+                 }
+               },
+               &results);
+
+  runBenchmark(options, "BM_ConvertAdcCountsToTemperatureBeta/Batch64",
+               INPUT_COUNT_,
+               [&](uint64_t iterations) {
+                 std::array<float, INPUT_COUNT_> temperatures = {};
+                 std::array<uint8_t, NTC::BatchMaskBytes(INPUT_COUNT_)> mask =
+                     {};
+                 for (uint64_t i = 0; i < iterations; ++i) {
+                   (void)NTC::ConvertAdcCountsToTemperatureBeta(
+                       inputs.counts.data(), temperatures.data(), INPUT_COUNT_,
+                       ADC_RESOLUTION_BITS_, SERIES_RESISTANCE_,
+                       RESISTANCE_AT_25C_, BETA_VALUE_, mask.data());
+                   g_sink = temperatures[i % INPUT_COUNT_];
+                 }
+               },
+               &results);
+
+  // Complete driver reads against the zero-latency ADC
+  benchmarkDriverRead(options, "BM_ReadTemperatureCelsius/LookupTable",
+                      NtcConversionMethod::LookupTable, &results);
+  benchmarkDriverRead(options, "BM_ReadTemperatureCelsius/Mathematical",
+                      NtcConversionMethod::Mathematical, &results);
+  benchmarkDriverRead(options, "BM_ReadTemperatureCelsius/AdcCountTable",
+                      NtcConversionMethod::AdcCountTable, &results);
+  benchmarkDriverRead(options, "BM_ReadTemperatureCelsius/SteinhartHart",
+                      NtcConversionMethod::SteinhartHart, &results);
+  benchmarkDriverRead(options, "BM_ReadTemperatureCelsius/Auto",
+                      NtcConversionMethod::Auto, &results);
+
+  // Sample reduction cost, 16 samples per read
+  constexpr uint32_t OVERSAMPLE_COUNT_ = 16U;
+  benchmarkDriverRead(options, "BM_ReadTemperatureCelsius/Mean16",
+                      NtcConversionMethod::LookupTable, &results,
+                      OVERSAMPLE_COUNT_, NtcSamplingStrategy::Mean);
+  benchmarkDriverRead(options, "BM_ReadTemperatureCelsius/Decimate16",
+                      NtcConversionMethod::LookupTable, &results,
+                      OVERSAMPLE_COUNT_, NtcSamplingStrategy::Decimate);
+  benchmarkDriverRead(options, "BM_ReadTemperatureCelsius/Median16",
+                      NtcConversionMethod::LookupTable, &results,
+                      OVERSAMPLE_COUNT_, NtcSamplingStrategy::Median);
+  benchmarkDriverRead(options, "BM_ReadTemperatureCelsius/TrimmedMean16",
+                      NtcConversionMethod::LookupTable, &results,
+                      OVERSAMPLE_COUNT_, NtcSamplingStrategy::TrimmedMean);
+
+  {
+    ZeroLatencyAdc adc;
+    NtcThermistorQ<ZeroLatencyAdc> thermistor(GetDefaultNtcConfig(), &adc);
+    if (thermistor.Initialize()) {
+      runBenchmark(options, "BM_ReadTemperatureCentiCelsius/FixedPoint", 1U,
+                   [&](uint64_t iterations) {
+                     int32_t sum = 0;
+                     for (uint64_t i = 0; i < iterations; ++i) {
+                       int32_t centi_celsius = 0;
+                       (void)thermistor.ReadTemperatureCentiCelsius(
+                           &centi_celsius);
+                       sum += centi_celsius;
+                     }
+                     g_sink = static_cast<float>(sum);
+                   },
+                   &results);
+    }
+  }
+
+  {
+    ZeroLatencyAdc adc;
+    StaticNtcThermistor<ZeroLatencyAdc, StaticBenchmarkConfig> thermistor(
+        &adc);
+    if (thermistor.Initialize()) {
+      runBenchmark(options, "BM_ReadTemperatureCelsius/StaticAdcCountTable",
+                   1U,
+                   [&](uint64_t iterations) {
+                     float sum = 0.0F;
+                     for (uint64_t i = 0; i < iterations; ++i) {
+                       float celsius = 0.0F;
+                       (void)thermistor.ReadTemperatureCelsius(&celsius);
+                       sum += celsius;
+                     }
+                     g_sink = sum;
+                   },
+                   &results);
+    }
+  }
+
+  {
+    constexpr size_t CHANNELS_ = 8U;
+    ZeroLatencyAdc adc;
+    std::array<ntc_channel_config_t, CHANNELS_> channels = {};
+    for (size_t i = 0; i < CHANNELS_; ++i) {
+      channels[i] = {.adc_channel = static_cast<uint8_t>(i),
+                     .resistance_at_25c = RESISTANCE_AT_25C_,
+                     .beta_value = BETA_VALUE_,
+                     .series_resistance = SERIES_RESISTANCE_,
+                     .calibration_offset = 0.0F};
+    }
+    NtcThermistorArray<ZeroLatencyAdc, CHANNELS_> sensors(
+        GetDefaultNtcConfig(), channels, &adc);
+    if (sensors.Initialize()) {
+      runBenchmark(options, "BM_ReadTemperaturesCelsius/Array8", CHANNELS_,
+                   [&](uint64_t iterations) {
+                     std::array<float, CHANNELS_> temperatures = {};
+                     for (uint64_t i = 0; i < iterations; ++i) {
+                       (void)sensors.ReadTemperaturesCelsius(
+                           temperatures.data());
+                       g_sink = temperatures[i % CHANNELS_];
+                     }
+                   },
+                   &results);
+    }
+  }
+
+  // Packed reading format, one record per iteration
+  {
+    constexpr size_t RECORDS_ = 64U;
+    constexpr uint64_t READ_INTERVAL_US_ = 1000U;
+    std::array<uint8_t, RECORDS_ * NTC::Packed::MAX_RECORD_BYTES_> buffer = {};
+    std::array<ntc_reading_t, RECORDS_> readings = {};
+    for (size_t i = 0; i < RECORDS_; ++i) {
+      readings[i].temperature_celsius =
+          25.0F + (0.01F * static_cast<float>(i));
+      readings[i].adc_raw_value = inputs.counts[i % INPUT_COUNT_];
+      readings[i].timestamp_us = i * READ_INTERVAL_US_;
+      readings[i].is_valid = true;
+    }
+
+    runBenchmark(options, "BM_PackedEncode", 1U,
+                 [&](uint64_t iterations) {
+                   NtcPackedEncoder encoder(buffer.data(), buffer.size());
+                   for (uint64_t i = 0; i < iterations; ++i) {
+                     const size_t index = i % RECORDS_;
+                     if (index == 0U) {
+                       encoder.Reset();
+                     }
+                     (void)encoder.Append(static_cast<uint8_t>(index & 3U),
+                                          readings[index]);
+                   }
+                   g_sink = static_cast<float>(encoder.Size());
+                 },
+                 &results);
+
+    NtcPackedEncoder encoder(buffer.data(), buffer.size());
+    for (size_t i = 0; i < RECORDS_; ++i) {
+      (void)encoder.Append(static_cast<uint8_t>(i & 3U), readings[i]);
+    }
+    const ntc_config_t config = GetDefaultNtcConfig();
+    runBenchmark(options, "BM_PackedDecode", 1U,
+                 [&](uint64_t iterations) {
+                   NtcPackedDecoder decoder(encoder.Data(), encoder.Size(),
+                                            &config);
+                   float sum = 0.0F;
+                   for (uint64_t i = 0; i < iterations; ++i) {
+                     if (!decoder.HasNext()) {
+                       decoder = NtcPackedDecoder(encoder.Data(),
+                                                  encoder.Size(), &config);
+                     }
+                     uint8_t channel = 0;
+                     ntc_reading_t reading = {};
+                     (void)decoder.Next(&channel, &reading);
+                     sum += reading.temperature_celsius;
+                   }
+                   g_sink = sum;
+                 },
+                 &results);
+  }
+
+  // Startup to the first reading: cold builds the conversion setup, warm
+  // restores it from a SaveState() blob
+  {
+    ZeroLatencyAdc adc;
+    const ntc_config_t config = GetDefaultNtcConfig();
+    ntc_config_t deferred = config;
+    deferred.defer_conversion_setup = true;
+    std::array<uint8_t, NtcThermistor<ZeroLatencyAdc>::STATE_BLOB_SIZE_>
+        blob = {};
+    NtcThermistor<ZeroLatencyAdc> saved(config, &adc);
+    if (saved.Initialize() &&
+        saved.SaveState(blob.data(), blob.size()) == NtcError::Success) {
+      runBenchmark(options, "BM_StartupToFirstReading/Cold", 1U,
+                   [&](uint64_t iterations) {
+                     float sum = 0.0F;
+                     for (uint64_t i = 0; i < iterations; ++i) {
+                       NtcThermistor<ZeroLatencyAdc> thermistor(config, &adc);
+                       float celsius = 0.0F;
+                       (void)thermistor.Initialize();
+                       (void)thermistor.ReadTemperatureCelsius(&celsius);
+                       sum += celsius;
+                     }
+                     g_sink = sum;
+                   },
+                   &results);
+
+      runBenchmark(options, "BM_StartupToFirstReading/Warm", 1U,
+                   [&](uint64_t iterations) {
+                     float sum = 0.0F;
+                     for (uint64_t i = 0; i < iterations; ++i) {
+                       NtcThermistor<ZeroLatencyAdc> thermistor(deferred,
+                                                                &adc);
+                       float celsius = 0.0F;
+                       (void)thermistor.Initialize();
+                       (void)thermistor.RestoreState(blob.data(),
+                                                     blob.size());
+                       (void)thermistor.ReadTemperatureCelsius(&celsius);
+                       sum += celsius;
+                     }
+                     g_sink = sum;
+                   },
+                   &results);
+    }
+  }
+
+  // Report
+  std::FILE *file = stdout;
+  if (options.out_path != nullptr) {
+    file = std::fopen(options.out_path, "w");
+    if (file == nullptr) {
+      std::fprintf(stderr, "Cannot open %s\n", options.out_path);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (options.json) {
+    printJson(file, options, results);
+  } else {
+    printConsole(file, results);
+  }
+
+  if (file != stdout) {
+    std::fclose(file);
+  }
+  return results.empty() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,685 @@
+/**
+ * @file ntc_load_test.cpp
+ * @brief Load-test harness driving thousands of simulated channels.
+ *
+ * Drives a virtual deployment of simulated ADC units (256 channels each,
+ * seeded trajectories, noise and injected failures) through the driver's
+ * read paths and reports readings per second, per-operation tail latency
+ * and the worst error against the simulated truth:
+ *
+ * - Sync: one NtcThermistor per channel, ReadTemperature() per reading;
+ * - Array: NtcThermistorArray scans of 32 channels;
+ * - Batch: a unit's counts acquired and converted with
+ *   NTC::ConvertAdcCountsToTemperatureBeta();
+ * - Scheduler: NtcScanScheduler with paced asynchronous conversions on the
+ *   simulated clock, also reporting deadline misses, overruns and jitter.
+ *
+ * Usage:
+ *   ntc_load_test [--channels=<n>] [--rounds=<n>]
+ *                 [--scheduler_sensors=<n>] [--sim_seconds=<s>]
+ *                 [--noise_counts=<rms>] [--failure_rate=<p>]
+ *                 [--seed=<n>] [--max_error=<celsius>]
+ *                 [--format=console|json] [--out=<file>]
+ *
+ * Returns EXIT_FAILURE if a scenario produces no readings or a valid
+ * reading is further than --max_error from the truth.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#include "ntc_conversion.hpp"
+#include "ntc_scan_scheduler.hpp"
+#include "ntc_thermistor.hpp"
+#include "ntc_thermistor_array.hpp"
+#include "simulated_adc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+//--------------------------------------
+//  Harness
+//--------------------------------------
+
+/**
+ * @brief Command line options
+ */
+struct LoadOptions {
+  size_t channels = 4096U;         ///< Virtual channels
+  uint32_t rounds = 8U;            ///< Reads of every channel (Sync/Array)
+  size_t scheduler_sensors = 512U; ///< Sensors of the Scheduler scenario
+  double sim_seconds = 2.0;        ///< Simulated run time of Scheduler
+  float noise_counts = 1.0F;       ///< ADC noise RMS (counts)
+  float failure_rate = 0.001F;     ///< Failed conversions (per conversion)
+  uint32_t seed = 1U;              ///< Simulation seed
+  float max_error_celsius = 1.0F;  ///< Largest accepted error (°C)
+  bool json = false;               ///< Emit JSON instead of a table
+  const char *out_path = nullptr;  ///< Write results to this file
+};
+
+/**
+ * @brief Result of one scenario
+ */
+struct LoadResult {
+  const char *name;           ///< Scenario name
+  const char *operation;      ///< What one latency sample times
+  uint64_t readings;          ///< Valid readings
+  uint64_t failed;            ///< Failed readings
+  double readings_per_second; ///< Valid readings per wall-clock second
+  double p50_ns;              ///< Median operation latency (ns)
+  double p99_ns;              ///< 99th percentile operation latency (ns)
+  double p999_ns;             ///< 99.9th percentile operation latency (ns)
+  double max_ns;              ///< Largest operation latency (ns)
+  float max_error_celsius;    ///< Worst valid reading against the truth (°C)
+  uint32_t deadline_misses;   ///< Scheduler deadline misses
+  uint32_t overruns;          ///< Scheduler releases dropped
+  uint32_t max_jitter_us;     ///< Scheduler release-to-start delay (µs)
+};
+
+/// Channels per NtcThermistorArray in the Array scenario
+constexpr size_t ARRAY_CHANNELS_ = 32U;
+
+/// Sensor capacity and ADC units of the Scheduler scenario
+constexpr size_t SCHEDULER_CAPACITY_ = 1024U;
+constexpr size_t SCHEDULER_UNITS_ = 16U;
+
+/// Simulated time between rounds (µs) and per conversion (µs)
+constexpr uint64_t ROUND_INTERVAL_US_ = 100000U;
+constexpr uint32_t CONVERSION_TIME_US_ = 10U;
+
+/// Keeps results observable so the reads are not optimized out
+volatile float g_sink = 0.0F;
+
+/**
+ * @brief Operation latencies of one scenario
+ */
+class LatencyRecorder {
+public:
+  /**
+   * @brief Time an operation
+   * @param operation Callable to time
+   */
+  template <typename Operation> void Time(Operation &&operation) {
+    const auto start = std::chrono::steady_clock::now();
+    operation();
+    const auto end = std::chrono::steady_clock::now();
+    const auto ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count();
+    samples_.push_back(static_cast<uint64_t>(ns));
+    total_ns_ += static_cast<uint64_t>(ns);
+  }
+
+  /**
+   * @brief Get a latency percentile (sorts the samples)
+   * @param quantile Quantile (0-1)
+   * @return Latency (ns), 0 without samples
+   */
+  double Percentile(double quantile) {
+    if (samples_.empty()) {
+      return 0.0;
+    }
+    std::sort(samples_.begin(), samples_.end());
+    const auto index = static_cast<size_t>(
+        quantile * static_cast<double>(samples_.size() - 1U));
+    return static_cast<double>(samples_[index]);
+  }
+
+  /**
+   * @brief Get the total time of the timed operations
+   * @return Total (s)
+   */
+  [[nodiscard]] double TotalSeconds() const {
+    return static_cast<double>(total_ns_) * 1e-9;
+  }
+
+private:
+  std::vector<uint64_t> samples_; ///< Per-operation latencies (ns)
+  uint64_t total_ns_ = 0U;        ///< Sum of the latencies (ns)
+};
+
+/**
+ * @brief Fill in the throughput and latency fields of a result
+ * @param recorder Latencies of the scenario
+ * @param result Result to complete
+ */
+void finishResult(LatencyRecorder *recorder, LoadResult *result) {
+  const double seconds = recorder->TotalSeconds();
+  result->readings_per_second =
+      (seconds > 0.0) ? static_cast<double>(result->readings) / seconds : 0.0;
+  result->p50_ns = recorder->Percentile(0.5);
+  result->p99_ns = recorder->Percentile(0.99);
+  result->p999_ns = recorder->Percentile(0.999);
+  result->max_ns = recorder->Percentile(1.0);
+}
+
+//--------------------------------------
+//  Virtual Deployment
+//--------------------------------------
+
+/**
+ * @brief Trajectory of a virtual channel
+ *
+ * Spreads base temperatures, drifts and sine periods over the channels and
+ * steps every 16th channel by 5°C one second in.
+ *
+ * @param index Global channel index
+ * @return Trajectory
+ */
+SimulatedTrajectory channelTrajectory(size_t index) {
+  SimulatedTrajectory trajectory;
+  trajectory.base_celsius = 20.0F + static_cast<float>(index % 50U);
+  trajectory.slope_celsius_per_second =
+      0.01F * (static_cast<float>(index % 7U) - 3.0F);
+  trajectory.amplitude_celsius = 2.0F + static_cast<float>(index % 5U);
+  trajectory.period_s = 30.0F + (5.0F * static_cast<float>(index % 11U));
+  if ((index % 16U) == 0U) {
+    trajectory.step_celsius = 5.0F;
+    trajectory.step_time_s = 1.0F;
+  }
+  return trajectory;
+}
+
+/**
+ * @brief Build the simulated ADC units of the deployment
+ * @param options Command line options
+ * @return One unit per 256 channels, channel i on unit i / 256
+ */
+std::vector<std::unique_ptr<SimulatedAdc>>
+makeAdcs(const LoadOptions &options) {
+  const size_t unit_count =
+      (options.channels + SimulatedAdc::CHANNEL_COUNT_ - 1U) /
+      SimulatedAdc::CHANNEL_COUNT_;
+  std::vector<std::unique_ptr<SimulatedAdc>> adcs;
+  for (size_t unit = 0; unit < unit_count; ++unit) {
+    auto adc = std::make_unique<SimulatedAdc>(
+        options.seed + static_cast<uint32_t>(unit));
+    adc->SetNoiseCounts(options.noise_counts);
+    adc->SetFailureRate(options.failure_rate);
+    adc->SetConversionTimeUs(CONVERSION_TIME_US_);
+    for (size_t channel = 0; channel < SimulatedAdc::CHANNEL_COUNT_;
+         ++channel) {
+      adc->SetTrajectory(
+          static_cast<uint8_t>(channel),
+          channelTrajectory((unit * SimulatedAdc::CHANNEL_COUNT_) + channel));
+    }
+    adcs.push_back(std::move(adc));
+  }
+  return adcs;
+}
+
+/**
+ * @brief Move every unit's clock
+ * @param adcs ADC units
+ * @param time_us Simulated time (µs)
+ */
+void setTime(const std::vector<std::unique_ptr<SimulatedAdc>> &adcs,
+             uint64_t time_us) {
+  for (const auto &adc : adcs) {
+    adc->SetTimeUs(time_us);
+  }
+}
+
+/**
+ * @brief Update the worst error with a reading
+ * @param adc ADC unit of the reading
+ * @param channel ADC channel of the reading
+ * @param reading Reading (invalid readings are skipped)
+ * @param max_error_celsius Worst error so far
+ */
+void trackError(const SimulatedAdc &adc, uint8_t channel,
+                const ntc_reading_t &reading, float *max_error_celsius) {
+  if (!reading.is_valid) {
+    return;
+  }
+  const float truth = adc.TrueTemperatureCelsius(channel, reading.timestamp_us);
+  *max_error_celsius = std::max(
+      *max_error_celsius, std::fabs(reading.temperature_celsius - truth));
+}
+
+//--------------------------------------
+//  Scenarios
+//--------------------------------------
+
+/**
+ * @brief One NtcThermistor per channel, read synchronously
+ * @param options Command line options
+ * @return Scenario result
+ */
+LoadResult runSync(const LoadOptions &options) {
+  LoadResult result = {};
+  result.name = "Sync/NtcThermistor";
+  result.operation = "reading";
+
+  auto adcs = makeAdcs(options);
+  std::vector<std::unique_ptr<NtcThermistor<SimulatedAdc>>> thermistors;
+  for (size_t i = 0; i < options.channels; ++i) {
+    ntc_config_t config = GetDefaultNtcConfig();
+    config.adc_channel =
+        static_cast<uint8_t>(i % SimulatedAdc::CHANNEL_COUNT_);
+    auto thermistor = std::make_unique<NtcThermistor<SimulatedAdc>>(
+        config, adcs[i / SimulatedAdc::CHANNEL_COUNT_].get());
+    if (!thermistor->Initialize()) {
+      return result;
+    }
+    thermistors.push_back(std::move(thermistor));
+  }
+
+  LatencyRecorder recorder;
+  for (uint32_t round = 0; round < options.rounds; ++round) {
+    setTime(adcs, round * ROUND_INTERVAL_US_);
+    for (size_t i = 0; i < thermistors.size(); ++i) {
+      ntc_reading_t reading = {};
+      recorder.Time([&] { (void)thermistors[i]->ReadTemperature(&reading); });
+      if (reading.is_valid) {
+        result.readings++;
+        g_sink = reading.temperature_celsius;
+      } else {
+        result.failed++;
+      }
+      trackError(*adcs[i / SimulatedAdc::CHANNEL_COUNT_],
+                 static_cast<uint8_t>(i % SimulatedAdc::CHANNEL_COUNT_),
+                 reading, &result.max_error_celsius);
+    }
+  }
+
+  finishResult(&recorder, &result);
+  return result;
+}
+
+/**
+ * @brief NtcThermistorArray scans of ARRAY_CHANNELS_ channels
+ * @param options Command line options
+ * @return Scenario result (latency per scan)
+ */
+LoadResult runArray(const LoadOptions &options) {
+  using SensorArray = NtcThermistorArray<SimulatedAdc, ARRAY_CHANNELS_>;
+  LoadResult result = {};
+  result.name = "Array/NtcThermistorArray32";
+  result.operation = "scan";
+
+  auto adcs = makeAdcs(options);
+  const ntc_config_t config = GetDefaultNtcConfig();
+  std::vector<std::unique_ptr<SensorArray>> arrays;
+  std::vector<size_t> first_channels;
+  for (size_t first = 0; first + ARRAY_CHANNELS_ <= options.channels;
+       first += ARRAY_CHANNELS_) {
+    std::array<ntc_channel_config_t, ARRAY_CHANNELS_> channels = {};
+    for (size_t i = 0; i < ARRAY_CHANNELS_; ++i) {
+      channels[i] = {.adc_channel = static_cast<uint8_t>(
+                         (first + i) % SimulatedAdc::CHANNEL_COUNT_),
+                     .resistance_at_25c = config.resistance_at_25c,
+                     .beta_value = config.beta_value,
+                     .series_resistance = config.series_resistance,
+                     .calibration_offset = 0.0F};
+    }
+    auto sensors = std::make_unique<SensorArray>(
+        config, channels, adcs[first / SimulatedAdc::CHANNEL_COUNT_].get());
+    if (!sensors->Initialize()) {
+      return result;
+    }
+    arrays.push_back(std::move(sensors));
+    first_channels.push_back(first);
+  }
+
+  LatencyRecorder recorder;
+  std::array<float, ARRAY_CHANNELS_> temperatures = {};
+  for (uint32_t round = 0; round < options.rounds; ++round) {
+    setTime(adcs, round * ROUND_INTERVAL_US_);
+    for (size_t a = 0; a < arrays.size(); ++a) {
+      uint32_t valid_mask = 0U;
+      recorder.Time([&] {
+        (void)arrays[a]->ReadTemperaturesCelsius(temperatures.data(),
+                                                 &valid_mask);
+      });
+
+      const SimulatedAdc &adc =
+          *adcs[first_channels[a] / SimulatedAdc::CHANNEL_COUNT_];
+      for (size_t i = 0; i < ARRAY_CHANNELS_; ++i) {
+        ntc_reading_t reading = {};
+        reading.is_valid = ((valid_mask >> i) & 1U) != 0U;
+        reading.temperature_celsius = temperatures[i];
+        reading.timestamp_us = arrays[a]->GetLastScanTimestampUs();
+        if (reading.is_valid) {
+          result.readings++;
+        } else {
+          result.failed++;
+        }
+        trackError(adc,
+                   static_cast<uint8_t>((first_channels[a] + i) %
+                                        SimulatedAdc::CHANNEL_COUNT_),
+                   reading, &result.max_error_celsius);
+      }
+      g_sink = temperatures[0];
+    }
+  }
+
+  finishResult(&recorder, &result);
+  return result;
+}
+
+/**
+ * @brief Acquire a unit's counts and convert them as one batch
+ * @param options Command line options
+ * @return Scenario result (latency per batch of one unit)
+ */
+LoadResult runBatch(const LoadOptions &options) {
+  LoadResult result = {};
+  result.name = "Batch/ConvertAdcCountsToTemperatureBeta";
+  result.operation = "unit batch";
+
+  auto adcs = makeAdcs(options);
+  const ntc_config_t config = GetDefaultNtcConfig();
+  std::array<uint32_t, SimulatedAdc::CHANNEL_COUNT_> counts = {};
+  std::array<uint64_t, SimulatedAdc::CHANNEL_COUNT_> sample_us = {};
+  std::array<float, SimulatedAdc::CHANNEL_COUNT_> temperatures = {};
+  std::array<uint8_t, NTC::BatchMaskBytes(SimulatedAdc::CHANNEL_COUNT_)>
+      out_of_range = {};
+  std::array<bool, SimulatedAdc::CHANNEL_COUNT_> acquired = {};
+
+  LatencyRecorder recorder;
+  for (uint32_t round = 0; round < options.rounds; ++round) {
+    setTime(adcs, round * ROUND_INTERVAL_US_);
+    for (size_t unit = 0; unit < adcs.size(); ++unit) {
+      SimulatedAdc &adc = *adcs[unit];
+      const size_t channels =
+          std::min(SimulatedAdc::CHANNEL_COUNT_,
+                   options.channels - (unit * SimulatedAdc::CHANNEL_COUNT_));
+      recorder.Time([&] {
+        for (size_t i = 0; i < channels; ++i) {
+          sample_us[i] = adc.ReadTimestampUs();
+          acquired[i] = adc.ReadChannelCount(static_cast<uint8_t>(i),
+                                             &counts[i]) ==
+                        ntc::AdcError::Success;
+        }
+        (void)NTC::ConvertAdcCountsToTemperatureBeta(
+            counts.data(), temperatures.data(), channels,
+            config.adc_resolution_bits, config.series_resistance,
+            config.resistance_at_25c, config.beta_value, out_of_range.data());
+      });
+
+      for (size_t i = 0; i < channels; ++i) {
+        ntc_reading_t reading = {};
+        reading.is_valid =
+            acquired[i] && ((out_of_range[i / 8U] >> (i % 8U)) & 1U) == 0U;
+        reading.temperature_celsius = temperatures[i];
+        reading.timestamp_us = sample_us[i];
+        if (reading.is_valid) {
+          result.readings++;
+        } else {
+          result.failed++;
+        }
+        trackError(adc, static_cast<uint8_t>(i), reading,
+                   &result.max_error_celsius);
+      }
+      g_sink = temperatures[0];
+    }
+  }
+
+  finishResult(&recorder, &result);
+  return result;
+}
+
+/**
+ * @brief NtcScanScheduler over paced asynchronous conversions
+ *
+ * Sensor i sits on unit i % units, so every unit carries its share. One
+ * sensor in 32 of each unit is critical (10 ms period, 5 ms deadline,
+ * priority 1); the others run every 100 ms. Releases are phased over the
+ * period. Every burst is two samples 1 ms apart on the simulated clock.
+ *
+ * @param options Command line options
+ * @return Scenario result (latency per Service() call)
+ */
+LoadResult runScheduler(const LoadOptions &options) {
+  using Scheduler =
+      NtcScanScheduler<SimulatedAdc, SCHEDULER_CAPACITY_, SCHEDULER_UNITS_>;
+  constexpr uint32_t NORMAL_PERIOD_US_ = 100000U;
+  constexpr uint32_t CRITICAL_PERIOD_US_ = 10000U;
+  constexpr uint32_t CRITICAL_DEADLINE_US_ = 5000U;
+  constexpr size_t CRITICAL_EVERY_ = 32U;
+
+  LoadResult result = {};
+  result.name = "Scheduler/NtcScanScheduler";
+  result.operation = "Service()";
+
+  auto adcs = makeAdcs(options);
+  const size_t sensors = std::min(
+      {options.scheduler_sensors, options.channels, SCHEDULER_CAPACITY_});
+  const size_t units = std::min(adcs.size(), SCHEDULER_UNITS_);
+  auto scheduler = std::make_unique<Scheduler>();
+  std::vector<std::unique_ptr<NtcThermistor<SimulatedAdc>>> thermistors;
+  for (size_t i = 0; i < sensors; ++i) {
+    ntc_config_t config = GetDefaultNtcConfig();
+    config.adc_channel = static_cast<uint8_t>(i / units);
+    config.sample_count = 2U;
+    config.sample_delay_ms = 1U;
+    auto thermistor = std::make_unique<NtcThermistor<SimulatedAdc>>(
+        config, adcs[i % units].get());
+    const bool critical = ((i / units) % CRITICAL_EVERY_) == 0U;
+    const uint32_t period_us =
+        critical ? CRITICAL_PERIOD_US_ : NORMAL_PERIOD_US_;
+    const ntc_scan_sensor_config_t sensor = {
+        .period_us = period_us,
+        .deadline_us = critical ? CRITICAL_DEADLINE_US_ : 0U,
+        .phase_us = static_cast<uint32_t>((i * period_us) / sensors),
+        .priority = critical ? uint8_t{1U} : uint8_t{0U},
+        .adc_unit = static_cast<uint8_t>(i % units)};
+    if (!thermistor->Initialize() ||
+        scheduler->AddSensor(thermistor.get(), sensor) != NtcError::Success) {
+      return result;
+    }
+    thermistors.push_back(std::move(thermistor));
+  }
+
+  LatencyRecorder recorder;
+  const auto end_us = static_cast<uint64_t>(options.sim_seconds * 1e6);
+  uint64_t now_us = 0U;
+  scheduler->Start(now_us);
+  while (now_us < end_us) {
+    setTime(adcs, now_us);
+    recorder.Time([&] { (void)scheduler->Service(now_us); });
+    now_us = scheduler->NextDueUs();
+  }
+  scheduler->Stop();
+
+  ntc_scan_stats_t stats = {};
+  (void)scheduler->GetTotalStats(&stats);
+  result.readings = stats.completed - stats.errors;
+  result.failed = stats.errors;
+  result.deadline_misses = stats.deadline_misses;
+  result.overruns = stats.overruns;
+  result.max_jitter_us = stats.max_jitter_us;
+  for (size_t i = 0; i < sensors; ++i) {
+    ntc_reading_t reading = {};
+    if (scheduler->GetReading(i, &reading) == NtcError::Success) {
+      trackError(*adcs[i % units], static_cast<uint8_t>(i / units), reading,
+                 &result.max_error_celsius);
+    }
+  }
+
+  finishResult(&recorder, &result);
+  return result;
+}
+
+//--------------------------------------
+//  Reporting
+//--------------------------------------
+
+/**
+ * @brief Print results as a table
+ * @param file Output stream
+ * @param results Scenario results
+ */
+void printConsole(std::FILE *file, const std::vector<LoadResult> &results) {
+  std::fprintf(file, "%-40s %10s %8s %14s %10s %10s %10s %10s %9s\n",
+               "Scenario", "Readings", "Failed", "Readings/s", "p50 (ns)",
+               "p99 (ns)", "p99.9 (ns)", "max (ns)", "Err (C)");
+  for (const LoadResult &result : results) {
+    std::fprintf(file,
+                 "%-40s %10llu %8llu %14.0f %10.0f %10.0f %10.0f %10.0f "
+                 "%9.3f\n",
+                 result.name, static_cast<unsigned long long>(result.readings),
+                 static_cast<unsigned long long>(result.failed),
+                 result.readings_per_second, result.p50_ns, result.p99_ns,
+                 result.p999_ns, result.max_ns,
+                 static_cast<double>(result.max_error_celsius));
+  }
+  for (const LoadResult &result : results) {
+    std::fprintf(file, "%s: latency per %s", result.name, result.operation);
+    if (std::strncmp(result.name, "Scheduler", 9) == 0) {
+      std::fprintf(file,
+                   "; %u deadline misses, %u overruns, max jitter %u us "
+                   "(simulated)",
+                   result.deadline_misses, result.overruns,
+                   result.max_jitter_us);
+    }
+    std::fprintf(file, "\n");
+  }
+}
+
+/**
+ * @brief Print results as JSON
+ * @param file Output stream
+ * @param options Command line options
+ * @param results Scenario results
+ */
+void printJson(std::FILE *file, const LoadOptions &options,
+               const std::vector<LoadResult> &results) {
+  std::fprintf(file, "{\n  \"context\": {\n");
+  std::fprintf(file, "    \"library\": \"hf-ntc-thermistor\",\n");
+  std::fprintf(file,
+               "    \"channels\": %zu, \"rounds\": %u, \"seed\": %u,\n"
+               "    \"noise_counts\": %g, \"failure_rate\": %g\n  },\n",
+               options.channels, options.rounds, options.seed,
+               static_cast<double>(options.noise_counts),
+               static_cast<double>(options.failure_rate));
+  std::fprintf(file, "  \"scenarios\": [\n");
+  for (size_t i = 0; i < results.size(); ++i) {
+    const LoadResult &result = results[i];
+    std::fprintf(
+        file,
+        "    {\"name\": \"%s\", \"operation\": \"%s\", \"readings\": %llu, "
+        "\"failed\": %llu, \"readings_per_second\": %.1f, \"p50_ns\": %.0f, "
+        "\"p99_ns\": %.0f, \"p999_ns\": %.0f, \"max_ns\": %.0f, "
+        "\"max_error_celsius\": %.4f, \"deadline_misses\": %u, "
+        "\"overruns\": %u, \"max_jitter_us\": %u}%s\n",
+        result.name, result.operation,
+        static_cast<unsigned long long>(result.readings),
+        static_cast<unsigned long long>(result.failed),
+        result.readings_per_second, result.p50_ns, result.p99_ns,
+        result.p999_ns, result.max_ns,
+        static_cast<double>(result.max_error_celsius), result.deadline_misses,
+        result.overruns, result.max_jitter_us,
+        (i + 1U < results.size()) ? "," : "");
+  }
+  std::fprintf(file, "  ]\n}\n");
+}
+
+/**
+ * @brief Parse command line options
+ * @param argc Argument count
+ * @param argv Arguments
+ * @param options Pointer to store the options
+ * @return true if every argument was recognized
+ */
+bool parseOptions(int argc, char **argv, LoadOptions *options) {
+  for (int i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    if (std::strncmp(arg, "--channels=", 11) == 0) {
+      options->channels = std::strtoul(arg + 11, nullptr, 10);
+    } else if (std::strncmp(arg, "--rounds=", 9) == 0) {
+      options->rounds =
+          static_cast<uint32_t>(std::strtoul(arg + 9, nullptr, 10));
+    } else if (std::strncmp(arg, "--scheduler_sensors=", 20) == 0) {
+      options->scheduler_sensors = std::strtoul(arg + 20, nullptr, 10);
+    } else if (std::strncmp(arg, "--sim_seconds=", 14) == 0) {
+      options->sim_seconds = std::atof(arg + 14);
+    } else if (std::strncmp(arg, "--noise_counts=", 15) == 0) {
+      options->noise_counts = static_cast<float>(std::atof(arg + 15));
+    } else if (std::strncmp(arg, "--failure_rate=", 15) == 0) {
+      options->failure_rate = static_cast<float>(std::atof(arg + 15));
+    } else if (std::strncmp(arg, "--seed=", 7) == 0) {
+      options->seed = static_cast<uint32_t>(std::strtoul(arg + 7, nullptr, 10));
+    } else if (std::strncmp(arg, "--max_error=", 12) == 0) {
+      options->max_error_celsius = static_cast<float>(std::atof(arg + 12));
+    } else if (std::strcmp(arg, "--format=json") == 0) {
+      options->json = true;
+    } else if (std::strcmp(arg, "--format=console") == 0) {
+      options->json = false;
+    } else if (std::strncmp(arg, "--out=", 6) == 0) {
+      options->out_path = arg + 6;
+    } else {
+      std::fprintf(stderr, "Unknown argument: %s\n", arg);
+      return false;
+    }
+  }
+
+  if (options->channels == 0U) {
+    std::fprintf(stderr, "--channels must be positive\n");
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+//--------------------------------------
+//  Main
+//--------------------------------------
+
+int main(int argc, char **argv) {
+  LoadOptions options;
+  if (!parseOptions(argc, argv, &options)) {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<LoadResult> results;
+  results.push_back(runSync(options));
+  results.push_back(runArray(options));
+  results.push_back(runBatch(options));
+  results.push_back(runScheduler(options));
+
+  std::FILE *file = stdout;
+  if (options.out_path != nullptr) {
+    file = std::fopen(options.out_path, "w");
+    if (file == nullptr) {
+      std::fprintf(stderr, "Cannot open %s\n", options.out_path);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (options.json) {
+    printJson(file, options, results);
+  } else {
+    printConsole(file, results);
+  }
+
+  if (file != stdout) {
+    std::fclose(file);
+  }
+
+  bool passed = true;
+  for (const LoadResult &result : results) {
+    if (result.readings == 0U ||
+        result.max_error_celsius > options.max_error_celsius) {
+      std::fprintf(stderr, "%s: %llu readings, max error %.3f C\n",
+                   result.name,
+                   static_cast<unsigned long long>(result.readings),
+                   static_cast<double>(result.max_error_celsius));
+      passed = false;
+    }
+  }
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
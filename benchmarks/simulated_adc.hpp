@@ -0,0 +1,328 @@
+/**
+ * @file simulated_adc.hpp
+ * @brief Deterministic simulated ADC for host load and behaviour testing.
+ *
+ * This header provides an ADC whose channels follow configurable
+ * temperature trajectories through a thermistor divider, with seeded noise,
+ * failure and glitch injection and a simulated conversion latency clock, so
+ * driver, scheduler and asynchronous behaviour can be exercised on a host
+ * and reproduced exactly.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_SIMULATED_ADC_H
+#define NTC_SIMULATED_ADC_H
+
+#include "ntc_adc_interface.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Temperature of one simulated channel over time
+ *
+ * T(t) = base + slope * t + amplitude * sin(2 pi t / period), plus
+ * step_celsius from step_time_s on.
+ */
+struct SimulatedTrajectory {
+  float base_celsius = 25.0F;            ///< Temperature at t = 0 (°C)
+  float slope_celsius_per_second = 0.0F; ///< Linear drift (°C/s)
+  float amplitude_celsius = 0.0F;        ///< Sine amplitude (°C)
+  float period_s = 60.0F;                ///< Sine period (s)
+  float step_celsius = 0.0F;             ///< Step height (°C)
+  float step_time_s = 0.0F;              ///< Step time (s)
+
+  /**
+   * @brief Evaluate the trajectory
+   * @param time_s Simulated time (s)
+   * @return Temperature (°C)
+   */
+  [[nodiscard]] float TemperatureAt(float time_s) const {
+    constexpr float TWO_PI_ = 6.28318531F;
+    float celsius = base_celsius + (slope_celsius_per_second * time_s);
+    if (amplitude_celsius != 0.0F && period_s > 0.0F) {
+      celsius += amplitude_celsius * std::sin(TWO_PI_ * time_s / period_s);
+    }
+    if (step_celsius != 0.0F && time_s >= step_time_s) {
+      celsius += step_celsius;
+    }
+    return celsius;
+  }
+};
+
+/**
+ * @class SimulatedAdc
+ * @brief ADC with per-channel thermistor trajectories on a simulated clock
+ *
+ * Every channel models a beta thermistor on the low side of a divider, so
+ * counts decode to the trajectory with the default NtcThermistor
+ * configuration. Each conversion:
+ *
+ * - evaluates the channel's trajectory at the simulated clock;
+ * - adds zero-mean noise of noise_rms_counts (seeded, reproducible);
+ * - fails with ReadFailed with probability failure_rate, or returns full
+ *   scale with probability glitch_rate;
+ * - advances the clock by conversion_time_us (exposed through
+ *   ReadTimestampUs(), so readings carry simulated acquisition times).
+ *
+ * The same seed and call sequence always give the same counts.
+ */
+class SimulatedAdc : public ntc::AdcInterface<SimulatedAdc> {
+public:
+  static constexpr size_t CHANNEL_COUNT_ = 256U; ///< Channels per ADC
+
+  /**
+   * @brief Constructor
+   * @param seed Noise and fault injection seed (0 is replaced by 1)
+   * @param reference_voltage Reference voltage (V)
+   * @param resolution_bits ADC resolution (bits)
+   */
+  explicit SimulatedAdc(uint32_t seed = 1U, float reference_voltage = 3.3F,
+                        uint8_t resolution_bits = 12U) noexcept
+      : reference_voltage_(reference_voltage),
+        resolution_bits_(resolution_bits),
+        full_scale_(static_cast<float>((1ULL << resolution_bits) - 1ULL)),
+        resistance_at_25c_(10000.0F), beta_value_(3435.0F),
+        series_resistance_(10000.0F), noise_rms_counts_(0.0F),
+        failure_rate_(0.0F), glitch_rate_(0.0F), conversion_time_us_(0U),
+        clock_us_(0U), rng_state_((seed != 0U) ? seed : 1U), conversions_(0U),
+        failures_(0U), glitches_(0U), trajectories_() {}
+
+  //==============================================================//
+  // ADC INTERFACE
+  //==============================================================//
+
+  /**
+   * @brief Check if ADC is initialized
+   * @return Always true
+   */
+  bool IsInitialized() const { return true; }
+
+  /**
+   * @brief Ensure ADC is initialized
+   * @return Always true
+   */
+  bool EnsureInitialized() { return true; }
+
+  /**
+   * @brief Check if channel is available
+   * @param channel ADC channel
+   * @return true for every uint8_t channel
+   */
+  bool IsChannelAvailable(uint8_t channel) const {
+    (void)channel;
+    return true;
+  }
+
+  /**
+   * @brief Convert a channel at the simulated clock
+   * @param channel ADC channel
+   * @param count Pointer to store the count
+   * @return AdcError::Success, or ReadFailed when a failure is injected
+   */
+  ntc::AdcError ReadChannelCount(uint8_t channel, uint32_t *count) {
+    const uint64_t sample_us = clock_us_;
+    clock_us_ += conversion_time_us_;
+    conversions_++;
+
+    if (failure_rate_ > 0.0F && nextUniform() < failure_rate_) {
+      failures_++;
+      return ntc::AdcError::ReadFailed;
+    }
+
+    if (glitch_rate_ > 0.0F && nextUniform() < glitch_rate_) {
+      glitches_++;
+      *count = static_cast<uint32_t>(full_scale_);
+      return ntc::AdcError::Success;
+    }
+
+    float ideal = IdealCount(channel, sample_us);
+    if (noise_rms_counts_ > 0.0F) {
+      ideal += noise_rms_counts_ * nextNoise();
+    }
+    *count = static_cast<uint32_t>(
+        std::lround(std::clamp(ideal, 0.0F, full_scale_)));
+    return ntc::AdcError::Success;
+  }
+
+  /**
+   * @brief Convert a channel at the simulated clock, in volts
+   * @param channel ADC channel
+   * @param voltage_v Pointer to store the voltage (V)
+   * @return AdcError of ReadChannelCount()
+   */
+  ntc::AdcError ReadChannelV(uint8_t channel, float *voltage_v) {
+    uint32_t count = 0;
+    const ntc::AdcError error = ReadChannelCount(channel, &count);
+    *voltage_v = static_cast<float>(count) * reference_voltage_ / full_scale_;
+    return error;
+  }
+
+  /**
+   * @brief Get reference voltage
+   * @return Reference voltage (V)
+   */
+  float GetReferenceVoltage() const { return reference_voltage_; }
+
+  /**
+   * @brief Get ADC resolution
+   * @return Resolution (bits)
+   */
+  uint8_t GetResolutionBits() const { return resolution_bits_; }
+
+  /**
+   * @brief Read the simulated acquisition clock
+   * @return Simulated time (µs)
+   */
+  uint64_t ReadTimestampUs() const { return clock_us_; }
+
+  //==============================================================//
+  // SIMULATION
+  //==============================================================//
+
+  /**
+   * @brief Set the thermistor and divider of every channel
+   * @param resistance_at_25c Resistance at 25°C (ohms)
+   * @param beta_value Beta value (K)
+   * @param series_resistance Series resistance (ohms)
+   */
+  void SetDivider(float resistance_at_25c, float beta_value,
+                  float series_resistance) {
+    resistance_at_25c_ = resistance_at_25c;
+    beta_value_ = beta_value;
+    series_resistance_ = series_resistance;
+  }
+
+  /**
+   * @brief Set the trajectory of one channel
+   * @param channel ADC channel
+   * @param trajectory Temperature over time
+   */
+  void SetTrajectory(uint8_t channel, const SimulatedTrajectory &trajectory) {
+    trajectories_[channel] = trajectory;
+  }
+
+  /**
+   * @brief Set the noise added to every conversion
+   * @param rms_counts Noise RMS (counts, 0 = none)
+   */
+  void SetNoiseCounts(float rms_counts) { noise_rms_counts_ = rms_counts; }
+
+  /**
+   * @brief Set the probability of a failed conversion
+   * @param probability Probability per conversion (0-1)
+   */
+  void SetFailureRate(float probability) { failure_rate_ = probability; }
+
+  /**
+   * @brief Set the probability of a full-scale glitch
+   * @param probability Probability per conversion (0-1)
+   */
+  void SetGlitchRate(float probability) { glitch_rate_ = probability; }
+
+  /**
+   * @brief Set the simulated time each conversion takes
+   * @param conversion_time_us Time per conversion (µs, 0 freezes the clock)
+   */
+  void SetConversionTimeUs(uint32_t conversion_time_us) {
+    conversion_time_us_ = conversion_time_us;
+  }
+
+  /**
+   * @brief Move the simulated clock
+   * @param time_us Simulated time (µs)
+   */
+  void SetTimeUs(uint64_t time_us) { clock_us_ = time_us; }
+
+  /**
+   * @brief Get the true temperature of a channel
+   * @param channel ADC channel
+   * @param time_us Simulated time (µs)
+   * @return Temperature (°C)
+   */
+  [[nodiscard]] float TrueTemperatureCelsius(uint8_t channel,
+                                             uint64_t time_us) const {
+    return trajectories_[channel].TemperatureAt(
+        static_cast<float>(static_cast<double>(time_us) * 1e-6));
+  }
+
+  /**
+   * @brief Get the noiseless count of a channel
+   * @param channel ADC channel
+   * @param time_us Simulated time (µs)
+   * @return Count before noise and rounding
+   */
+  [[nodiscard]] float IdealCount(uint8_t channel, uint64_t time_us) const {
+    const float kelvin = TrueTemperatureCelsius(channel, time_us) + 273.15F;
+    const float resistance =
+        resistance_at_25c_ *
+        std::exp(beta_value_ * ((1.0F / kelvin) - (1.0F / 298.15F)));
+    return full_scale_ * resistance / (resistance + series_resistance_);
+  }
+
+  /**
+   * @brief Get the number of conversions performed
+   * @return Conversions, failed ones included
+   */
+  [[nodiscard]] uint64_t GetConversionCount() const { return conversions_; }
+
+  /**
+   * @brief Get the number of injected failures
+   * @return Conversions that returned ReadFailed
+   */
+  [[nodiscard]] uint64_t GetFailureCount() const { return failures_; }
+
+  /**
+   * @brief Get the number of injected glitches
+   * @return Conversions that returned full scale
+   */
+  [[nodiscard]] uint64_t GetGlitchCount() const { return glitches_; }
+
+private:
+  float reference_voltage_;     ///< Reference voltage (V)
+  uint8_t resolution_bits_;     ///< Resolution (bits)
+  float full_scale_;            ///< Largest count
+  float resistance_at_25c_;     ///< Thermistor resistance at 25°C (ohms)
+  float beta_value_;            ///< Thermistor beta value (K)
+  float series_resistance_;     ///< Divider series resistance (ohms)
+  float noise_rms_counts_;      ///< Noise RMS (counts)
+  float failure_rate_;          ///< Failure probability per conversion
+  float glitch_rate_;           ///< Glitch probability per conversion
+  uint32_t conversion_time_us_; ///< Simulated time per conversion (µs)
+  uint64_t clock_us_;           ///< Simulated clock (µs)
+  uint32_t rng_state_;          ///< xorshift32 state
+  uint64_t conversions_;        ///< Conversions performed
+  uint64_t failures_;           ///< Injected failures
+  uint64_t glitches_;           ///< Injected glitches
+  std::array<SimulatedTrajectory, CHANNEL_COUNT_>
+      trajectories_; ///< Trajectory of each channel
+
+  /**
+   * @brief Draw a uniform number
+   * @return Value in [0, 1)
+   */
+  float nextUniform() {
+    rng_state_ ^= rng_state_ << 13U;
+    rng_state_ ^= rng_state_ >> 17U;
+    rng_state_ ^= rng_state_ << 5U;
+    return static_cast<float>(rng_state_ >> 8U) * (1.0F / 16777216.0F);
+  }
+
+  /**
+   * @brief Draw approximately normal noise of unit variance
+   * @return Sum of four uniforms, centred and scaled
+   */
+  float nextNoise() {
+    constexpr float SQRT_3_ = 1.73205081F;
+    const float sum =
+        nextUniform() + nextUniform() + nextUniform() + nextUniform();
+    return (sum - 2.0F) * SQRT_3_;
+  }
+};
+
+#endif // NTC_SIMULATED_ADC_H
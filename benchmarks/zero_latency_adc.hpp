@@ -0,0 +1,140 @@
+/**
+ * @file zero_latency_adc.hpp
+ * @brief Zero-latency ADC implementation for benchmarking the driver.
+ *
+ * This header provides an ADC that returns precomputed counts without any
+ * I/O, so driver benchmarks measure only the driver's own work.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_ZERO_LATENCY_ADC_H
+#define NTC_ZERO_LATENCY_ADC_H
+
+#include "ntc_adc_interface.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class ZeroLatencyAdc
+ * @brief ADC that cycles through counts of a 10k/3435 sensor
+ *
+ * The counts span -30..110°C behind a 10 kΩ series resistor so conversion
+ * benchmarks see the whole table range rather than one cached segment.
+ */
+class ZeroLatencyAdc : public ntc::AdcInterface<ZeroLatencyAdc> {
+public:
+  static constexpr size_t COUNT_PATTERN_SIZE_ = 64U; ///< Counts per cycle
+
+  /**
+   * @brief Constructor
+   * @param reference_voltage Reference voltage (V)
+   * @param resolution_bits ADC resolution (bits)
+   */
+  explicit ZeroLatencyAdc(float reference_voltage = 3.3F,
+                          uint8_t resolution_bits = 12U) noexcept
+      : reference_voltage_(reference_voltage),
+        resolution_bits_(resolution_bits), next_(0U), counts_() {
+    constexpr float MIN_CELSIUS_ = -30.0F;
+    constexpr float MAX_CELSIUS_ = 110.0F;
+    constexpr float BETA_ = 3435.0F;
+    constexpr float RESISTANCE_AT_25C_ = 10000.0F;
+    constexpr float SERIES_RESISTANCE_ = 10000.0F;
+    const float full_scale =
+        static_cast<float>((1ULL << resolution_bits_) - 1ULL);
+    for (size_t i = 0; i < COUNT_PATTERN_SIZE_; ++i) {
+      const float celsius =
+          MIN_CELSIUS_ + ((MAX_CELSIUS_ - MIN_CELSIUS_) *
+                          static_cast<float>(i) /
+                          static_cast<float>(COUNT_PATTERN_SIZE_ - 1U));
+      const float kelvin = celsius + 273.15F;
+      const float resistance =
+          RESISTANCE_AT_25C_ *
+          std::exp(BETA_ * ((1.0F / kelvin) - (1.0F / 298.15F)));
+      counts_[i] = static_cast<uint32_t>(std::lround(
+          full_scale * resistance / (resistance + SERIES_RESISTANCE_)));
+    }
+  }
+
+  /**
+   * @brief Check if ADC is initialized
+   * @return Always true
+   */
+  bool IsInitialized() const { return true; }
+
+  /**
+   * @brief Ensure ADC is initialized
+   * @return Always true
+   */
+  bool EnsureInitialized() { return true; }
+
+  /**
+   * @brief Check if channel is available
+   * @param channel ADC channel
+   * @return true for channels 0-31
+   */
+  bool IsChannelAvailable(uint8_t channel) const {
+    constexpr uint8_t CHANNEL_COUNT_ = 32U;
+    return channel < CHANNEL_COUNT_;
+  }
+
+  /**
+   * @brief Return the next precomputed count
+   * @param channel ADC channel (ignored)
+   * @param count Pointer to store the count
+   * @return AdcError::Success
+   */
+  ntc::AdcError ReadChannelCount(uint8_t channel, uint32_t *count) {
+    (void)channel;
+    *count = counts_[next_];
+    next_ = (next_ + 1U) % COUNT_PATTERN_SIZE_;
+    return ntc::AdcError::Success;
+  }
+
+  /**
+   * @brief Return the voltage of the next precomputed count
+   * @param channel ADC channel (ignored)
+   * @param voltage_v Pointer to store the voltage (V)
+   * @return AdcError::Success
+   */
+  ntc::AdcError ReadChannelV(uint8_t channel, float *voltage_v) {
+    uint32_t count = 0;
+    (void)ReadChannelCount(channel, &count);
+    *voltage_v = static_cast<float>(count) * reference_voltage_ /
+                 static_cast<float>((1ULL << resolution_bits_) - 1ULL);
+    return ntc::AdcError::Success;
+  }
+
+  /**
+   * @brief Get reference voltage
+   * @return Reference voltage (V)
+   */
+  float GetReferenceVoltage() const { return reference_voltage_; }
+
+  /**
+   * @brief Get ADC resolution
+   * @return Resolution (bits)
+   */
+  uint8_t GetResolutionBits() const { return resolution_bits_; }
+
+  /**
+   * @brief Get one of the precomputed counts
+   * @param index Pattern index (0 to COUNT_PATTERN_SIZE_ - 1)
+   * @return Raw ADC count
+   */
+  [[nodiscard]] uint32_t PatternCount(size_t index) const {
+    return counts_[index % COUNT_PATTERN_SIZE_];
+  }
+
+private:
+  float reference_voltage_;                           ///< Reference voltage
+  uint8_t resolution_bits_;                           ///< Resolution (bits)
+  size_t next_;                                       ///< Next pattern index
+  std::array<uint32_t, COUNT_PATTERN_SIZE_> counts_; ///< Count pattern
+};
+
+#endif // NTC_ZERO_LATENCY_ADC_H
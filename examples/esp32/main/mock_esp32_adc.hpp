@@ -14,7 +14,10 @@
 
 #include "ntc_adc_interface.hpp"
 
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 
 /**
  * @brief Mock ADC implementation for testing
@@ -96,6 +99,15 @@ public:
     *count = max_count_ / 2 +
              (channel * 100); // Add some channel-dependent variation
 
+    // Each conversion takes conversion_time_us_ of simulated time
+    clock_us_ += conversion_time_us_;
+
+    // Simulate a conversion glitch every spike_period_ conversions
+    conversions_++;
+    if (spike_period_ != 0U && (conversions_ % spike_period_) == 0U) {
+      *count = max_count_;
+    }
+
     return ntc::AdcError::Success;
   }
 
@@ -157,6 +169,29 @@ public:
     }
   }
 
+  /**
+   * @brief Make every Nth conversion return full scale (simulated glitch)
+   * @param period Conversions between glitches (0 = no glitches)
+   */
+  void SetSpikePeriod(uint32_t period) {
+    spike_period_ = period;
+    conversions_ = 0U;
+  }
+
+  /**
+   * @brief Set the simulated time each conversion takes
+   * @param conversion_time_us Time per conversion (µs, 0 freezes the clock)
+   */
+  void SetConversionTimeUs(uint32_t conversion_time_us) {
+    conversion_time_us_ = conversion_time_us;
+  }
+
+  /**
+   * @brief Read the simulated acquisition clock
+   * @return Simulated time (µs)
+   */
+  uint64_t ReadTimestampUs() const { return clock_us_; }
+
   /**
    * @brief Initialize the mock ADC
    * @return true on success
@@ -172,4 +207,230 @@ private:
   uint8_t resolution_bits_;
   uint32_t max_count_;
   float simulated_voltage_ = 1.65F; // Default mid-scale voltage
+  uint32_t spike_period_ = 0U;      // Conversions between glitches
+  uint32_t conversions_ = 0U;       // Conversions since SetSpikePeriod()
+  uint32_t conversion_time_us_ = 0U; // Simulated time per conversion
+  uint64_t clock_us_ = 0U;           // Simulated clock
+};
+
+/**
+ * @brief Mock ADC returning a scripted sequence of counts
+ *
+ * Conversion n returns counts[n % count] + channel * channel_step, so tests
+ * know every count the driver sees. Conversions can be made to fail, and
+ * each ReadChannelCount() call is counted. Uses the CRTP pattern with
+ * ntc::AdcInterface.
+ */
+class MockScriptedAdc : public ntc::AdcInterface<MockScriptedAdc> {
+public:
+  static constexpr size_t MAX_SCRIPT_COUNTS = 8U; ///< Longest count script
+
+  /**
+   * @brief Constructor
+   * @param reference_voltage Reference voltage in volts
+   * @param resolution_bits ADC resolution in bits
+   */
+  explicit MockScriptedAdc(float reference_voltage = 3.3F,
+                           uint8_t resolution_bits = 12)
+      : reference_voltage_(reference_voltage),
+        resolution_bits_(resolution_bits) {}
+
+  bool IsInitialized() const { return true; }
+  bool EnsureInitialized() { return true; }
+  bool IsChannelAvailable(uint8_t channel) const { return channel <= 6; }
+
+  /**
+   * @brief Read the next scripted count
+   * @param channel ADC channel to read
+   * @param count Output parameter for count value
+   * @return AdcError::Success, or ReadFailed for a failing conversion
+   */
+  ntc::AdcError ReadChannelCount(uint8_t channel, uint32_t *count) {
+    single_reads_++;
+    return nextCount(channel, count);
+  }
+
+  ntc::AdcError ReadChannelV(uint8_t channel, float *voltage_v) {
+    uint32_t count = 0;
+    ntc::AdcError err = ReadChannelCount(channel, &count);
+    if (err == ntc::AdcError::Success) {
+      *voltage_v = static_cast<float>(count) * reference_voltage_ /
+                   static_cast<float>((1U << resolution_bits_) - 1U);
+    }
+    return err;
+  }
+
+  float GetReferenceVoltage() const { return reference_voltage_; }
+  uint8_t GetResolutionBits() const { return resolution_bits_; }
+
+  /**
+   * @brief Set the count script and restart it
+   * @param counts Counts returned in turn (at most MAX_SCRIPT_COUNTS)
+   * @param channel_step Count added per channel number
+   */
+  template <size_t N>
+  void SetCounts(const uint32_t (&counts)[N], uint32_t channel_step = 0U) {
+    static_assert(N > 0U && N <= MAX_SCRIPT_COUNTS, "Script too long");
+    for (size_t i = 0; i < N; ++i) {
+      script_[i] = counts[i];
+    }
+    script_length_ = N;
+    channel_step_ = channel_step;
+    ResetCounters();
+  }
+
+  /**
+   * @brief Make conversions [first, first + count) fail
+   * @param first Index of the first failing conversion
+   * @param count Number of failing conversions (0 = none)
+   */
+  void FailConversions(uint32_t first, uint32_t count) {
+    fail_first_ = first;
+    fail_count_ = count;
+  }
+
+  /**
+   * @brief Restart the script and clear the call counters
+   */
+  void ResetCounters() {
+    conversions_ = 0U;
+    single_reads_ = 0U;
+  }
+
+  /// Conversions performed (all read paths)
+  uint32_t Conversions() const { return conversions_; }
+
+  /// ReadChannelCount() calls
+  uint32_t SingleReads() const { return single_reads_; }
+
+protected:
+  /**
+   * @brief Perform one scripted conversion
+   * @param channel ADC channel
+   * @param count Output parameter for count value
+   * @return AdcError::Success, or ReadFailed for a failing conversion
+   */
+  ntc::AdcError nextCount(uint8_t channel, uint32_t *count) {
+    const uint32_t index = conversions_++;
+    if (index >= fail_first_ && index - fail_first_ < fail_count_) {
+      return ntc::AdcError::ReadFailed;
+    }
+    *count = script_[index % script_length_] + (channel * channel_step_);
+    return ntc::AdcError::Success;
+  }
+
+private:
+  float reference_voltage_;
+  uint8_t resolution_bits_;
+  std::array<uint32_t, MAX_SCRIPT_COUNTS> script_ = {2048U};
+  size_t script_length_ = 1U;
+  uint32_t channel_step_ = 0U;
+  uint32_t fail_first_ = 0U;
+  uint32_t fail_count_ = 0U;
+  uint32_t conversions_ = 0U;  // Conversions since the last reset
+  uint32_t single_reads_ = 0U; // ReadChannelCount() calls since the last reset
+};
+
+/**
+ * @brief Scripted mock ADC with burst and multi-channel scan hooks
+ *
+ * Adds the optional ReadChannelBurst() and ReadChannelsCount() hooks to
+ * MockScriptedAdc. Both consume the same count script, and each call is
+ * counted so tests can check which read path the driver took.
+ */
+class MockBurstAdc : public MockScriptedAdc {
+public:
+  using MockScriptedAdc::MockScriptedAdc;
+
+  /**
+   * @brief Read several counts from one channel in one transfer
+   *
+   * Performs every requested conversion; the burst fails as a whole if
+   * any of its conversions fails.
+   *
+   * @param channel ADC channel to read
+   * @param counts Array to store the counts
+   * @param count Number of conversions
+   * @return AdcError::Success, or ReadFailed for a failing conversion
+   */
+  ntc::AdcError ReadChannelBurst(uint8_t channel, uint32_t *counts,
+                                 size_t count) {
+    burst_calls_++;
+    ntc::AdcError result = ntc::AdcError::Success;
+    for (size_t i = 0; i < count; ++i) {
+      if (nextCount(channel, &counts[i]) != ntc::AdcError::Success) {
+        result = ntc::AdcError::ReadFailed;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Read several channels in one scan
+   * @param channels Array of ADC channels to read
+   * @param counts Array to store the count of each channel
+   * @param channel_count Number of channels
+   * @return AdcError::Success, or ReadFailed for a failing conversion
+   */
+  ntc::AdcError ReadChannelsCount(const uint8_t *channels, uint32_t *counts,
+                                  size_t channel_count) {
+    scan_calls_++;
+    ntc::AdcError result = ntc::AdcError::Success;
+    for (size_t i = 0; i < channel_count; ++i) {
+      if (nextCount(channels[i], &counts[i]) != ntc::AdcError::Success) {
+        result = ntc::AdcError::ReadFailed;
+      }
+    }
+    return result;
+  }
+
+  /// ReadChannelBurst() calls since the last SetCounts()
+  uint32_t BurstCalls() const { return burst_calls_; }
+
+  /// ReadChannelsCount() calls since the last SetCounts()
+  uint32_t ScanCalls() const { return scan_calls_; }
+
+  /**
+   * @brief Set the count script and restart it
+   * @param counts Counts returned in turn (at most MAX_SCRIPT_COUNTS)
+   * @param channel_step Count added per channel number
+   */
+  template <size_t N>
+  void SetCounts(const uint32_t (&counts)[N], uint32_t channel_step = 0U) {
+    MockScriptedAdc::SetCounts(counts, channel_step);
+    burst_calls_ = 0U;
+    scan_calls_ = 0U;
+  }
+
+private:
+  uint32_t burst_calls_ = 0U; // ReadChannelBurst() calls
+  uint32_t scan_calls_ = 0U;  // ReadChannelsCount() calls
+};
+
+/**
+ * @brief Scripted mock ADC with a cycle counter
+ *
+ * The ReadCycleCounter() hook advances by a fixed number of cycles per
+ * conversion, so the acquisition stage of a read costs exactly
+ * conversions * cycles_per_conversion cycles however it is split up.
+ */
+class MockCycleCounterAdc : public MockScriptedAdc {
+public:
+  /**
+   * @brief Constructor
+   * @param cycles_per_conversion Cycles the counter advances per conversion
+   */
+  explicit MockCycleCounterAdc(uint32_t cycles_per_conversion)
+      : cycles_per_conversion_(cycles_per_conversion) {}
+
+  /**
+   * @brief Read the simulated cycle counter
+   * @return Cycles elapsed in conversions
+   */
+  uint32_t ReadCycleCounter() const {
+    return Conversions() * cycles_per_conversion_;
+  }
+
+private:
+  uint32_t cycles_per_conversion_;
 };
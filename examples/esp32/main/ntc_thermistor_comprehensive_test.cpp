@@ -10,10 +10,19 @@
  */
 
 #include "mock_esp32_adc.hpp"
+#include "ntc_conversion.hpp"
+#include "ntc_packed.hpp"
+#include "ntc_adaptive_sampler.hpp"
+#include "ntc_scan_scheduler.hpp"
+#include "ntc_table_generator.hpp"
 #include "ntc_thermistor.hpp"
+#include "ntc_thermistor_array.hpp"
+#include "ntc_thermistor_q.hpp"
+#include "ntc_thermistor_static.hpp"
 #include "TestFramework.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include <cmath>
 #include <memory>
 
 #ifdef __cplusplus
@@ -31,6 +40,25 @@ static TestResults g_test_results;
 // TEST CONFIGURATION
 //=============================================================================
 static constexpr bool ENABLE_BASIC_TESTS = true;
+static constexpr bool ENABLE_FAST_LOG_TESTS = true;
+static constexpr bool ENABLE_BATCH_CONVERSION_TESTS = true;
+static constexpr bool ENABLE_FIXED_POINT_TESTS = true;
+static constexpr bool ENABLE_STATIC_DRIVER_TESTS = true;
+static constexpr bool ENABLE_CONVERSION_METHOD_TESTS = true;
+static constexpr bool ENABLE_STATS_TESTS = true;
+static constexpr bool ENABLE_LOOKUP_TABLE_TESTS = true;
+static constexpr bool ENABLE_HISTORY_TESTS = true;
+static constexpr bool ENABLE_SAMPLING_TESTS = true;
+static constexpr bool ENABLE_BURST_TESTS = true;
+static constexpr bool ENABLE_ARRAY_TESTS = true;
+static constexpr bool ENABLE_SNAPSHOT_TESTS = true;
+static constexpr bool ENABLE_CHANGE_DETECTION_TESTS = true;
+static constexpr bool ENABLE_PACKED_FORMAT_TESTS = true;
+static constexpr bool ENABLE_TIMESTAMP_TESTS = true;
+static constexpr bool ENABLE_FILTER_MODE_TESTS = true;
+static constexpr bool ENABLE_ADAPTIVE_SAMPLING_TESTS = true;
+static constexpr bool ENABLE_SCAN_SCHEDULER_TESTS = true;
+static constexpr bool ENABLE_WARM_START_TESTS = true;
 
 //=============================================================================
 // SHARED TEST RESOURCES
@@ -60,6 +88,7 @@ static bool init_test_resources() noexcept {
   config.resistance_at_25c = 10000.0F;
   config.beta_value = 3950.0F;
   config.reference_voltage = 3.3F;
+  config.adc_resolution_bits = 12;
   config.type = NtcType::Custom;
   config.conversion_method = NtcConversionMethod::Auto;
   config.sample_count = 1;
@@ -100,6 +129,2318 @@ static bool test_basic_initialization() noexcept {
   return true; // Test passed
 }
 
+/**
+ * @brief One ADC acquisition per reading
+ *
+ * A 16-sample ReadTemperature() must cost exactly 16 conversions, and its
+ * voltage, resistance and temperature must all derive from the one averaged
+ * count (2015 for the scripted counts).
+ */
+static bool test_single_acquisition_reading() noexcept {
+  constexpr uint32_t kCounts[] = {2000U, 2010U, 2020U, 2030U};
+  constexpr uint32_t kSamples = 16U;
+  constexpr uint32_t kMeanCount = 2015U;
+  constexpr float kMaxDifferenceCelsius = 0.001F;
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+  config.conversion_method = NtcConversionMethod::Mathematical;
+  config.sample_count = kSamples;
+
+  MockScriptedAdc adc(3.3F, 12);
+  NtcThermistor<MockScriptedAdc> driver(config, &adc);
+  if (!driver.Initialize()) {
+    return false;
+  }
+
+  ntc_reading_t reading = {};
+  adc.SetCounts(kCounts);
+  if (driver.ReadTemperature(&reading) != NtcError::Success) {
+    return false;
+  }
+
+  const float expected_voltage =
+      static_cast<float>(kMeanCount) * 3.3F / 4095.0F;
+  float expected_resistance = 0.0F;
+  float expected_celsius = 0.0F;
+  const bool derived =
+      NTC::CalculateThermistorResistance(reading.voltage_volts, 3.3F,
+                                         config.series_resistance,
+                                         &expected_resistance) &&
+      NTC::ConvertResistanceToTemperatureBeta(
+          reading.resistance_ohms, config.resistance_at_25c,
+          config.beta_value, &expected_celsius);
+
+  ESP_LOGI(TAG,
+           "Reading: %u conversions (%u ADC calls), count %u, %.4f V, "
+           "%.1f ohms, %.3f°C",
+           static_cast<unsigned>(reading.adc_conversions),
+           static_cast<unsigned>(adc.SingleReads()),
+           static_cast<unsigned>(reading.adc_raw_value),
+           static_cast<double>(reading.voltage_volts),
+           static_cast<double>(reading.resistance_ohms),
+           static_cast<double>(reading.temperature_celsius));
+  return derived && reading.is_valid && adc.Conversions() == kSamples &&
+         adc.SingleReads() == kSamples &&
+         reading.adc_conversions == kSamples &&
+         driver.GetLastAdcConversionCount() == kSamples &&
+         reading.adc_raw_value == kMeanCount &&
+         std::fabs(reading.voltage_volts - expected_voltage) < 1.0e-6F &&
+         reading.resistance_ohms == expected_resistance &&
+         std::fabs(reading.temperature_celsius - expected_celsius) <
+             kMaxDifferenceCelsius;
+}
+
+/**
+ * @brief Fast log accuracy and speed over -40..125°C
+ *
+ * Compares ConvertResistanceToTemperatureBetaFast() against the exact beta
+ * conversion and reports the worst-case error and time per conversion.
+ */
+static bool test_fast_log_accuracy_and_speed() noexcept {
+  constexpr float kResistanceAt25c = 10000.0F;
+  constexpr float kBetaValue = 3950.0F;
+  constexpr float kMinTemperature = -40.0F;
+  constexpr float kTemperatureStep = 0.5F;
+  constexpr size_t kPointCount = 331; // -40..125°C in 0.5°C steps
+  constexpr uint32_t kTimingPasses = 20;
+  constexpr float kMaxAllowedError = 0.05F;
+
+  static float resistances[kPointCount];
+  for (size_t i = 0; i < kPointCount; ++i) {
+    const float temperature =
+        kMinTemperature + (kTemperatureStep * static_cast<float>(i));
+    if (!NTC::ConvertTemperatureToResistanceBeta(
+            temperature, kResistanceAt25c, kBetaValue, &resistances[i])) {
+      ESP_LOGE(TAG, "Resistance conversion failed at %.2f°C", temperature);
+      return false;
+    }
+  }
+
+  // Accuracy
+  float max_error = 0.0F;
+  for (size_t i = 0; i < kPointCount; ++i) {
+    float exact = 0.0F;
+    float fast = 0.0F;
+    if (!NTC::ConvertResistanceToTemperatureBeta(
+            resistances[i], kResistanceAt25c, kBetaValue, &exact) ||
+        !NTC::ConvertResistanceToTemperatureBetaFast(
+            resistances[i], kResistanceAt25c, kBetaValue, &fast)) {
+      ESP_LOGE(TAG, "Temperature conversion failed at point %u",
+               static_cast<unsigned>(i));
+      return false;
+    }
+    max_error = std::fmax(max_error, std::fabs(fast - exact));
+  }
+
+  // Speed
+  volatile float sink = 0.0F;
+  const int64_t exact_start = esp_timer_get_time();
+  for (uint32_t pass = 0; pass < kTimingPasses; ++pass) {
+    for (size_t i = 0; i < kPointCount; ++i) {
+      float temperature = 0.0F;
+      NTC::ConvertResistanceToTemperatureBeta(
+          resistances[i], kResistanceAt25c, kBetaValue, &temperature);
+      sink = temperature;
+    }
+  }
+  const int64_t fast_start = esp_timer_get_time();
+  for (uint32_t pass = 0; pass < kTimingPasses; ++pass) {
+    for (size_t i = 0; i < kPointCount; ++i) {
+      float temperature = 0.0F;
+      NTC::ConvertResistanceToTemperatureBetaFast(
+          resistances[i], kResistanceAt25c, kBetaValue, &temperature);
+      sink = temperature;
+    }
+  }
+  const int64_t fast_end = esp_timer_get_time();
+  (void)sink;
+
+  const double conversions =
+      static_cast<double>(kTimingPasses) * static_cast<double>(kPointCount);
+  ESP_LOGI(TAG, "Fast log: max error %.4f°C over -40..125°C", max_error);
+  ESP_LOGI(TAG, "Exact: %.3f us/conversion, fast: %.3f us/conversion",
+           static_cast<double>(fast_start - exact_start) / conversions,
+           static_cast<double>(fast_end - fast_start) / conversions);
+
+  return max_error < kMaxAllowedError;
+}
+
+/**
+ * @brief Batch conversion masks and in-place conversion
+ *
+ * Out-of-range elements on both sides of a mask byte boundary must set
+ * exactly their bits, in-range elements must match the scalar conversion,
+ * converting in place must give the out-of-place result, and invalid
+ * parameters must flag every element (and nothing past the last one).
+ */
+static bool test_batch_conversion_masks() noexcept {
+  constexpr size_t kCount = 11U;
+  constexpr float kMaxDifferenceCelsius = 0.001F;
+  constexpr float kR25 = 10000.0F;
+  constexpr float kBeta = 3950.0F;
+
+  // Elements 0, 7, 8 and 10 are out of range (NaN included)
+  const float resistances[kCount] = {
+      0.0F,   2000.0F, 5000.0F, 10000.0F,  20000.0F, 50000.0F,
+      1.0e5F, NAN,     2.0e6F,  300000.0F, -5.0F};
+  constexpr uint8_t kExpectedMask[2] = {0x81U, 0x05U};
+
+  float temperatures[kCount] = {};
+  uint8_t mask[2] = {};
+  bool passed = !NTC::ConvertResistanceToTemperatureBeta(
+                    resistances, temperatures, kCount, kR25, kBeta, mask) &&
+                mask[0] == kExpectedMask[0] && mask[1] == kExpectedMask[1];
+
+  for (size_t i = 0; passed && i < kCount; ++i) {
+    if ((mask[i / 8U] & (1U << (i % 8U))) != 0U) {
+      continue;
+    }
+    float expected = 0.0F;
+    passed = NTC::ConvertResistanceToTemperatureBeta(resistances[i], kR25,
+                                                     kBeta, &expected) &&
+             std::fabs(temperatures[i] - expected) < kMaxDifferenceCelsius;
+  }
+
+  // In place: the mask is built before the input is overwritten
+  float in_place[kCount] = {};
+  uint8_t in_place_mask[2] = {};
+  for (size_t i = 0; i < kCount; ++i) {
+    in_place[i] = resistances[i];
+  }
+  (void)NTC::ConvertResistanceToTemperatureBeta(in_place, in_place, kCount,
+                                                kR25, kBeta, in_place_mask);
+  passed = passed && in_place_mask[0] == mask[0] &&
+           in_place_mask[1] == mask[1];
+  for (size_t i = 0; passed && i < kCount; ++i) {
+    passed = in_place[i] == temperatures[i] ||
+             (std::isnan(in_place[i]) && std::isnan(temperatures[i]));
+  }
+
+  // Steinhart-Hart batch with the same rules
+  float sh_temperatures[kCount] = {};
+  uint8_t sh_mask[2] = {};
+  for (size_t i = 0; i < kCount; ++i) {
+    in_place[i] = resistances[i];
+  }
+  passed = passed &&
+           !NTC::ConvertResistanceToTemperatureSteinhartHart(
+               resistances, sh_temperatures, kCount,
+               NTC::Constants::STEINHART_HART_A_,
+               NTC::Constants::STEINHART_HART_B_,
+               NTC::Constants::STEINHART_HART_C_, sh_mask) &&
+           !NTC::ConvertResistanceToTemperatureSteinhartHart(
+               in_place, in_place, kCount, NTC::Constants::STEINHART_HART_A_,
+               NTC::Constants::STEINHART_HART_B_,
+               NTC::Constants::STEINHART_HART_C_, in_place_mask) &&
+           sh_mask[0] == kExpectedMask[0] && sh_mask[1] == kExpectedMask[1] &&
+           in_place_mask[0] == sh_mask[0] && in_place_mask[1] == sh_mask[1] &&
+           in_place[3] == sh_temperatures[3];
+
+  // Counts: the rails (open or shorted sensor) are flagged
+  const uint32_t counts[5] = {0U, 1000U, 2048U, 4095U, 3000U};
+  float count_temperatures[5] = {};
+  uint8_t count_mask[1] = {};
+  passed = passed &&
+           !NTC::ConvertAdcCountsToTemperatureBeta(counts, count_temperatures,
+                                                   5U, 12U, 10000.0F, kR25,
+                                                   kBeta, count_mask) &&
+           count_mask[0] == 0x09U;
+  for (size_t i = 0; passed && i < 5U; ++i) {
+    if ((count_mask[0] & (1U << i)) != 0U) {
+      continue;
+    }
+    const auto count = static_cast<float>(counts[i]);
+    float expected = 0.0F;
+    passed = NTC::ConvertResistanceToTemperatureBeta(
+                 10000.0F * count / (4095.0F - count), kR25, kBeta,
+                 &expected) &&
+             std::fabs(count_temperatures[i] - expected) <
+                 kMaxDifferenceCelsius;
+  }
+
+  // Invalid parameters flag exactly the kCount elements
+  uint8_t invalid_mask[2] = {};
+  passed = passed &&
+           !NTC::ConvertResistanceToTemperatureBeta(resistances, temperatures,
+                                                    kCount, kR25, 0.0F,
+                                                    invalid_mask) &&
+           invalid_mask[0] == 0xFFU && invalid_mask[1] == 0x07U;
+
+  ESP_LOGI(TAG, "Batch masks: beta %02X %02X, counts %02X, invalid %02X %02X",
+           static_cast<unsigned>(mask[0]), static_cast<unsigned>(mask[1]),
+           static_cast<unsigned>(count_mask[0]),
+           static_cast<unsigned>(invalid_mask[0]),
+           static_cast<unsigned>(invalid_mask[1]));
+  return passed;
+}
+
+/**
+ * @brief Fixed-point driver accuracy and speed against the float driver
+ *
+ * Reads the same channel with NtcThermistorQ and the float driver, checks
+ * the worst-case table error over the configured range and reports the time
+ * per integer count conversion.
+ */
+static bool test_fixed_point_accuracy_and_speed() noexcept {
+  constexpr uint32_t kMaxAllowedErrorCenti = 10; // 0.1°C
+  constexpr float kMaxAllowedReadDifference = 0.1F;
+  constexpr uint32_t kTimingPasses = 4;
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+
+  NtcThermistorQ<MockEsp32Adc> fixed_driver(config, g_mock_adc.get());
+  if (!fixed_driver.Initialize()) {
+    ESP_LOGE(TAG, "Failed to initialize fixed-point driver");
+    return false;
+  }
+
+  // Accuracy over the whole table
+  uint32_t max_error_centi = 0;
+  if (fixed_driver.MeasureConversionError(&max_error_centi) !=
+      NtcError::Success) {
+    ESP_LOGE(TAG, "Fixed-point error measurement failed");
+    return false;
+  }
+
+  // Same sample through both drivers
+  float float_celsius = 0.0F;
+  int32_t fixed_centi_celsius = 0;
+  if (g_ntc_driver->ReadTemperatureCelsius(&float_celsius) !=
+          NtcError::Success ||
+      fixed_driver.ReadTemperatureCentiCelsius(&fixed_centi_celsius) !=
+          NtcError::Success) {
+    ESP_LOGE(TAG, "Temperature read failed");
+    return false;
+  }
+  const float read_difference =
+      std::fabs((static_cast<float>(fixed_centi_celsius) * 0.01F) -
+                float_celsius);
+
+  // Speed of the integer conversion over every ADC count
+  const uint64_t count_limit = 1ULL << config.adc_resolution_bits;
+  volatile int32_t sink = 0;
+  const int64_t start = esp_timer_get_time();
+  for (uint32_t pass = 0; pass < kTimingPasses; ++pass) {
+    for (uint64_t count = 0; count < count_limit; ++count) {
+      int32_t centi_celsius = 0;
+      (void)fixed_driver.ConvertCountToCentiCelsius(
+          count << NtcThermistorQ<MockEsp32Adc>::COUNT_FRACTION_BITS_,
+          &centi_celsius);
+      sink = centi_celsius;
+    }
+  }
+  const int64_t end = esp_timer_get_time();
+  (void)sink;
+
+  ESP_LOGI(TAG, "Fixed point: max error %.2f°C, read %.2f°C vs %.2f°C",
+           static_cast<double>(max_error_centi) * 0.01,
+           static_cast<double>(fixed_centi_celsius) * 0.01,
+           static_cast<double>(float_celsius));
+  ESP_LOGI(TAG, "Fixed point: %.3f us/conversion",
+           static_cast<double>(end - start) /
+               (static_cast<double>(kTimingPasses) *
+                static_cast<double>(count_limit)));
+
+  return max_error_centi <= kMaxAllowedErrorCenti &&
+         read_difference < kMaxAllowedReadDifference;
+}
+
+/**
+ * @brief Build-time configuration matching the test driver's sensor
+ */
+template <NtcConversionMethod Method> struct StaticTestConfig {
+  static constexpr ntc_config_t CONFIG = [] {
+    ntc_config_t config = GetDefaultNtcConfig();
+    config.resistance_at_25c = 10000.0F;
+    config.beta_value = 3950.0F;
+    config.reference_voltage = 3.3F;
+    config.series_resistance = 10000.0F;
+    config.adc_resolution_bits = 12;
+    config.conversion_method = Method;
+    return config;
+  }();
+};
+
+/**
+ * @brief Compare one StaticNtcThermistor reading with NtcThermistor
+ * @param name Conversion method name for logging
+ */
+template <NtcConversionMethod Method>
+static bool compare_static_driver(const char *name) noexcept {
+  constexpr float kMaxAllowedDifference = 0.01F;
+
+  StaticNtcThermistor<MockEsp32Adc, StaticTestConfig<Method>> static_driver(
+      g_mock_adc.get());
+  NtcThermistor<MockEsp32Adc> runtime_driver(
+      StaticTestConfig<Method>::CONFIG, g_mock_adc.get());
+  if (!static_driver.Initialize() || !runtime_driver.Initialize()) {
+    ESP_LOGE(TAG, "%s: initialization failed", name);
+    return false;
+  }
+
+  float static_celsius = 0.0F;
+  float runtime_celsius = 0.0F;
+  if (static_driver.ReadTemperatureCelsius(&static_celsius) !=
+          NtcError::Success ||
+      runtime_driver.ReadTemperatureCelsius(&runtime_celsius) !=
+          NtcError::Success) {
+    ESP_LOGE(TAG, "%s: temperature read failed", name);
+    return false;
+  }
+
+  ESP_LOGI(TAG, "%s: static %.3f°C, runtime %.3f°C", name,
+           static_cast<double>(static_celsius),
+           static_cast<double>(runtime_celsius));
+  return std::fabs(static_celsius - runtime_celsius) < kMaxAllowedDifference;
+}
+
+/**
+ * @brief Static driver readings against the runtime driver
+ *
+ * Builds StaticNtcThermistor with the test configuration for each
+ * conversion method and compares its reading with NtcThermistor.
+ */
+static bool test_static_driver_matches_runtime() noexcept {
+  return compare_static_driver<NtcConversionMethod::Mathematical>(
+             "Mathematical") &&
+         compare_static_driver<NtcConversionMethod::LookupTable>(
+             "LookupTable") &&
+         compare_static_driver<NtcConversionMethod::AdcCountTable>(
+             "AdcCountTable");
+}
+
+/**
+ * @brief Initialize a driver with the test configuration and report its method
+ * @param config Configuration to use
+ * @param name Case name for logging
+ * @param report Pointer to store the conversion report
+ * @param celsius Pointer to store one reading (°C)
+ */
+static bool read_with_config(const ntc_config_t &config, const char *name,
+                             ntc_conversion_report_t *report,
+                             float *celsius) noexcept {
+  NtcThermistor<MockEsp32Adc> driver(config, g_mock_adc.get());
+  if (!driver.Initialize() ||
+      driver.GetConversionReport(report) != NtcError::Success ||
+      driver.ReadTemperatureCelsius(celsius) != NtcError::Success) {
+    ESP_LOGE(TAG, "%s: initialization or read failed", name);
+    return false;
+  }
+
+  ESP_LOGI(TAG, "%s: method %u, max error %.4f°C, cost %u, read %.3f°C", name,
+           static_cast<unsigned>(report->method),
+           static_cast<double>(report->max_error_celsius),
+           static_cast<unsigned>(report->cost),
+           static_cast<double>(*celsius));
+  return true;
+}
+
+/**
+ * @brief Auto conversion method selection and Steinhart-Hart wiring
+ *
+ * A loose accuracy budget must select the ADC count table, a zero budget the
+ * exact Beta equation (the reference for a Custom type), and a fitted
+ * Steinhart-Hart conversion must agree with the Beta reading.
+ */
+static bool test_auto_conversion_selection() noexcept {
+  constexpr float kMaxAllowedDifference = 0.05F;
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+
+  ntc_conversion_report_t loose = {};
+  ntc_conversion_report_t exact = {};
+  ntc_conversion_report_t steinhart_hart = {};
+  float loose_celsius = 0.0F;
+  float exact_celsius = 0.0F;
+  float steinhart_hart_celsius = 0.0F;
+
+  config.conversion_method = NtcConversionMethod::Auto;
+  config.auto_max_error_celsius = 0.1F;
+  if (!read_with_config(config, "Auto 0.1°C", &loose, &loose_celsius)) {
+    return false;
+  }
+
+  config.auto_max_error_celsius = 0.0F;
+  if (!read_with_config(config, "Auto exact", &exact, &exact_celsius)) {
+    return false;
+  }
+
+  config.conversion_method = NtcConversionMethod::SteinhartHart;
+  if (!read_with_config(config, "Steinhart-Hart", &steinhart_hart,
+                        &steinhart_hart_celsius)) {
+    return false;
+  }
+
+  return loose.method == NtcConversionMethod::AdcCountTable &&
+         loose.max_error_celsius <= 0.1F &&
+         exact.method == NtcConversionMethod::Mathematical &&
+         steinhart_hart.method == NtcConversionMethod::SteinhartHart &&
+         loose.cost < exact.cost &&
+         std::fabs(loose_celsius - exact_celsius) < kMaxAllowedDifference &&
+         std::fabs(steinhart_hart_celsius - exact_celsius) <
+             kMaxAllowedDifference;
+}
+
+/**
+ * @brief ADC count table on fractional averaged counts
+ *
+ * Four samples averaging 2000.75 counts (Mean, and Decimate with 16
+ * samples) must convert through the ADC count table to within 0.01°C of the
+ * Mathematical result: the table interpolates on the fixed-point mean, not
+ * the truncated whole count, which would read about 0.02°C warm.
+ */
+static bool test_count_table_fractional_counts() noexcept {
+  constexpr uint32_t kCounts[] = {2000U, 2001U, 2001U, 2001U};
+  constexpr float kMaxDifferenceCelsius = 0.01F;
+
+  MockScriptedAdc adc(3.3F, 12);
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+
+  bool passed = true;
+  const NtcSamplingStrategy strategies[] = {NtcSamplingStrategy::Mean,
+                                            NtcSamplingStrategy::Decimate};
+  for (const NtcSamplingStrategy strategy : strategies) {
+    config.sampling_strategy = strategy;
+    config.sample_count =
+        (strategy == NtcSamplingStrategy::Decimate) ? 16U : 4U;
+
+    config.conversion_method = NtcConversionMethod::AdcCountTable;
+    NtcThermistor<MockScriptedAdc> table_driver(config, &adc);
+    config.conversion_method = NtcConversionMethod::Mathematical;
+    NtcThermistor<MockScriptedAdc> math_driver(config, &adc);
+
+    ntc_conversion_report_t report = {};
+    float table_celsius = 0.0F;
+    float math_celsius = 0.0F;
+    adc.SetCounts(kCounts);
+    passed = passed && table_driver.Initialize() && math_driver.Initialize() &&
+             table_driver.GetConversionReport(&report) == NtcError::Success &&
+             report.method == NtcConversionMethod::AdcCountTable &&
+             table_driver.ReadTemperatureCelsius(&table_celsius) ==
+                 NtcError::Success;
+    adc.SetCounts(kCounts);
+    passed = passed &&
+             math_driver.ReadTemperatureCelsius(&math_celsius) ==
+                 NtcError::Success &&
+             std::fabs(table_celsius - math_celsius) <
+                 kMaxDifferenceCelsius;
+
+    ESP_LOGI(TAG,
+             "Mean count 2000.75 (strategy %u): table %.4f°C, math %.4f°C, "
+             "reported table error %.4f°C",
+             static_cast<unsigned>(strategy),
+             static_cast<double>(table_celsius),
+             static_cast<double>(math_celsius),
+             static_cast<double>(report.max_error_celsius));
+  }
+
+  return passed;
+}
+
+/**
+ * @brief Compare a reconfigured driver with a freshly built one
+ * @param driver Driver after one or more setters
+ * @param config Configuration the setters should have produced
+ * @param adc Scripted ADC shared by both drivers
+ * @param step Name of the last setter, for the log
+ * @return true if both report the same method, error, cost and reading
+ */
+static bool matches_fresh_driver(NtcThermistor<MockScriptedAdc> &driver,
+                                 const ntc_config_t &config,
+                                 MockScriptedAdc *adc,
+                                 const char *step) noexcept {
+  constexpr uint32_t kCounts[] = {2000U};
+
+  NtcThermistor<MockScriptedAdc> fresh(config, adc);
+  ntc_conversion_report_t report = {};
+  ntc_conversion_report_t fresh_report = {};
+  float celsius = 0.0F;
+  float fresh_celsius = 0.0F;
+  if (!fresh.Initialize() ||
+      driver.GetConversionReport(&report) != NtcError::Success ||
+      fresh.GetConversionReport(&fresh_report) != NtcError::Success) {
+    ESP_LOGE(TAG, "%s: initialization or report failed", step);
+    return false;
+  }
+
+  adc->SetCounts(kCounts);
+  const bool read = driver.ReadTemperatureCelsius(&celsius) ==
+                    NtcError::Success;
+  adc->SetCounts(kCounts);
+  const bool fresh_read = fresh.ReadTemperatureCelsius(&fresh_celsius) ==
+                          NtcError::Success;
+
+  ESP_LOGI(TAG, "%s: method %u/%u, read %.4f°C/%.4f°C", step,
+           static_cast<unsigned>(report.method),
+           static_cast<unsigned>(fresh_report.method),
+           static_cast<double>(celsius), static_cast<double>(fresh_celsius));
+  return read && fresh_read && celsius == fresh_celsius &&
+         report.method == fresh_report.method &&
+         report.max_error_celsius == fresh_report.max_error_celsius &&
+         report.cost == fresh_report.cost &&
+         driver.GetActiveConversionMethod() == report.method;
+}
+
+/**
+ * @brief Count table and Auto re-resolution after each setter
+ *
+ * After every setter that changes the conversion (see configuration.md),
+ * an AdcCountTable driver and an Auto driver must report and read exactly
+ * what a driver built with the resulting configuration does. A stale count
+ * table or Auto choice reads the old parameters. Tightening the Auto
+ * accuracy budget through SetConfiguration() must move Auto off the count
+ * table.
+ */
+static bool test_setter_re_resolution() noexcept {
+  constexpr float kSteinhartHartA = 1.125308852e-3F;
+  constexpr float kSteinhartHartB = 2.347125706e-4F;
+  constexpr float kSteinhartHartC = 8.566365284e-8F;
+
+  MockScriptedAdc adc(3.3F, 12);
+  ntc_config_t base = {};
+  if (g_ntc_driver->GetConfiguration(&base) != NtcError::Success) {
+    return false;
+  }
+  base.enable_filtering = false;
+  base.auto_max_error_celsius = 0.1F;
+  base.auto_max_cost = 0U;
+
+  bool passed = true;
+  const NtcConversionMethod methods[] = {NtcConversionMethod::AdcCountTable,
+                                         NtcConversionMethod::Auto};
+  for (const NtcConversionMethod method : methods) {
+    ntc_config_t config = base;
+    config.conversion_method = method;
+    NtcThermistor<MockScriptedAdc> driver(config, &adc);
+    const auto check = [&](const char *step) noexcept {
+      return matches_fresh_driver(driver, config, &adc, step);
+    };
+
+    ntc_conversion_report_t initial = {};
+    passed = passed && driver.Initialize() &&
+             driver.GetConversionReport(&initial) == NtcError::Success &&
+             initial.method == NtcConversionMethod::AdcCountTable &&
+             check("Initialize");
+
+    config.series_resistance = 22000.0F;
+    passed = passed && driver.SetVoltageDivider(22000.0F) ==
+                           NtcError::Success &&
+             check("SetVoltageDivider");
+
+    config.reference_voltage = 5.0F;
+    passed = passed && driver.SetReferenceVoltage(5.0F) ==
+                           NtcError::Success &&
+             check("SetReferenceVoltage");
+
+    config.beta_value = 3435.0F;
+    passed = passed &&
+             driver.SetBetaValue(3435.0F) == NtcError::Success &&
+             check("SetBetaValue");
+
+    config.steinhart_hart_a = kSteinhartHartA;
+    config.steinhart_hart_b = kSteinhartHartB;
+    config.steinhart_hart_c = kSteinhartHartC;
+    passed = passed &&
+             driver.SetSteinhartHartCoefficients(
+                 kSteinhartHartA, kSteinhartHartB, kSteinhartHartC) ==
+                 NtcError::Success &&
+             check("SetSteinhartHartCoefficients");
+
+    config.conversion_method = NtcConversionMethod::Mathematical;
+    passed = passed &&
+             driver.SetConversionMethod(config.conversion_method) ==
+                 NtcError::Success &&
+             check("SetConversionMethod (Mathematical)");
+
+    config.conversion_method = method;
+    passed = passed &&
+             driver.SetConversionMethod(method) == NtcError::Success &&
+             check("SetConversionMethod (back)");
+
+    config.conversion_method = NtcConversionMethod::Auto;
+    config.auto_max_error_celsius = 0.0F;
+    passed = passed &&
+             driver.SetConfiguration(config) == NtcError::Success &&
+             check("SetConfiguration (exact Auto)") &&
+             driver.GetActiveConversionMethod() !=
+                 NtcConversionMethod::AdcCountTable;
+  }
+
+  return passed;
+}
+
+/**
+ * @brief Statistics block counters
+ *
+ * Reads through an oversampling AdcCountTable driver and checks the ADC
+ * conversion and conversion path counters. Without NTC_ENABLE_STATS the
+ * driver must report the block as unsupported.
+ */
+static bool test_stats_counters() noexcept {
+  constexpr uint32_t kReads = 8;
+  constexpr uint32_t kSampleCount = 4;
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+  config.conversion_method = NtcConversionMethod::AdcCountTable;
+  config.sample_count = kSampleCount;
+
+  NtcThermistor<MockEsp32Adc> driver(config, g_mock_adc.get());
+  if (!driver.Initialize()) {
+    ESP_LOGE(TAG, "Failed to initialize stats driver");
+    return false;
+  }
+
+  ntc_stats_t stats = {};
+  if (!NtcThermistor<MockEsp32Adc>::STATS_ENABLED_) {
+    return driver.GetStats(&stats) == NtcError::UnsupportedOperation;
+  }
+
+  for (uint32_t i = 0; i < kReads; ++i) {
+    float celsius = 0.0F;
+    if (driver.ReadTemperatureCelsius(&celsius) != NtcError::Success) {
+      ESP_LOGE(TAG, "Temperature read failed");
+      return false;
+    }
+  }
+
+  if (driver.GetStats(&stats) != NtcError::Success) {
+    return false;
+  }
+
+  ESP_LOGI(TAG,
+           "Stats: %u conversions, %u failed, %u table hits, %u fallbacks, "
+           "%u equation, %u out of range",
+           static_cast<unsigned>(stats.adc_conversions),
+           static_cast<unsigned>(stats.failed_samples),
+           static_cast<unsigned>(stats.table_hits),
+           static_cast<unsigned>(stats.table_fallbacks),
+           static_cast<unsigned>(stats.equation_conversions),
+           static_cast<unsigned>(stats.out_of_range));
+
+  const bool counted = stats.adc_conversions == kReads * kSampleCount &&
+                       stats.failed_samples == 0U &&
+                       stats.table_hits == kReads &&
+                       stats.acquisition.samples == kReads &&
+                       stats.conversion.samples == kReads;
+
+  return counted && driver.ResetStats() == NtcError::Success &&
+         driver.GetStats(&stats) == NtcError::Success &&
+         stats.adc_conversions == 0U;
+}
+
+/**
+ * @brief Statistics of asynchronous readings
+ *
+ * A paced StartConversion()/Poll() reading must count its conversions and
+ * time its acquisition stage once, over the sampling work of all its
+ * Poll() calls, exactly like a blocking read of the same samples.
+ */
+static bool test_async_stats() noexcept {
+  constexpr uint32_t kSampleCount = 4U;
+  constexpr uint32_t kCyclesPerConversion = 100U;
+  constexpr uint64_t kSampleIntervalUs = 1000U;
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+  config.sample_count = kSampleCount;
+  config.sample_delay_ms = 1U;
+
+  MockCycleCounterAdc adc(kCyclesPerConversion);
+  NtcThermistor<MockCycleCounterAdc> driver(config, &adc);
+  if (!driver.Initialize()) {
+    return false;
+  }
+
+  ntc_stats_t stats = {};
+  if (!NtcThermistor<MockCycleCounterAdc>::STATS_ENABLED_) {
+    return driver.GetStats(&stats) == NtcError::UnsupportedOperation;
+  }
+
+  ntc_reading_t reading = {};
+  bool passed = driver.ReadTemperature(&reading) == NtcError::Success &&
+                driver.GetStats(&stats) == NtcError::Success;
+  const ntc_stage_stats_t blocking = stats.acquisition;
+
+  NtcConversionStatus status = NtcConversionStatus::Idle;
+  passed = passed && driver.ResetStats() == NtcError::Success &&
+           driver.StartConversion(0U) == NtcError::Success;
+  for (uint32_t i = 0; passed && i < kSampleCount; ++i) {
+    status = driver.Poll(i * kSampleIntervalUs, &reading);
+  }
+  passed = passed && status == NtcConversionStatus::Complete &&
+           reading.is_valid && driver.GetStats(&stats) == NtcError::Success;
+
+  ESP_LOGI(TAG, "Acquisition stage: blocking %u cycles, async %u cycles "
+                "(%u samples, %u conversions)",
+           static_cast<unsigned>(blocking.total_cycles),
+           static_cast<unsigned>(stats.acquisition.total_cycles),
+           static_cast<unsigned>(stats.acquisition.samples),
+           static_cast<unsigned>(stats.adc_conversions));
+  return passed && blocking.samples == 1U &&
+         blocking.total_cycles == kSampleCount * kCyclesPerConversion &&
+         stats.acquisition.samples == 1U &&
+         stats.acquisition.total_cycles == blocking.total_cycles &&
+         stats.acquisition.max_cycles == blocking.max_cycles &&
+         stats.adc_conversions == kSampleCount &&
+         stats.failed_samples == 0U && stats.conversion.samples == 1U;
+}
+
+/**
+ * @brief O(1) keyed lookup against the binary search
+ *
+ * On a uniformly keyed table the bucket from the resistance key must be the
+ * one BinarySearchLookupTable() finds, and the interpolated temperature must
+ * match interpolating the searched entries, across the whole table
+ * including the entries themselves.
+ */
+static bool test_uniform_lookup_matches_search() noexcept {
+  constexpr float kMaxDifferenceCelsius = 0.001F;
+
+  const NTC::ValidatedLookupTable table(
+      NTC::MakeNtcLogTable<10000U, 3950U, -40, 125, 32U>());
+  if (!table.IsValid() || !(table->inverse_resistance_step > 0.0F)) {
+    return false;
+  }
+
+  bool passed = true;
+  uint32_t mismatched_buckets = 0U;
+  float max_difference = 0.0F;
+  for (float resistance = table->min_resistance;
+       passed && resistance <= table->max_resistance; resistance *= 1.003F) {
+    size_t uniform_index = 0;
+    float fraction = 0.0F;
+    size_t lower_index = 0;
+    size_t upper_index = 0;
+    float uniform_celsius = 0.0F;
+    float search_celsius = 0.0F;
+    passed = NTC::UniformIndexLookupTable(table.Get(), resistance,
+                                          &uniform_index, &fraction) &&
+             NTC::BinarySearchLookupTable(table.Get(), resistance,
+                                          &lower_index, &upper_index) &&
+             NTC::FindTemperatureFromLookupTable(table, resistance,
+                                                 &uniform_celsius) &&
+             NTC::InterpolateLookupEntries(table->entries[lower_index],
+                                           table->entries[upper_index],
+                                           resistance, &search_celsius);
+    // A resistance exactly on an entry may land on either neighbour
+    if (uniform_index != lower_index &&
+        resistance != table->entries[uniform_index].resistance_ohms) {
+      mismatched_buckets++;
+    }
+    max_difference =
+        std::fmax(max_difference, std::fabs(uniform_celsius - search_celsius));
+  }
+
+  for (size_t i = 0; passed && i < table->entry_count; ++i) {
+    float celsius = 0.0F;
+    passed = NTC::FindTemperatureFromLookupTable(
+                 table, table->entries[i].resistance_ohms, &celsius) &&
+             std::fabs(celsius - table->entries[i].temperature_celsius) <
+                 kMaxDifferenceCelsius;
+  }
+
+  ESP_LOGI(TAG, "Keyed vs searched lookup: %u bucket mismatches, max %.5f°C",
+           static_cast<unsigned>(mismatched_buckets),
+           static_cast<double>(max_difference));
+  return passed && mismatched_buckets == 0U &&
+         max_difference < kMaxDifferenceCelsius;
+}
+
+/**
+ * @brief Compare the indexed reverse lookup of a table with the bisection
+ *
+ * Clears the table's temperature step and reverse index so the copy takes
+ * the bisection path, then compares both paths every 0.25°C and exactly on
+ * every entry.
+ *
+ * @param table Table with a uniform temperature step or a reverse index
+ * @param max_relative_difference Pointer to update with the largest
+ *        relative difference seen
+ * @return true if both paths resolved every temperature
+ */
+static bool
+compare_reverse_lookup(const NTC::ntc_lookup_table_t *table,
+                       float *max_relative_difference) noexcept {
+  NTC::ntc_lookup_table_t searched = *table;
+  searched.inverse_temperature_step = 0.0F;
+  searched.temperature_index = nullptr;
+  searched.temperature_index_count = 0U;
+  searched.inverse_index_step = 0.0F;
+  const NTC::ValidatedLookupTable indexed(table);
+  const NTC::ValidatedLookupTable bisected(&searched);
+  if (!indexed.IsValid() || !bisected.IsValid()) {
+    return false;
+  }
+
+  const auto compare = [&](float celsius) noexcept {
+    float indexed_ohms = 0.0F;
+    float bisected_ohms = 0.0F;
+    const bool found =
+        NTC::FindResistanceFromLookupTable(indexed, celsius, &indexed_ohms) &&
+        NTC::FindResistanceFromLookupTable(bisected, celsius, &bisected_ohms);
+    *max_relative_difference =
+        std::fmax(*max_relative_difference,
+                  std::fabs(indexed_ohms - bisected_ohms) / bisected_ohms);
+    return found;
+  };
+
+  bool passed = true;
+  for (float celsius = table->min_temperature;
+       passed && celsius <= table->max_temperature; celsius += 0.25F) {
+    passed = compare(celsius);
+  }
+  for (size_t i = 0; passed && i < table->entry_count; ++i) {
+    NTC::ntc_lookup_entry_t entry = {};
+    passed = NTC::GetLookupTableEntry(table, i, &entry) &&
+             compare(entry.temperature_celsius);
+  }
+  return passed;
+}
+
+/**
+ * @brief Indexed reverse lookup against the bisection
+ *
+ * On a table with uniform temperature steps, and on the log-keyed and
+ * compact tables through their reverse index, the indexed temperature to
+ * resistance path must give the same result as the bisection path on the
+ * same entries, between and exactly on the entries. Batch setpoint
+ * conversion must match converting the setpoints one at a time, and scale
+ * to a 32-bit ADC.
+ */
+static bool test_reverse_lookup_matches_search() noexcept {
+  constexpr float kMaxRelativeDifference = 1.0e-5F;
+  constexpr size_t kSetpoints = 5U;
+
+  const NTC::ntc_lookup_table_t *const tables[] = {
+      NTC::MakeNtcTable<10000U, 3950U, -40, 125, 1U>(),
+      NTC::MakeNtcLogTable<10000U, 3435U, -40, 125, 32U>(),
+      NTC::MakeNtcCompactTable<10000U, 3435U, -40, 125, 32U>()};
+  bool passed = tables[1]->temperature_index != nullptr &&
+                tables[2]->temperature_index != nullptr;
+  float max_relative_difference = 0.0F;
+  for (const NTC::ntc_lookup_table_t *table : tables) {
+    passed = passed && compare_reverse_lookup(table, &max_relative_difference);
+  }
+
+  // Setpoints in one batch against one call each
+  ntc_config_t config = {};
+  passed = passed &&
+           g_ntc_driver->GetConfiguration(&config) == NtcError::Success;
+  config.conversion_method = NtcConversionMethod::Mathematical;
+  NtcThermistor<MockEsp32Adc> driver(config, g_mock_adc.get());
+  const float setpoints[kSetpoints] = {-20.0F, 0.0F, 25.0F, 60.5F, 100.0F};
+  uint32_t batch_counts[kSetpoints] = {};
+  passed = passed && driver.Initialize() &&
+           driver.ConvertTemperaturesToAdcCounts(setpoints, batch_counts,
+                                                 kSetpoints) ==
+               NtcError::Success;
+  for (size_t i = 0; passed && i < kSetpoints; ++i) {
+    uint32_t single_count = 0;
+    passed = driver.ConvertTemperaturesToAdcCounts(&setpoints[i],
+                                                   &single_count, 1U) ==
+                 NtcError::Success &&
+             single_count == batch_counts[i] &&
+             (i == 0U || batch_counts[i] < batch_counts[i - 1U]);
+  }
+
+  // A 32-bit ADC scale must convert without overflowing the counts
+  config.adc_resolution_bits = 32U;
+  NtcThermistor<MockEsp32Adc> wide_driver(config, g_mock_adc.get());
+  uint32_t wide_counts[kSetpoints] = {};
+  passed = passed && wide_driver.Initialize() &&
+           wide_driver.ConvertTemperaturesToAdcCounts(setpoints, wide_counts,
+                                                      kSetpoints) ==
+               NtcError::Success;
+  for (size_t i = 0; passed && i < kSetpoints; ++i) {
+    const double scaled = static_cast<double>(wide_counts[i]) *
+                          static_cast<double>((1U << 12) - 1U) /
+                          static_cast<double>(UINT32_MAX);
+    passed = std::fabs(scaled - static_cast<double>(batch_counts[i])) < 1.0;
+  }
+
+  ESP_LOGI(TAG,
+           "Indexed vs bisected reverse lookup: max relative difference %g; "
+           "setpoint counts %u..%u",
+           static_cast<double>(max_relative_difference),
+           static_cast<unsigned>(batch_counts[0]),
+           static_cast<unsigned>(batch_counts[kSetpoints - 1U]));
+  return passed && max_relative_difference < kMaxRelativeDifference;
+}
+
+/**
+ * @brief Compact lookup tables and the shared part registry
+ *
+ * A compact table must match the float table on the same key grid to within
+ * its code resolution in both directions, work when attached to a driver,
+ * and parts with the same curve must share one table.
+ */
+static bool test_compact_lookup_table() noexcept {
+  constexpr float kMaxErrorCelsius = 0.01F;
+  constexpr float kMaxRelativeResistanceError = 0.001F;
+
+  const NTC::ValidatedLookupTable float_table(
+      NTC::MakeNtcLogTable<10000U, 3435U, -40, 125, 32U>());
+  const NTC::ValidatedLookupTable compact_table(
+      NTC::MakeNtcCompactTable<10000U, 3435U, -40, 125, 32U>());
+  if (!float_table.IsValid() || !compact_table.IsValid() ||
+      compact_table->entries != nullptr ||
+      compact_table->entry_count != float_table->entry_count) {
+    ESP_LOGE(TAG, "Compact table layout mismatch");
+    return false;
+  }
+
+  float max_error = 0.0F;
+  for (float resistance = compact_table->min_resistance;
+       resistance <= compact_table->max_resistance; resistance *= 1.01F) {
+    float expected = 0.0F;
+    float actual = 0.0F;
+    if (!NTC::FindTemperatureFromLookupTable(float_table, resistance,
+                                             &expected) ||
+        !NTC::FindTemperatureFromLookupTable(compact_table, resistance,
+                                             &actual)) {
+      ESP_LOGE(TAG, "Lookup failed at %.1f ohms", resistance);
+      return false;
+    }
+    max_error = std::fmax(max_error, std::fabs(actual - expected));
+  }
+
+  float max_relative_error = 0.0F;
+  for (float celsius = -39.0F; celsius <= 124.0F; celsius += 0.5F) {
+    float expected = 0.0F;
+    float actual = 0.0F;
+    if (!NTC::FindResistanceFromLookupTable(float_table, celsius, &expected) ||
+        !NTC::FindResistanceFromLookupTable(compact_table, celsius, &actual)) {
+      ESP_LOGE(TAG, "Reverse lookup failed at %.1f°C", celsius);
+      return false;
+    }
+    max_relative_error = std::fmax(max_relative_error,
+                                   std::fabs(actual - expected) / expected);
+  }
+
+  ESP_LOGI(TAG, "Compact table: %u entries, %u vs %u bytes, max error %.4f°C",
+           static_cast<unsigned>(compact_table->entry_count),
+           static_cast<unsigned>(compact_table->entry_count * sizeof(uint16_t)),
+           static_cast<unsigned>(float_table->entry_count *
+                                 sizeof(NTC::ntc_lookup_entry_t)),
+           max_error);
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+  config.conversion_method = NtcConversionMethod::LookupTable;
+  NtcThermistor<MockEsp32Adc> driver(config, g_mock_adc.get());
+  float celsius = 0.0F;
+  if (!driver.Initialize() ||
+      driver.SetLookupTable(compact_table.Get()) != NtcError::Success ||
+      driver.ReadTemperatureCelsius(&celsius) != NtcError::Success) {
+    ESP_LOGE(TAG, "Driver read with compact table failed");
+    return false;
+  }
+
+  const auto *shared = NTC::GetNtcLookupTable(
+      static_cast<int>(NtcType::NtcG163Jft103Ft1S));
+  const bool registry_shared =
+      shared != nullptr &&
+      NTC::GetNtcLookupTable(static_cast<int>(NtcType::NtcG164Jf103Ft1S)) ==
+          shared &&
+      NTC::GetNtcLookupTable(static_cast<int>(NtcType::NtcG163Jf103Ft1S)) ==
+          shared &&
+      NTC::GetNtcLookupTable(static_cast<int>(NtcType::Custom)) == nullptr;
+
+  return max_error <= kMaxErrorCelsius &&
+         max_relative_error <= kMaxRelativeResistanceError && registry_shared;
+}
+
+/**
+ * @brief Lookup tables built at runtime and registered for a custom type
+ *
+ * Builds tables from Steinhart-Hart coefficients and from measured points of
+ * the default part, registers one for NtcType::Custom and checks that a
+ * Custom LookupTable driver reads the same temperature as the equation on
+ * the table path. A driver built before the registration must pick the
+ * table up in Initialize(), and drop it again when re-initialized after the
+ * registration is removed.
+ */
+static bool test_runtime_lookup_table() noexcept {
+  constexpr uint32_t kSegmentsPerOctave = 32U;
+  constexpr size_t kCapacity = 320U;
+  constexpr size_t kPointCount = 8U;
+  constexpr float kMaxReadDifference = 0.05F;
+  static NTC::ntc_lookup_entry_t sh_entries[kCapacity];
+  static NTC::ntc_lookup_entry_t point_entries[kCapacity];
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+
+  // "Calibration": points on the default part's curve, -30..110°C
+  NTC::ntc_lookup_entry_t points[kPointCount] = {};
+  for (size_t i = 0; i < kPointCount; ++i) {
+    points[i].temperature_celsius = -30.0F + (20.0F * static_cast<float>(i));
+    if (!NTC::ConvertTemperatureToResistanceBeta(
+            points[i].temperature_celsius, config.resistance_at_25c,
+            config.beta_value, &points[i].resistance_ohms)) {
+      return false;
+    }
+  }
+
+  float coeff_a = 0.0F;
+  float coeff_b = 0.0F;
+  float coeff_c = 0.0F;
+  NTC::ntc_lookup_table_t sh_table = {};
+  NTC::ntc_lookup_table_t point_table = {};
+  if (!NTC::CalculateSteinhartHartCoefficients(
+          points[0].temperature_celsius, points[0].resistance_ohms,
+          points[3].temperature_celsius, points[3].resistance_ohms,
+          points[7].temperature_celsius, points[7].resistance_ohms, &coeff_a,
+          &coeff_b, &coeff_c) ||
+      !NTC::BuildLookupTableSteinhartHart(coeff_a, coeff_b, coeff_c, -30.0F,
+                                          110.0F, kSegmentsPerOctave,
+                                          sh_entries, kCapacity, &sh_table) ||
+      !NTC::BuildLookupTableFromPoints(points, kPointCount, kSegmentsPerOctave,
+                                       point_entries, kCapacity,
+                                       &point_table)) {
+    ESP_LOGE(TAG, "Runtime table build failed");
+    return false;
+  }
+
+  config.type = NtcType::Custom;
+  config.conversion_method = NtcConversionMethod::LookupTable;
+  NtcThermistor<MockEsp32Adc> early_driver(config, g_mock_adc.get());
+
+  if (!NTC::RegisterNtcLookupTable(static_cast<int>(NtcType::Custom),
+                                   &point_table)) {
+    ESP_LOGE(TAG, "Table registration failed");
+    return false;
+  }
+
+  NtcThermistor<MockEsp32Adc> table_driver(config, g_mock_adc.get());
+  config.conversion_method = NtcConversionMethod::Mathematical;
+  NtcThermistor<MockEsp32Adc> equation_driver(config, g_mock_adc.get());
+
+  float table_celsius = 0.0F;
+  float equation_celsius = 0.0F;
+  float early_celsius = 0.0F;
+  float sh_celsius = 0.0F;
+  float resistance = 0.0F;
+  const bool read =
+      table_driver.Initialize() && equation_driver.Initialize() &&
+      early_driver.Initialize() &&
+      table_driver.GetActiveConversionMethod() ==
+          NtcConversionMethod::LookupTable &&
+      early_driver.GetActiveConversionMethod() ==
+          NtcConversionMethod::LookupTable &&
+      table_driver.ReadTemperatureCelsius(&table_celsius) ==
+          NtcError::Success &&
+      early_driver.ReadTemperatureCelsius(&early_celsius) ==
+          NtcError::Success &&
+      equation_driver.ReadTemperatureCelsius(&equation_celsius) ==
+          NtcError::Success &&
+      equation_driver.GetResistance(&resistance) ==
+          NtcError::Success &&
+      NTC::FindTemperatureFromLookupTable(NTC::ValidatedLookupTable(&sh_table),
+                                          resistance, &sh_celsius);
+  (void)NTC::RegisterNtcLookupTable(static_cast<int>(NtcType::Custom),
+                                    nullptr);
+  const bool dropped =
+      early_driver.Deinitialize() && early_driver.Initialize() &&
+      early_driver.GetActiveConversionMethod() ==
+          NtcConversionMethod::Mathematical;
+
+  ESP_LOGI(TAG,
+           "Runtime tables: %u/%u entries, table %.3f°C, Steinhart-Hart table "
+           "%.3f°C, equation %.3f°C",
+           static_cast<unsigned>(point_table.entry_count),
+           static_cast<unsigned>(sh_table.entry_count), table_celsius,
+           sh_celsius, equation_celsius);
+
+  return read && dropped && early_celsius == table_celsius &&
+         std::fabs(table_celsius - equation_celsius) <= kMaxReadDifference &&
+         std::fabs(sh_celsius - equation_celsius) <= kMaxReadDifference &&
+         NTC::GetNtcLookupTable(static_cast<int>(NtcType::Custom)) == nullptr;
+}
+
+/**
+ * @brief Lookup table spacing validation
+ *
+ * The O(1) lookups trust the spacing fields of a table, so validation must
+ * reject a descriptor whose resistance_step, inverse_resistance_step,
+ * inverse_temperature_step or reverse index does not match its entries,
+ * and accept the generated tables unchanged (at compile time as well).
+ */
+static bool test_lookup_table_spacing() noexcept {
+  constexpr NTC::ValidatedLookupTable kLogTable{
+      NTC::MakeNtcLogTable<10000U, 3950U, -40, 125, 32U>()};
+  static_assert(kLogTable.IsValid(), "Generated log table must validate");
+
+  const NTC::ntc_lookup_table_t log_table = *kLogTable.Get();
+  const NTC::ntc_lookup_table_t linear_table =
+      *NTC::MakeNtcTable<10000U, 3950U, -40, 125, 1U>();
+  const NTC::ntc_lookup_table_t compact_table =
+      *NTC::MakeNtcCompactTable<10000U, 3950U, -40, 125, 32U>();
+
+  const float key_step = log_table.resistance_step;
+  NTC::ntc_lookup_table_t wrong_step = log_table;
+  wrong_step.resistance_step = key_step * 2.0F;
+  wrong_step.inverse_resistance_step = 1.0F / wrong_step.resistance_step;
+  NTC::ntc_lookup_table_t stale_inverse = log_table;
+  stale_inverse.inverse_resistance_step = 1.0F / (key_step * 2.0F);
+  NTC::ntc_lookup_table_t inverse_only = log_table;
+  inverse_only.resistance_step = 0.0F;
+  NTC::ntc_lookup_table_t uneven_temperatures = log_table;
+  uneven_temperatures.inverse_temperature_step = 1.0F;
+  NTC::ntc_lookup_table_t wrong_temperature_step = linear_table;
+  wrong_temperature_step.inverse_temperature_step = 0.5F;
+  NTC::ntc_lookup_table_t compact_stale_inverse = compact_table;
+  compact_stale_inverse.inverse_resistance_step = 1.0F / (key_step * 2.0F);
+  const uint16_t ahead_index[] = {
+      0U, static_cast<uint16_t>(log_table.entry_count - 2U)};
+  NTC::ntc_lookup_table_t index_ahead = log_table;
+  index_ahead.temperature_index = ahead_index;
+  index_ahead.temperature_index_count = 2U;
+  NTC::ntc_lookup_table_t index_without_density = log_table;
+  index_without_density.inverse_index_step = 0.0F;
+
+  const struct {
+    const NTC::ntc_lookup_table_t *table;
+    bool valid;
+    const char *name;
+  } cases[] = {
+      {&log_table, true, "log table"},
+      {&linear_table, true, "linear table"},
+      {&compact_table, true, "compact table"},
+      {&wrong_step, false, "key step off the entry grid"},
+      {&stale_inverse, false, "stale inverse key step"},
+      {&inverse_only, false, "inverse key step without a step"},
+      {&uneven_temperatures, false, "uniform temperatures claimed"},
+      {&wrong_temperature_step, false, "wrong temperature step"},
+      {&compact_stale_inverse, false, "compact stale inverse key step"},
+      {&index_ahead, false, "reverse index past its bucket"},
+      {&index_without_density, false, "reverse index without a density"},
+  };
+
+  bool passed = true;
+  for (const auto &test_case : cases) {
+    const bool valid = NTC::ValidateLookupTable(test_case.table);
+    ESP_LOGI(TAG, "%s: %s", test_case.name, valid ? "valid" : "rejected");
+    passed = passed && valid == test_case.valid;
+  }
+
+  // The compile-time key must match the bit pattern
+  const float resistances[] = {1.0F, 3.3F, 10000.0F, 123456.7F};
+  for (const float resistance : resistances) {
+    passed = passed && NTC::ConstantResistanceKey(resistance) ==
+                           NTC::ResistanceKey(resistance);
+  }
+  return passed;
+}
+
+/**
+ * @brief History window statistics
+ *
+ * Pushes a noisy ramp through several wraps of the ring buffer and compares
+ * the incremental statistics against a recomputation over the window, then
+ * checks that an attached driver pushes its readings.
+ */
+static bool test_history_window() noexcept {
+  constexpr size_t kWindow = 16U;
+  constexpr int kPushes = 200;
+  constexpr float kTolerance = 1e-3F;
+  constexpr uint64_t kIntervalUs = 100000U;
+  NtcHistory<kWindow> history;
+
+  for (int i = 0; i < kPushes; ++i) {
+    // Ramp of 0.05°C per reading with a +-1°C sawtooth on top
+    const float celsius = 20.0F + (0.05F * static_cast<float>(i)) +
+                          static_cast<float>((i * 7) % 5) - 2.0F;
+    history.Push(celsius, static_cast<uint64_t>(i) * kIntervalUs);
+
+    ntc_history_stats_t stats = {};
+    if (history.GetStats(&stats) != NtcError::Success) {
+      return false;
+    }
+
+    // Recompute over the window, x = 0 for the oldest reading
+    const size_t count = history.Size();
+    float min_celsius = 0.0F;
+    float max_celsius = 0.0F;
+    double sum = 0.0;
+    double weighted_sum = 0.0;
+    for (size_t age = 0; age < count; ++age) {
+      float value = 0.0F;
+      (void)history.GetReading(age, &value);
+      min_celsius = (age == 0U) ? value : std::fmin(min_celsius, value);
+      max_celsius = (age == 0U) ? value : std::fmax(max_celsius, value);
+      sum += value;
+      weighted_sum += static_cast<double>(count - 1U - age) * value;
+    }
+    const double n = static_cast<double>(count);
+    const double slope =
+        (count < 2U) ? 0.0
+                     : ((n * weighted_sum) - (n * (n - 1.0) / 2.0 * sum)) /
+                           ((n * n) * ((n * n) - 1.0) / 12.0);
+    const float rate = static_cast<float>(slope * 1e6 / kIntervalUs);
+
+    if (stats.min_celsius != min_celsius || stats.max_celsius != max_celsius ||
+        std::fabs(stats.mean_celsius - static_cast<float>(sum / n)) >
+            kTolerance ||
+        std::fabs(stats.slope_celsius_per_sample - static_cast<float>(slope)) >
+            kTolerance ||
+        (count >= 2U &&
+         std::fabs(stats.rate_celsius_per_second - rate) > kTolerance)) {
+      ESP_LOGE(TAG, "History stats mismatch after %d readings", i + 1);
+      return false;
+    }
+  }
+
+  ntc_history_stats_t stats = {};
+  (void)history.GetStats(&stats);
+  ESP_LOGI(TAG,
+           "History: %u readings, min %.2f°C, max %.2f°C, mean %.2f°C, "
+           "%.3f°C/s",
+           static_cast<unsigned>(stats.count), stats.min_celsius,
+           stats.max_celsius, stats.mean_celsius,
+           stats.rate_celsius_per_second);
+
+  // Driver feeds the attached history with successful readings
+  history.Clear();
+  float celsius = 0.0F;
+  if (g_ntc_driver->AttachHistory(&history) != NtcError::Success) {
+    return false;
+  }
+  for (size_t i = 0; i < 4U; ++i) {
+    if (g_ntc_driver->ReadTemperatureCelsius(&celsius) != NtcError::Success) {
+      g_ntc_driver->DetachHistory();
+      return false;
+    }
+  }
+  g_ntc_driver->DetachHistory();
+  (void)g_ntc_driver->ReadTemperatureCelsius(&celsius);
+
+  return history.Size() == 4U &&
+         history.GetStats(&stats) == NtcError::Success &&
+         std::fabs(stats.mean_celsius - celsius) <= kTolerance;
+}
+
+/**
+ * @brief Sampling strategies on a burst with a glitch
+ *
+ * One conversion in eight returns full scale. Mean and Decimate average the
+ * glitch in, Median and TrimmedMean reject it and return the clean count.
+ */
+static bool test_sampling_strategies() noexcept {
+  constexpr uint32_t kSamples = 16U;
+  constexpr uint32_t kSpikePeriod = 8U;
+  const uint32_t clean_count = (1U << 12) / 2U - 1U;
+
+  uint32_t clean_raw = 0;
+  if (g_ntc_driver->GetRawAdcValue(&clean_raw) != NtcError::Success ||
+      clean_raw != clean_count) {
+    return false;
+  }
+
+  const struct {
+    NtcSamplingStrategy strategy;
+    bool rejects_spikes;
+    const char *name;
+  } cases[] = {
+      {NtcSamplingStrategy::Mean, false, "Mean"},
+      {NtcSamplingStrategy::Decimate, false, "Decimate"},
+      {NtcSamplingStrategy::Median, true, "Median"},
+      {NtcSamplingStrategy::TrimmedMean, true, "TrimmedMean"},
+  };
+
+  bool passed = g_ntc_driver->SetSamplingParameters(kSamples, 0U) ==
+                NtcError::Success;
+  for (const auto &test_case : cases) {
+    if (!passed) {
+      break;
+    }
+
+    uint32_t raw = 0;
+    g_mock_adc->SetSpikePeriod(kSpikePeriod);
+    passed = g_ntc_driver->SetSamplingStrategy(test_case.strategy) ==
+                 NtcError::Success &&
+             g_ntc_driver->GetRawAdcValue(&raw) == NtcError::Success &&
+             ((raw == clean_count) == test_case.rejects_spikes);
+    ESP_LOGI(TAG, "%s: raw count %u (clean %u)", test_case.name,
+             static_cast<unsigned>(raw), static_cast<unsigned>(clean_count));
+  }
+
+  // Ordered strategies hold at most 32 samples
+  passed = passed &&
+           g_ntc_driver->SetSamplingStrategy(NtcSamplingStrategy::Median) ==
+               NtcError::Success &&
+           g_ntc_driver->SetSamplingParameters(64U, 0U) ==
+               NtcError::InvalidParameter;
+
+  g_mock_adc->SetSpikePeriod(0U);
+  (void)g_ntc_driver->SetSamplingStrategy(NtcSamplingStrategy::Mean);
+  (void)g_ntc_driver->SetSamplingParameters(1U, 0U);
+  return passed;
+}
+
+/**
+ * @brief Build-time configuration for the burst acquisition test
+ */
+struct BurstTestConfig {
+  static constexpr ntc_config_t CONFIG = [] {
+    ntc_config_t config = StaticTestConfig<
+        NtcConversionMethod::Mathematical>::CONFIG;
+    config.sample_count = 40U;
+    config.sample_delay_ms = 0U;
+    return config;
+  }();
+};
+
+/**
+ * @brief Oversampling through the ReadChannelBurst() hook
+ *
+ * 40 samples take two bursts (32 + 8) and no single reads in every driver.
+ * A failing conversion fails its whole burst: the read still counts all 40
+ * conversions and averages the other burst. Median keeps the burst counts
+ * in order, and a read without any valid burst reports AdcReadFailed.
+ */
+static bool test_burst_acquisition() noexcept {
+  // Full-script mean 2008; first burst alone 2007.5, second burst 2010
+  constexpr uint32_t kCounts[] = {2000U, 2000U, 2000U, 2000U, 2040U};
+  constexpr uint32_t kSamples = 40U;
+
+  MockBurstAdc adc(3.3F, 12);
+  ntc_config_t config = BurstTestConfig::CONFIG;
+  NtcThermistor<MockBurstAdc> driver(config, &adc);
+  if (!driver.Initialize()) {
+    return false;
+  }
+
+  ntc_reading_t reading = {};
+  adc.SetCounts(kCounts);
+  bool passed = driver.ReadTemperature(&reading) == NtcError::Success &&
+                reading.adc_raw_value == 2008U &&
+                reading.adc_conversions == kSamples &&
+                driver.GetLastAdcConversionCount() == kSamples &&
+                adc.BurstCalls() == 2U && adc.SingleReads() == 0U &&
+                adc.Conversions() == kSamples;
+
+  const struct {
+    uint32_t fail_first;
+    uint32_t expected_raw;
+  } failures[] = {{35U, 2007U}, {5U, 2010U}};
+  for (const auto &failure : failures) {
+    adc.SetCounts(kCounts);
+    adc.FailConversions(failure.fail_first, 1U);
+    passed = passed && driver.ReadTemperature(&reading) == NtcError::Success &&
+             reading.adc_raw_value == failure.expected_raw &&
+             reading.adc_conversions == kSamples &&
+             adc.Conversions() == kSamples;
+    ESP_LOGI(TAG, "Conversion %u failed: raw count %u, %u conversions",
+             static_cast<unsigned>(failure.fail_first),
+             static_cast<unsigned>(reading.adc_raw_value),
+             static_cast<unsigned>(reading.adc_conversions));
+  }
+
+  adc.SetCounts(kCounts);
+  adc.FailConversions(0U, kSamples);
+  passed = passed &&
+           driver.ReadTemperature(&reading) == NtcError::AdcReadFailed &&
+           driver.GetLastAdcConversionCount() == kSamples;
+  adc.FailConversions(0U, 0U);
+
+  // 26 of the 32 counts are 2000; the mean would be 2007
+  uint32_t median_raw = 0;
+  adc.SetCounts(kCounts);
+  passed = passed &&
+           driver.SetSamplingParameters(32U, 0U) == NtcError::Success &&
+           driver.SetSamplingStrategy(NtcSamplingStrategy::Median) ==
+               NtcError::Success &&
+           driver.GetRawAdcValue(&median_raw) == NtcError::Success &&
+           median_raw == 2000U && adc.BurstCalls() == 1U &&
+           adc.SingleReads() == 0U;
+
+  NtcThermistorQ<MockBurstAdc> q_driver(config, &adc);
+  uint32_t q_raw = 0;
+  adc.SetCounts(kCounts);
+  passed = passed && q_driver.Initialize() &&
+           q_driver.GetRawAdcValue(&q_raw) == NtcError::Success &&
+           q_raw == 2008U && q_driver.GetLastAdcConversionCount() == kSamples &&
+           adc.BurstCalls() == 2U && adc.SingleReads() == 0U;
+
+  StaticNtcThermistor<MockBurstAdc, BurstTestConfig> static_driver(&adc);
+  uint32_t static_raw = 0;
+  adc.SetCounts(kCounts);
+  passed = passed && static_driver.Initialize() &&
+           static_driver.GetRawAdcValue(&static_raw) == NtcError::Success &&
+           static_raw == 2008U &&
+           static_driver.GetLastAdcConversionCount() == kSamples &&
+           adc.BurstCalls() == 2U && adc.SingleReads() == 0U;
+
+  ESP_LOGI(TAG, "Burst raw counts: median %u, Q %u, static %u",
+           static_cast<unsigned>(median_raw), static_cast<unsigned>(q_raw),
+           static_cast<unsigned>(static_raw));
+  return passed;
+}
+
+/**
+ * @brief Read the raw counts of a two-channel array
+ * @param adc ADC interface
+ * @param raw Array of two elements to store the averaged counts
+ * @param conversions Pointer to store the conversion count of the read
+ */
+template <typename AdcType>
+static bool read_array_counts(AdcType *adc, uint32_t *raw,
+                              uint32_t *conversions) noexcept {
+  ntc_config_t config = StaticTestConfig<
+      NtcConversionMethod::Mathematical>::CONFIG;
+  config.sample_count = 4U;
+  const std::array<ntc_channel_config_t, 2> channels = {
+      {{1U, 10000.0F, 3950.0F, 10000.0F, 0.0F},
+       {3U, 10000.0F, 3950.0F, 10000.0F, 0.0F}}};
+
+  NtcThermistorArray<AdcType, 2> sensors(config, channels, adc);
+  if (!sensors.Initialize() ||
+      sensors.GetRawAdcValues(raw) != NtcError::Success) {
+    return false;
+  }
+  *conversions = sensors.GetLastAdcConversionCount();
+  return true;
+}
+
+/**
+ * @brief Multi-channel scans through the ReadChannelsCount() hook
+ *
+ * An ADC with its own ReadChannelsCount() serves each of the four scans in
+ * one call; the AdcInterface default falls back to one ReadChannelCount()
+ * per channel. Both give the same counts and 8 conversions.
+ */
+static bool test_array_scan_hook() noexcept {
+  constexpr uint32_t kCounts[] = {2000U};
+  constexpr uint32_t kChannelStep = 100U;
+
+  MockBurstAdc scan_adc(3.3F, 12);
+  uint32_t scan_raw[2] = {};
+  uint32_t scan_conversions = 0;
+  scan_adc.SetCounts(kCounts, kChannelStep);
+  bool passed = read_array_counts(&scan_adc, scan_raw, &scan_conversions) &&
+                scan_adc.ScanCalls() == 4U && scan_adc.SingleReads() == 0U;
+
+  MockScriptedAdc single_adc(3.3F, 12);
+  uint32_t single_raw[2] = {};
+  uint32_t single_conversions = 0;
+  single_adc.SetCounts(kCounts, kChannelStep);
+  passed = passed &&
+           read_array_counts(&single_adc, single_raw, &single_conversions) &&
+           single_adc.SingleReads() == 8U;
+
+  ESP_LOGI(TAG, "Scan hook: %u/%u (%u conversions), default: %u/%u (%u)",
+           static_cast<unsigned>(scan_raw[0]),
+           static_cast<unsigned>(scan_raw[1]),
+           static_cast<unsigned>(scan_conversions),
+           static_cast<unsigned>(single_raw[0]),
+           static_cast<unsigned>(single_raw[1]),
+           static_cast<unsigned>(single_conversions));
+  return passed && scan_raw[0] == 2100U && scan_raw[1] == 2300U &&
+         single_raw[0] == 2100U && single_raw[1] == 2300U &&
+         scan_conversions == 8U && single_conversions == 8U;
+}
+
+/**
+ * @brief Array driver against one scalar driver per channel
+ *
+ * Four channels with their own part, divider and offset parameters read
+ * the same scripted counts through NtcThermistorArray and through one
+ * NtcThermistor each. Temperatures must agree, and the channel below
+ * min_temperature must be cleared in the valid mask and out of range in the
+ * scalar driver too.
+ */
+static bool test_array_matches_scalar() noexcept {
+  constexpr size_t kChannels = 4U;
+  constexpr uint32_t kCounts[] = {1500U};
+  constexpr uint32_t kChannelStep = 700U; // Counts 1500, 2200, 2900, 3600
+  constexpr float kMaxDifferenceCelsius = 0.01F;
+
+  ntc_config_t config = StaticTestConfig<
+      NtcConversionMethod::Mathematical>::CONFIG;
+  config.sample_count = 4U;
+  config.min_temperature = -10.0F; // Channel 3 reads about -14°C
+  const std::array<ntc_channel_config_t, kChannels> channels = {
+      {{0U, 10000.0F, 3950.0F, 10000.0F, 0.0F},
+       {1U, 10000.0F, 3435.0F, 10000.0F, 0.5F},
+       {2U, 47000.0F, 4050.0F, 22000.0F, -1.0F},
+       {3U, 10000.0F, 3950.0F, 10000.0F, 0.0F}}};
+
+  MockScriptedAdc adc(3.3F, 12);
+  NtcThermistorArray<MockScriptedAdc, kChannels> sensors(config, channels,
+                                                         &adc);
+  float array_celsius[kChannels] = {};
+  uint32_t valid_mask = 0U;
+  adc.SetCounts(kCounts, kChannelStep);
+  bool passed = sensors.Initialize() &&
+                sensors.ReadTemperaturesCelsius(array_celsius, &valid_mask) ==
+                    NtcError::TemperatureOutOfRange &&
+                valid_mask == 0x7U;
+
+  for (size_t i = 0; passed && i < kChannels; ++i) {
+    ntc_config_t channel_config = config;
+    channel_config.adc_channel = channels[i].adc_channel;
+    channel_config.resistance_at_25c = channels[i].resistance_at_25c;
+    channel_config.beta_value = channels[i].beta_value;
+    channel_config.series_resistance = channels[i].series_resistance;
+    channel_config.calibration_offset = channels[i].calibration_offset;
+    NtcThermistor<MockScriptedAdc> scalar(channel_config, &adc);
+
+    ntc_reading_t reading = {};
+    adc.SetCounts(kCounts, kChannelStep);
+    const bool valid = (valid_mask & (1U << i)) != 0U;
+    passed = scalar.Initialize() &&
+             scalar.ReadTemperature(&reading) ==
+                 (valid ? NtcError::Success
+                        : NtcError::TemperatureOutOfRange) &&
+             (!valid ||
+              std::fabs(reading.temperature_celsius - array_celsius[i]) <
+                  kMaxDifferenceCelsius);
+    ESP_LOGI(TAG, "Channel %u: array %.3f°C, scalar %.3f°C%s",
+             static_cast<unsigned>(i),
+             static_cast<double>(array_celsius[i]),
+             static_cast<double>(reading.temperature_celsius),
+             valid ? "" : " (out of range)");
+  }
+  return passed;
+}
+
+/**
+ * @brief Latest-reading snapshot (publish/subscribe mode)
+ *
+ * Synchronous and asynchronous readings are published to the attached
+ * snapshot, and consumers read them back without touching the ADC.
+ */
+static bool test_reading_snapshot() noexcept {
+  NtcReadingSnapshot latest;
+  ntc_reading_t consumed = {};
+  if (latest.Read(&consumed) != NtcError::NotInitialized ||
+      g_ntc_driver->AttachSnapshot(nullptr) != NtcError::NullPointer ||
+      g_ntc_driver->AttachSnapshot(&latest) != NtcError::Success) {
+    return false;
+  }
+
+  // Sampler: one synchronous read, one asynchronous conversion
+  ntc_reading_t sampled = {};
+  bool passed = g_ntc_driver->ReadTemperature(&sampled) == NtcError::Success;
+
+  uint32_t sequence = 0;
+  passed = passed && latest.Read(&consumed, &sequence) == NtcError::Success &&
+           sequence == 1U && consumed.is_valid &&
+           consumed.temperature_celsius == sampled.temperature_celsius &&
+           consumed.adc_raw_value == sampled.adc_raw_value;
+
+  constexpr uint64_t kNowUs = 1000U;
+  passed = passed &&
+           g_ntc_driver->StartConversion(kNowUs) == NtcError::Success &&
+           g_ntc_driver->Poll(kNowUs, &sampled) ==
+               NtcConversionStatus::Complete;
+  passed = passed && latest.Read(&consumed, &sequence) == NtcError::Success &&
+           sequence == 2U && consumed.timestamp_us == kNowUs;
+
+  // Detached: readings are no longer published
+  g_ntc_driver->DetachSnapshot();
+  passed = passed &&
+           g_ntc_driver->ReadTemperature(&sampled) == NtcError::Success &&
+           latest.Sequence() == 2U;
+
+  ESP_LOGI(TAG, "Snapshot: %u readings published, last %.2f°C",
+           static_cast<unsigned>(latest.Sequence()),
+           consumed.temperature_celsius);
+  return passed;
+}
+
+/**
+ * @brief Change-driven reporting with a raw count deadband
+ *
+ * A steady count is reported once, then skipped until it moves by the
+ * deadband or the conversion changes.
+ */
+static bool test_change_detection() noexcept {
+  constexpr uint32_t kDeadbandCounts = 8U;
+  ntc_reading_t reading = {};
+
+  // Deadband off: every reading is reported
+  bool passed = g_ntc_driver->ReadTemperatureIfChanged(&reading) ==
+                    NtcConversionStatus::Complete &&
+                g_ntc_driver->ReadTemperatureIfChanged(&reading) ==
+                    NtcConversionStatus::Complete;
+
+  passed = passed && g_ntc_driver->SetReportDeadband(kDeadbandCounts) ==
+                         NtcError::Success;
+  passed = passed &&
+           g_ntc_driver->ReadTemperatureIfChanged(&reading) ==
+               NtcConversionStatus::Complete &&
+           reading.is_valid;
+  const uint32_t reported_count = reading.adc_raw_value;
+
+  // Steady input: skipped, reading left untouched
+  reading.adc_raw_value = 0U;
+  passed = passed &&
+           g_ntc_driver->ReadTemperatureIfChanged(&reading) ==
+               NtcConversionStatus::Unchanged &&
+           reading.adc_raw_value == 0U;
+
+  // Asynchronous conversions use the same reference
+  constexpr uint64_t kNowUs = 1000U;
+  passed = passed &&
+           g_ntc_driver->StartConversion(kNowUs) == NtcError::Success &&
+           g_ntc_driver->Poll(kNowUs, &reading) ==
+               NtcConversionStatus::Unchanged;
+
+  // A full-scale glitch exceeds the deadband
+  g_mock_adc->SetSpikePeriod(1U);
+  passed = passed && g_ntc_driver->ReadTemperatureIfChanged(&reading) ==
+                         NtcConversionStatus::Complete;
+  g_mock_adc->SetSpikePeriod(0U);
+  passed = passed && g_ntc_driver->ReadTemperatureIfChanged(&reading) ==
+                         NtcConversionStatus::Complete &&
+           reading.adc_raw_value == reported_count;
+
+  // A calibration change alters the temperature of the same count
+  passed = passed &&
+           g_ntc_driver->SetCalibrationOffset(0.5F) == NtcError::Success &&
+           g_ntc_driver->ReadTemperatureIfChanged(&reading) ==
+               NtcConversionStatus::Complete;
+
+  ESP_LOGI(TAG, "Change detection: count %u reported, deadband %u counts",
+           static_cast<unsigned>(reported_count),
+           static_cast<unsigned>(kDeadbandCounts));
+
+  (void)g_ntc_driver->SetCalibrationOffset(0.0F);
+  (void)g_ntc_driver->SetReportDeadband(0U);
+  return passed;
+}
+
+/**
+ * @brief Packed reading format round trip
+ *
+ * Packs a batch of driver readings for several channels, checks the size
+ * against ntc_reading_t and decodes it back.
+ */
+static bool test_packed_reading_format() noexcept {
+  constexpr size_t kChannels = 4U;
+  constexpr size_t kTicks = 8U;
+  constexpr uint64_t kTickUs = 1000U;
+  std::array<uint8_t, kChannels * kTicks * 8U> buffer = {};
+  NtcPackedEncoder encoder(buffer.data(), buffer.size());
+
+  ntc_reading_t reading = {};
+  if (g_ntc_driver->ReadTemperature(&reading) != NtcError::Success) {
+    return false;
+  }
+
+  for (size_t tick = 0; tick < kTicks; ++tick) {
+    for (size_t channel = 0; channel < kChannels; ++channel) {
+      reading.timestamp_us = 5000000U + (tick * kTickUs) + channel;
+      if (encoder.Append(static_cast<uint8_t>(channel), reading) !=
+          NtcError::Success) {
+        ESP_LOGE(TAG, "Batch full after %u records",
+                 static_cast<unsigned>(encoder.Records()));
+        return false;
+      }
+    }
+  }
+
+  // Full buffer: the record is rejected and the batch left intact
+  const size_t batch_size = encoder.Size();
+  while (encoder.Append(0U, reading) == NtcError::Success) {
+  }
+  const size_t full_size = encoder.Size();
+  bool passed = encoder.Append(0U, reading) == NtcError::OutOfMemory &&
+                encoder.Size() == full_size;
+
+  ntc_config_t config = {};
+  (void)g_ntc_driver->GetConfiguration(&config);
+  NtcPackedDecoder decoder(encoder.Data(), batch_size, &config);
+  size_t decoded = 0;
+  while (passed && decoder.HasNext()) {
+    uint8_t channel = 0;
+    ntc_reading_t unpacked = {};
+    passed = decoder.Next(&channel, &unpacked) == NtcError::Success &&
+             channel == decoded % kChannels &&
+             unpacked.timestamp_us ==
+                 5000000U + ((decoded / kChannels) * kTickUs) + channel &&
+             unpacked.adc_raw_value == reading.adc_raw_value &&
+             unpacked.is_valid &&
+             std::fabs(unpacked.temperature_celsius -
+                       reading.temperature_celsius) <= 0.005F &&
+             std::fabs(unpacked.voltage_volts - reading.voltage_volts) <=
+                 0.001F;
+    decoded++;
+  }
+
+  ESP_LOGI(TAG, "Packed: %u readings in %u bytes (%u bytes as ntc_reading_t)",
+           static_cast<unsigned>(decoded), static_cast<unsigned>(batch_size),
+           static_cast<unsigned>(decoded * sizeof(ntc_reading_t)));
+  return passed && decoded == kChannels * kTicks;
+}
+
+/**
+ * @brief Acquisition timestamps from the ADC clock hook
+ *
+ * The mock ADC advances its clock per conversion, so a synchronous reading
+ * must be stamped with the burst midpoint and passed on to the history. A
+ * paced asynchronous reading is stamped in the caller's time base, and is
+ * abandoned when the channel changes under it.
+ */
+static bool test_reading_timestamps() noexcept {
+  constexpr uint32_t kSampleCount = 16U;
+  constexpr uint32_t kConversionTimeUs = 10U;
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+  config.sample_count = kSampleCount;
+  config.sample_delay_ms = 0U;
+
+  NtcThermistor<MockEsp32Adc> driver(config, g_mock_adc.get());
+  NtcHistory<4> history;
+  if (!driver.Initialize() || driver.AttachHistory(&history) !=
+                                  NtcError::Success) {
+    ESP_LOGE(TAG, "Failed to initialize timestamp driver");
+    return false;
+  }
+
+  g_mock_adc->SetConversionTimeUs(kConversionTimeUs);
+  const uint64_t start_us = g_mock_adc->ReadTimestampUs();
+  ntc_reading_t reading = {};
+  bool passed = driver.ReadTemperature(&reading) == NtcError::Success;
+  const uint64_t expected_us =
+      start_us + ((kSampleCount * kConversionTimeUs) / 2U);
+
+  float temperature = 0.0F;
+  uint64_t history_us = 0U;
+  passed = passed && reading.timestamp_us == expected_us &&
+           history.GetReading(0U, &temperature, &history_us) ==
+               NtcError::Success &&
+           history_us == expected_us;
+  g_mock_adc->SetConversionTimeUs(0U);
+
+  // Paced conversion: samples at 1, 2, 3 and 4 ms, midpoint 2.5 ms
+  constexpr uint64_t kSampleIntervalUs = 1000U;
+  config.sample_count = 4U;
+  config.sample_delay_ms = 1U;
+  passed = passed && driver.SetConfiguration(config) == NtcError::Success &&
+           driver.StartConversion(kSampleIntervalUs) == NtcError::Success;
+  NtcConversionStatus status = NtcConversionStatus::InProgress;
+  for (uint64_t now_us = kSampleIntervalUs;
+       passed && status == NtcConversionStatus::InProgress;
+       now_us += kSampleIntervalUs) {
+    status = driver.Poll(now_us, &reading);
+  }
+  passed = passed && status == NtcConversionStatus::Complete &&
+           reading.timestamp_us == (5U * kSampleIntervalUs) / 2U;
+
+  // Changing the channel abandons a paced conversion instead of mixing
+  // samples of two channels into one reading
+  passed = passed &&
+           driver.StartConversion(kSampleIntervalUs) == NtcError::Success &&
+           driver.Poll(kSampleIntervalUs, &reading) ==
+               NtcConversionStatus::InProgress &&
+           driver.SetAdcChannel(config.adc_channel) == NtcError::Success &&
+           !driver.IsConversionActive() &&
+           driver.Poll(2U * kSampleIntervalUs, &reading) ==
+               NtcConversionStatus::Idle;
+
+  ESP_LOGI(TAG, "Timestamps: burst midpoint %llu us, paced midpoint %llu us",
+           static_cast<unsigned long long>(expected_us),
+           static_cast<unsigned long long>(reading.timestamp_us));
+  return passed;
+}
+
+/**
+ * @brief Thermal-lag and Kalman filter modes
+ *
+ * Checks parameter validation, that every mode settles on a steady input
+ * without bias, that the timed modes need a nominal reading period on an
+ * ADC without a clock and use it as the time step, and that the
+ * fixed-point driver rejects the new modes.
+ */
+static bool test_filter_modes() noexcept {
+  constexpr int kReads = 32;
+  constexpr float kToleranceCelsius = 0.001F;
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+  config.enable_filtering = false;
+  config.filter_time_constant_s = 5.0F;
+  config.filter_process_noise = 0.01F;
+  config.filter_measurement_noise = 0.01F;
+  NtcThermistor<MockEsp32Adc> driver(config, g_mock_adc.get());
+  float unfiltered = 0.0F;
+  if (!driver.Initialize() ||
+      driver.ReadTemperatureCelsius(&unfiltered) != NtcError::Success) {
+    ESP_LOGE(TAG, "Failed to initialize filter driver");
+    return false;
+  }
+
+  // Mode parameters are validated when the mode is selected or configured
+  ntc_config_t invalid = config;
+  invalid.enable_filtering = true;
+  invalid.filter_mode = NtcFilterMode::Kalman;
+  invalid.filter_measurement_noise = 0.0F;
+  bool passed =
+      driver.SetConfiguration(invalid) == NtcError::InvalidParameter;
+  invalid.filter_mode = NtcFilterMode::ThermalLag;
+  invalid.filter_time_constant_s = -1.0F;
+  passed = passed &&
+           driver.SetConfiguration(invalid) == NtcError::InvalidParameter;
+
+  // Every mode settles on a steady input, clock advancing or not
+  const NtcFilterMode modes[] = {NtcFilterMode::Ema, NtcFilterMode::ThermalLag,
+                                 NtcFilterMode::Kalman};
+  for (const NtcFilterMode mode : modes) {
+    passed = passed && driver.SetFiltering(true, 0.2F) == NtcError::Success &&
+             driver.SetFilterMode(mode) == NtcError::Success;
+    g_mock_adc->SetConversionTimeUs(mode == NtcFilterMode::Kalman ? 1000U
+                                                                  : 0U);
+    float filtered = 0.0F;
+    for (int i = 0; passed && i < kReads; ++i) {
+      passed = driver.ReadTemperatureCelsius(&filtered) == NtcError::Success;
+    }
+    passed = passed && std::fabs(filtered - unfiltered) <= kToleranceCelsius;
+  }
+  g_mock_adc->SetConversionTimeUs(0U);
+
+  // Without an ADC clock the timed modes need a nominal reading period,
+  // and the lead then follows it: 1 - e^(-0.1 s / 5 s) per reading
+  constexpr uint32_t kStepCounts[] = {2000U, 2100U};
+  constexpr float kPeriodSeconds = 0.1F;
+  constexpr float kAlpha = 0.2F;
+  MockScriptedAdc scripted_adc(3.3F, 12);
+  ntc_config_t timed = config;
+  timed.conversion_method = NtcConversionMethod::Mathematical;
+  timed.sample_count = 1U;
+  timed.sample_delay_ms = 0U;
+  NtcThermistor<MockScriptedAdc> unfiltered_driver(timed, &scripted_adc);
+  timed.enable_filtering = true;
+  timed.filter_alpha = kAlpha;
+  timed.filter_mode = NtcFilterMode::ThermalLag;
+  NtcThermistor<MockScriptedAdc> timed_driver(timed, &scripted_adc);
+  passed = passed && !timed_driver.Initialize() &&
+           unfiltered_driver.Initialize() &&
+           unfiltered_driver.SetConfiguration(timed) ==
+               NtcError::InvalidParameter &&
+           unfiltered_driver.SetFilterMode(NtcFilterMode::Kalman) ==
+               NtcError::InvalidParameter;
+  timed.filter_sample_period_s = kPeriodSeconds;
+  float step[2] = {};
+  float lagged[2] = {};
+  scripted_adc.SetCounts(kStepCounts);
+  passed = passed &&
+           unfiltered_driver.ReadTemperatureCelsius(&step[0]) ==
+               NtcError::Success &&
+           unfiltered_driver.ReadTemperatureCelsius(&step[1]) ==
+               NtcError::Success &&
+           timed_driver.SetConfiguration(timed) == NtcError::Success &&
+           timed_driver.Initialize();
+  scripted_adc.SetCounts(kStepCounts);
+  passed = passed &&
+           timed_driver.ReadTemperatureCelsius(&lagged[0]) ==
+               NtcError::Success &&
+           timed_driver.ReadTemperatureCelsius(&lagged[1]) ==
+               NtcError::Success;
+  const float smoothed = (kAlpha * step[1]) + ((1.0F - kAlpha) * step[0]);
+  const float response =
+      1.0F - std::exp(-kPeriodSeconds / timed.filter_time_constant_s);
+  const float expected =
+      smoothed + (kAlpha * (smoothed - step[0]) * ((1.0F / response) - 1.0F));
+  passed = passed && std::fabs(lagged[1] - expected) <= 0.01F;
+  ESP_LOGI(TAG,
+           "Nominal period lead: step %.3f -> %.3f°C, read %.3f°C, "
+           "expected %.3f°C",
+           static_cast<double>(step[0]), static_cast<double>(step[1]),
+           static_cast<double>(lagged[1]), static_cast<double>(expected));
+
+  // The fixed-point driver only has an integer moving average
+  ntc_config_t kalman = config;
+  kalman.enable_filtering = true;
+  kalman.filter_mode = NtcFilterMode::Kalman;
+  NtcThermistorQ<MockEsp32Adc> fixed_point(config, g_mock_adc.get());
+  passed = passed && fixed_point.Initialize() &&
+           fixed_point.SetConfiguration(kalman) ==
+               NtcError::UnsupportedOperation;
+
+  ESP_LOGI(TAG, "Filter modes: steady input %.3f°C", unfiltered);
+  return passed;
+}
+
+/**
+ * @brief Test adaptive read scheduling
+ *
+ * Checks configuration validation, that a flat input relaxes the interval
+ * one doubling per read down to the slowest rate, that reads are skipped
+ * until due, and that a temperature near a limit escalates at once.
+ */
+static bool test_adaptive_sampling() noexcept {
+  constexpr uint32_t kMinIntervalMs = 100U;
+  constexpr uint32_t kMaxIntervalMs = 800U;
+  constexpr float kLimitMarginCelsius = 10.0F;
+  constexpr float kUrgencyTolerance = 0.01F;
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+  config.enable_filtering = false;
+  config.report_deadband_counts = 0U;
+  NtcThermistor<MockEsp32Adc> driver(config, g_mock_adc.get());
+  if (!driver.Initialize()) {
+    ESP_LOGE(TAG, "Failed to initialize adaptive sampling driver");
+    return false;
+  }
+
+  ntc_adaptive_config_t adaptive = GetDefaultNtcAdaptiveConfig();
+  adaptive.min_interval_ms = kMinIntervalMs;
+  adaptive.max_interval_ms = kMaxIntervalMs;
+  adaptive.limit_margin_celsius = kLimitMarginCelsius;
+
+  // Inconsistent bounds are rejected
+  NtcAdaptiveSampler<MockEsp32Adc> unbound(nullptr, adaptive);
+  ntc_adaptive_config_t invalid = adaptive;
+  invalid.min_interval_ms = kMaxIntervalMs + 1U;
+  NtcAdaptiveSampler<MockEsp32Adc> sampler(&driver, adaptive);
+  bool passed = !unbound.Initialize() && sampler.Initialize() &&
+                sampler.SetConfiguration(invalid) ==
+                    NtcError::InvalidParameter;
+
+  // The first read is immediate and at full rate
+  ntc_reading_t reading = {};
+  uint64_t now_us = 0U;
+  passed = passed && sampler.GetSampleCount() == adaptive.max_sample_count &&
+           sampler.Service(now_us, &reading) ==
+               NtcConversionStatus::Complete &&
+           reading.is_valid;
+
+  // A flat input far from the limits relaxes one doubling per read
+  const uint32_t expected_intervals_ms[] = {400U, kMaxIntervalMs,
+                                            kMaxIntervalMs};
+  passed = passed && sampler.GetIntervalMs() == 200U;
+  for (const uint32_t interval_ms : expected_intervals_ms) {
+    now_us = sampler.NextDueUs();
+    passed = passed && !sampler.IsDue(now_us - 1U) &&
+             sampler.Service(now_us - 1U, &reading) ==
+                 NtcConversionStatus::Idle &&
+             sampler.Service(now_us, &reading) ==
+                 NtcConversionStatus::Complete &&
+             sampler.GetIntervalMs() == interval_ms;
+  }
+  passed = passed && sampler.GetUrgency() == 0.0F &&
+           sampler.GetSampleCount() == adaptive.min_sample_count;
+
+  // Two degrees from the high limit is 80% into the margin
+  const float flat_celsius = reading.temperature_celsius;
+  adaptive.high_limit_celsius = flat_celsius + 2.0F;
+  passed = passed && sampler.SetConfiguration(adaptive) == NtcError::Success;
+  now_us = sampler.NextDueUs();
+  passed = passed &&
+           sampler.Service(now_us, &reading) ==
+               NtcConversionStatus::Complete &&
+           sampler.Service(sampler.NextDueUs(), &reading) ==
+               NtcConversionStatus::Complete &&
+           std::fabs(sampler.GetUrgency() - 0.8F) <= kUrgencyTolerance &&
+           sampler.GetIntervalMs() < 2U * kMinIntervalMs &&
+           sampler.GetSampleCount() == 7U;
+
+  ESP_LOGI(TAG,
+           "Adaptive sampling: relaxed to %u ms x%u, %.1f°C from the limit "
+           "-> %u ms x%u",
+           static_cast<unsigned>(kMaxIntervalMs),
+           static_cast<unsigned>(adaptive.min_sample_count),
+           static_cast<double>(adaptive.high_limit_celsius - flat_celsius),
+           static_cast<unsigned>(sampler.GetIntervalMs()),
+           static_cast<unsigned>(sampler.GetSampleCount()));
+  return passed;
+}
+
+/**
+ * @brief Test the multi-sensor scan scheduler
+ *
+ * Two sensors share ADC unit 0 and a third runs on unit 1, all released
+ * every 10 ms with 3 ms paced bursts. The high-priority sensor must always
+ * start on release, the low-priority one behind it (missing its 2 ms
+ * deadline), and the unit-1 sensor concurrently with both.
+ */
+static bool test_scan_scheduler() noexcept {
+  constexpr uint32_t kPeriodUs = 10000U;
+  constexpr uint32_t kBurstUs = 3000U;
+  constexpr uint64_t kRunUs = 100000U;
+  constexpr uint32_t kReleases = kRunUs / kPeriodUs;
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+  config.enable_filtering = false;
+  config.report_deadband_counts = 0U;
+  config.sample_count = 4U;
+  config.sample_delay_ms = 1U;
+  NtcThermistor<MockEsp32Adc> cabinet(config, g_mock_adc.get());
+  NtcThermistor<MockEsp32Adc> winding(config, g_mock_adc.get());
+  NtcThermistor<MockEsp32Adc> auxiliary(config, g_mock_adc.get());
+  if (!cabinet.Initialize() || !winding.Initialize() ||
+      !auxiliary.Initialize()) {
+    ESP_LOGE(TAG, "Failed to initialize scheduler drivers");
+    return false;
+  }
+
+  NtcScanScheduler<MockEsp32Adc, 3, 2> scheduler;
+  const ntc_scan_sensor_config_t cabinet_config = {.period_us = kPeriodUs,
+                                                   .deadline_us = 2000U,
+                                                   .phase_us = 0U,
+                                                   .priority = 0U,
+                                                   .adc_unit = 0U};
+  ntc_scan_sensor_config_t winding_config = cabinet_config;
+  winding_config.deadline_us = 0U;
+  winding_config.priority = 10U;
+  ntc_scan_sensor_config_t auxiliary_config = winding_config;
+  auxiliary_config.priority = 0U;
+  auxiliary_config.adc_unit = 1U;
+
+  // Invalid parameters, duplicates and capacity are rejected
+  ntc_scan_sensor_config_t invalid = cabinet_config;
+  invalid.adc_unit = 2U;
+  bool passed =
+      scheduler.AddSensor(nullptr, cabinet_config) == NtcError::NullPointer &&
+      scheduler.AddSensor(&cabinet, invalid) == NtcError::InvalidParameter;
+  invalid = cabinet_config;
+  invalid.period_us = 0U;
+  passed = passed &&
+           scheduler.AddSensor(&cabinet, invalid) ==
+               NtcError::InvalidParameter &&
+           scheduler.AddSensor(&cabinet, cabinet_config) ==
+               NtcError::Success &&
+           scheduler.AddSensor(&cabinet, winding_config) ==
+               NtcError::InvalidParameter &&
+           scheduler.AddSensor(&winding, winding_config) ==
+               NtcError::Success &&
+           scheduler.AddSensor(&auxiliary, auxiliary_config) ==
+               NtcError::Success &&
+           scheduler.AddSensor(&cabinet, cabinet_config) ==
+               NtcError::OutOfMemory;
+
+  // Event-driven run: service exactly when the scheduler asks for it
+  uint64_t now_us = 0U;
+  scheduler.Start(now_us);
+  passed = passed && scheduler.AddSensor(&winding, winding_config) ==
+                         NtcError::Busy;
+  while (now_us < kRunUs) {
+    (void)scheduler.Service(now_us);
+    now_us = scheduler.NextDueUs();
+  }
+  scheduler.Stop();
+
+  ntc_scan_stats_t cabinet_stats = {};
+  ntc_scan_stats_t winding_stats = {};
+  ntc_scan_stats_t auxiliary_stats = {};
+  ntc_scan_stats_t total = {};
+  ntc_reading_t reading = {};
+  passed = passed && scheduler.GetStats(0U, &cabinet_stats) ==
+                         NtcError::Success &&
+           scheduler.GetStats(1U, &winding_stats) == NtcError::Success &&
+           scheduler.GetStats(2U, &auxiliary_stats) == NtcError::Success &&
+           scheduler.GetTotalStats(&total) == NtcError::Success &&
+           scheduler.GetReading(0U, &reading) == NtcError::Success &&
+           reading.is_valid;
+
+  // Priority first on the shared unit; the other unit is not held up
+  passed = passed && winding_stats.completed == kReleases &&
+           winding_stats.max_jitter_us == 0U &&
+           winding_stats.deadline_misses == 0U &&
+           cabinet_stats.completed == kReleases &&
+           cabinet_stats.mean_jitter_us == kBurstUs &&
+           cabinet_stats.deadline_misses == kReleases &&
+           auxiliary_stats.completed == kReleases &&
+           auxiliary_stats.max_jitter_us == 0U &&
+           total.completed == 3U * kReleases && total.overruns == 0U &&
+           total.errors == 0U && total.max_response_us == 2U * kBurstUs;
+
+  ESP_LOGI(TAG,
+           "Scan scheduler: %u conversions, cabinet jitter %u us, "
+           "%u deadline misses, max response %u us",
+           static_cast<unsigned>(total.completed),
+           static_cast<unsigned>(cabinet_stats.mean_jitter_us),
+           static_cast<unsigned>(total.deadline_misses),
+           static_cast<unsigned>(total.max_response_us));
+  return passed;
+}
+
+/**
+ * @brief Test deferred conversion setup and warm start
+ *
+ * Checks that a deferred setup is built by the first reading, that the
+ * blob header is little-endian, that a restored blob skips the setup and
+ * resumes calibration and filter state reading for reading, and that
+ * corrupt, truncated and foreign blobs, including blobs saved against a
+ * lookup table with other contents, are rejected without touching the
+ * driver.
+ */
+static bool test_warm_start() noexcept {
+  constexpr float kCalibrationOffsetCelsius = 0.5F;
+  constexpr int kSettleReads = 8;
+  using Driver = NtcThermistor<MockEsp32Adc>;
+
+  ntc_config_t config = {};
+  if (g_ntc_driver->GetConfiguration(&config) != NtcError::Success) {
+    return false;
+  }
+  config.enable_filtering = true;
+  config.filter_alpha = 0.2F;
+  config.filter_mode = NtcFilterMode::Ema;
+  config.report_deadband_counts = 0U;
+  config.defer_conversion_setup = true;
+
+  // Cold boot: Initialize() leaves the setup to the first reading
+  Driver cold(config, g_mock_adc.get());
+  ntc_conversion_report_t report = {};
+  float threshold_celsius = 50.0F;
+  uint32_t threshold_count = 0U;
+  float cold_celsius = 0.0F;
+  bool passed =
+      cold.Initialize() && !cold.IsConversionPrepared() &&
+      cold.GetActiveConversionMethod() == NtcConversionMethod::Auto &&
+      cold.GetConversionReport(&report) == NtcError::NotInitialized &&
+      cold.ConvertTemperaturesToAdcCounts(&threshold_celsius,
+                                          &threshold_count, 1U) ==
+          NtcError::NotInitialized &&
+      cold.ReadTemperatureCelsius(&cold_celsius) == NtcError::Success &&
+      cold.IsConversionPrepared() &&
+      cold.GetActiveConversionMethod() != NtcConversionMethod::Auto &&
+      cold.GetConversionReport(&report) == NtcError::Success;
+
+  // Settle and calibrate, then save
+  passed = passed && cold.SetCalibrationOffset(kCalibrationOffsetCelsius) ==
+                         NtcError::Success;
+  for (int i = 0; passed && i < kSettleReads; ++i) {
+    passed = cold.ReadTemperatureCelsius(&cold_celsius) == NtcError::Success;
+  }
+  std::array<uint8_t, Driver::STATE_BLOB_SIZE_> blob = {};
+  passed = passed &&
+           cold.SaveState(blob.data(), blob.size() - 1U) ==
+               NtcError::OutOfMemory &&
+           cold.SaveState(blob.data(), blob.size()) == NtcError::Success &&
+           blob[0] == 'N' && blob[1] == 'T' && blob[2] == 'C' &&
+           blob[3] == 'W' && blob[4] == Driver::STATE_VERSION_ &&
+           blob[5] == 0U;
+
+  // Warm boot: nothing is built and the filter resumes where it stopped
+  Driver warm(config, g_mock_adc.get());
+  float warm_offset = 0.0F;
+  passed = passed &&
+           warm.RestoreState(blob.data(), blob.size()) ==
+               NtcError::NotInitialized &&
+           warm.Initialize() &&
+           warm.RestoreState(blob.data(), blob.size()) == NtcError::Success &&
+           warm.IsConversionPrepared() &&
+           warm.GetActiveConversionMethod() ==
+               cold.GetActiveConversionMethod() &&
+           warm.GetCalibrationOffset(&warm_offset) == NtcError::Success &&
+           warm_offset == kCalibrationOffsetCelsius;
+  for (int i = 0; passed && i < kSettleReads; ++i) {
+    float warm_celsius = 0.0F;
+    passed = cold.ReadTemperatureCelsius(&cold_celsius) == NtcError::Success &&
+             warm.ReadTemperatureCelsius(&warm_celsius) == NtcError::Success &&
+             warm_celsius == cold_celsius;
+  }
+
+  // Damaged and foreign blobs are rejected and leave the driver as it was
+  ntc_config_t other_config = config;
+  other_config.beta_value += 1.0F;
+  Driver other(other_config, g_mock_adc.get());
+  std::array<uint8_t, Driver::STATE_BLOB_SIZE_> corrupt = blob;
+  corrupt[Driver::STATE_BLOB_SIZE_ / 2U] ^= 0x01U;
+  passed = passed && other.Initialize() &&
+           other.RestoreState(corrupt.data(), corrupt.size()) ==
+               NtcError::InvalidParameter &&
+           other.RestoreState(blob.data(), blob.size() - 1U) ==
+               NtcError::InvalidParameter &&
+           other.RestoreState(blob.data(), blob.size()) ==
+               NtcError::InvalidParameter &&
+           !other.IsConversionPrepared() &&
+           other.PrepareConversion() == NtcError::Success &&
+           other.IsConversionPrepared();
+
+  // The fingerprint covers the lookup table contents, not its storage or
+  // extent: a copy restores, a copy with one entry moved does not
+  // The fingerprint covers the lookup table contents, not their storage:
+  // a blob saved against a copy of a table restores against the original,
+  // and is rejected by a table with the same extent and one entry moved
+  constexpr size_t kMaxEntries = 512U;
+  static NTC::ntc_lookup_entry_t copied_entries[kMaxEntries];
+  static NTC::ntc_lookup_entry_t moved_entries[kMaxEntries];
+  const NTC::ntc_lookup_table_t *part_table = NTC::GetNtcLookupTable(
+      static_cast<int>(NtcType::NtcG163Jf103Ft1S));
+  passed = passed && part_table != nullptr &&
+           part_table->entry_count <= kMaxEntries;
+  for (size_t i = 0; passed && i < part_table->entry_count; ++i) {
+    passed = NTC::GetLookupTableEntry(part_table, i, &copied_entries[i]);
+    moved_entries[i] = copied_entries[i];
+  }
+  if (!passed) {
+    return false;
+  }
+  const size_t middle = part_table->entry_count / 2U;
+  moved_entries[middle].temperature_celsius =
+      (moved_entries[middle].temperature_celsius +
+       moved_entries[middle + 1U].temperature_celsius) /
+      2.0F;
+  NTC::ntc_lookup_table_t copied_table = *part_table;
+  copied_table.entries = copied_entries;
+  copied_table.temperature_codes = nullptr;
+  copied_table.temperature_code_step = 0.0F;
+  copied_table.temperature_index = nullptr;
+  copied_table.temperature_index_count = 0U;
+  copied_table.inverse_index_step = 0.0F;
+  NTC::ntc_lookup_table_t moved_table = copied_table;
+  moved_table.entries = moved_entries;
+  Driver copied(config, g_mock_adc.get());
+  Driver original(config, g_mock_adc.get());
+  Driver moved(config, g_mock_adc.get());
+  std::array<uint8_t, Driver::STATE_BLOB_SIZE_> table_blob = {};
+  passed = passed && copied.Initialize() && original.Initialize() &&
+           moved.Initialize() &&
+           copied.SetLookupTable(&copied_table) == NtcError::Success &&
+           original.SetLookupTable(part_table) == NtcError::Success &&
+           moved.SetLookupTable(&moved_table) == NtcError::Success &&
+           copied.PrepareConversion() == NtcError::Success &&
+           copied.SaveState(table_blob.data(), table_blob.size()) ==
+               NtcError::Success &&
+           original.RestoreState(table_blob.data(), table_blob.size()) ==
+               NtcError::Success &&
+           moved.RestoreState(table_blob.data(), table_blob.size()) ==
+               NtcError::InvalidParameter &&
+           !moved.IsConversionPrepared();
+
+  ESP_LOGI(TAG, "Warm start: %u byte blob, resumed at %.3f°C",
+           static_cast<unsigned>(blob.size()), cold_celsius);
+  return passed;
+}
+
 //=============================================================================
 // MAIN TEST RUNNER
 //=============================================================================
@@ -130,6 +2471,129 @@ extern "C" void app_main() {
       ENABLE_BASIC_TESTS, "NTC THERMISTOR BASIC TESTS", 5,
       RUN_TEST_IN_TASK("basic_initialization", test_basic_initialization, 8192,
                        1);
+      RUN_TEST_IN_TASK("single_acquisition_reading",
+                       test_single_acquisition_reading, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_FAST_LOG_TESTS, "NTC THERMISTOR FAST LOG TESTS", 5,
+      RUN_TEST_IN_TASK("fast_log_accuracy_and_speed",
+                       test_fast_log_accuracy_and_speed, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_BATCH_CONVERSION_TESTS, "NTC THERMISTOR BATCH CONVERSION TESTS", 5,
+      RUN_TEST_IN_TASK("batch_conversion_masks", test_batch_conversion_masks,
+                       8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_FIXED_POINT_TESTS, "NTC THERMISTOR FIXED-POINT TESTS", 5,
+      RUN_TEST_IN_TASK("fixed_point_accuracy_and_speed",
+                       test_fixed_point_accuracy_and_speed, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_STATIC_DRIVER_TESTS, "NTC THERMISTOR STATIC DRIVER TESTS", 5,
+      RUN_TEST_IN_TASK("static_driver_matches_runtime",
+                       test_static_driver_matches_runtime, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_CONVERSION_METHOD_TESTS, "NTC THERMISTOR CONVERSION METHOD TESTS",
+      5,
+      RUN_TEST_IN_TASK("auto_conversion_selection",
+                       test_auto_conversion_selection, 8192, 1);
+      RUN_TEST_IN_TASK("count_table_fractional_counts",
+                       test_count_table_fractional_counts, 8192, 1);
+      RUN_TEST_IN_TASK("setter_re_resolution", test_setter_re_resolution,
+                       8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_STATS_TESTS, "NTC THERMISTOR STATISTICS TESTS", 5,
+      RUN_TEST_IN_TASK("stats_counters", test_stats_counters, 8192, 1);
+      RUN_TEST_IN_TASK("async_stats", test_async_stats, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_LOOKUP_TABLE_TESTS, "NTC THERMISTOR LOOKUP TABLE TESTS", 5,
+      RUN_TEST_IN_TASK("uniform_lookup_matches_search",
+                       test_uniform_lookup_matches_search, 8192, 1);
+      RUN_TEST_IN_TASK("reverse_lookup_matches_search",
+                       test_reverse_lookup_matches_search, 8192, 1);
+      RUN_TEST_IN_TASK("compact_lookup_table", test_compact_lookup_table, 8192,
+                       1);
+      RUN_TEST_IN_TASK("runtime_lookup_table", test_runtime_lookup_table, 8192,
+                       1);
+      RUN_TEST_IN_TASK("lookup_table_spacing", test_lookup_table_spacing,
+                       8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_HISTORY_TESTS, "NTC THERMISTOR HISTORY TESTS", 5,
+      RUN_TEST_IN_TASK("history_window", test_history_window, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_SAMPLING_TESTS, "NTC THERMISTOR SAMPLING TESTS", 5,
+      RUN_TEST_IN_TASK("sampling_strategies", test_sampling_strategies, 8192,
+                       1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_BURST_TESTS, "NTC THERMISTOR BURST ACQUISITION TESTS", 5,
+      RUN_TEST_IN_TASK("burst_acquisition", test_burst_acquisition, 8192, 1);
+      RUN_TEST_IN_TASK("array_scan_hook", test_array_scan_hook, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_ARRAY_TESTS, "NTC THERMISTOR ARRAY TESTS", 5,
+      RUN_TEST_IN_TASK("array_matches_scalar", test_array_matches_scalar, 8192,
+                       1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_SNAPSHOT_TESTS, "NTC THERMISTOR SNAPSHOT TESTS", 5,
+      RUN_TEST_IN_TASK("reading_snapshot", test_reading_snapshot, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_CHANGE_DETECTION_TESTS, "NTC THERMISTOR CHANGE DETECTION TESTS",
+      5, RUN_TEST_IN_TASK("change_detection", test_change_detection, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_PACKED_FORMAT_TESTS, "NTC THERMISTOR PACKED FORMAT TESTS", 5,
+      RUN_TEST_IN_TASK("packed_reading_format", test_packed_reading_format,
+                       8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_TIMESTAMP_TESTS, "NTC THERMISTOR TIMESTAMP TESTS", 5,
+      RUN_TEST_IN_TASK("reading_timestamps", test_reading_timestamps, 8192,
+                       1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_FILTER_MODE_TESTS, "NTC THERMISTOR FILTER MODE TESTS", 5,
+      RUN_TEST_IN_TASK("filter_modes", test_filter_modes, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_ADAPTIVE_SAMPLING_TESTS, "NTC THERMISTOR ADAPTIVE SAMPLING TESTS",
+      5,
+      RUN_TEST_IN_TASK("adaptive_sampling", test_adaptive_sampling, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_SCAN_SCHEDULER_TESTS, "NTC THERMISTOR SCAN SCHEDULER TESTS", 5,
+      RUN_TEST_IN_TASK("scan_scheduler", test_scan_scheduler, 8192, 1);
+      flip_test_progress_indicator(););
+
+  RUN_TEST_SECTION_IF_ENABLED_WITH_PATTERN(
+      ENABLE_WARM_START_TESTS, "NTC THERMISTOR WARM START TESTS", 5,
+      RUN_TEST_IN_TASK("warm_start", test_warm_start, 8192, 1);
       flip_test_progress_indicator(););
 
   // Cleanup
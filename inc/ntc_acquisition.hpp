@@ -0,0 +1,252 @@
+/**
+ * @file ntc_acquisition.hpp
+ * @brief Acquisition and ADC count table helpers shared by the drivers.
+ *
+ * This header holds the building blocks every driver (NtcThermistor,
+ * NtcThermistorArray, NtcThermistorQ, StaticNtcThermistor) uses the same
+ * way: configuration checks, the oversampling loop with its optional
+ * ReadChannelBurst() path, acquisition timestamps, ADC error mapping and the
+ * integer ADC count -> temperature table. Keeping them in one place keeps
+ * the drivers' read paths identical.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_ACQUISITION_H
+#define NTC_ACQUISITION_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ntc_adc_interface.hpp"
+#include "ntc_types.hpp"
+
+namespace NTC::Acquisition {
+
+//--------------------------------------
+//  Constants
+//--------------------------------------
+
+constexpr uint32_t BURST_CHUNK_SAMPLES_ =
+    32U; ///< Samples per ReadChannelBurst() call
+constexpr uint32_t MAX_ORDERED_SAMPLES_ =
+    BURST_CHUNK_SAMPLES_; ///< Samples held by Median and TrimmedMean
+constexpr uint32_t COUNT_FRACTION_BITS_ =
+    8U; ///< Fractional bits of reduced ADC counts
+
+// ADC count -> temperature table (NtcConversionMethod::AdcCountTable)
+constexpr uint32_t COUNT_TABLE_SEGMENTS_LOG2_ =
+    8U; ///< log2 of the interpolation segment count
+constexpr uint32_t COUNT_TABLE_SEGMENTS_ =
+    1U << COUNT_TABLE_SEGMENTS_LOG2_; ///< Segments across the ADC range
+constexpr int16_t COUNT_TABLE_INVALID_ =
+    INT16_MIN; ///< Marks table nodes outside the convertible range
+
+/// Temperatures at the count table nodes (0.01°C)
+using CountTable = std::array<int16_t, COUNT_TABLE_SEGMENTS_ + 1U>;
+
+//--------------------------------------
+//  Types
+//--------------------------------------
+
+/**
+ * @brief Accumulated counts of one oversampled acquisition
+ */
+struct ntc_count_sum_t {
+  uint64_t sum;             ///< Sum of the valid sample counts
+  uint32_t conversions;     ///< ADC conversions attempted
+  uint32_t valid_samples;   ///< Conversions that completed successfully
+  ntc::AdcError last_error; ///< Last ADC error seen (Success if none)
+};
+
+//--------------------------------------
+//  Configuration Checks
+//--------------------------------------
+
+/**
+ * @brief Validate a driver configuration
+ * @param config Configuration to validate
+ * @return NtcError::Success or NtcError::InvalidParameter
+ */
+[[nodiscard]] inline NtcError
+ValidateConfiguration(const ntc_config_t &config) noexcept;
+
+/**
+ * @brief Check a sample count against a sampling strategy
+ * @param sample_count Number of samples
+ * @param strategy Sampling strategy
+ * @return true if the strategy is known and can hold sample_count samples
+ */
+[[nodiscard]] inline bool
+IsValidSamplingPlan(uint32_t sample_count,
+                    NtcSamplingStrategy strategy) noexcept;
+
+/**
+ * @brief Check the parameters of a filter mode
+ * @param config Configuration holding the filter parameters
+ * @return true if the parameters are usable
+ */
+[[nodiscard]] inline bool
+IsValidFilterMode(const ntc_config_t &config) noexcept;
+
+//--------------------------------------
+//  Acquisition
+//--------------------------------------
+
+/**
+ * @brief Acquire sample_count raw counts from one channel
+ *
+ * Uses the ADC's ReadChannelBurst() hook in chunks of BURST_CHUNK_SAMPLES_
+ * when it has one and sample_delay_ms is 0, otherwise one
+ * ReadChannelCount() call per sample with sample_delay_ms between samples.
+ * A failed chunk counts all its samples as attempted and none as valid.
+ *
+ * @param adc ADC interface (not nullptr)
+ * @param channel ADC channel
+ * @param sample_count Number of samples (at least 1)
+ * @param sample_delay_ms Delay between samples (ms)
+ * @param counts Array to store the valid counts in order, or nullptr; must
+ *        hold sample_count entries
+ * @return Accumulated counts
+ */
+template <typename AdcType>
+ntc_count_sum_t AcquireCounts(AdcType *adc, uint8_t channel,
+                              uint32_t sample_count, uint32_t sample_delay_ms,
+                              uint32_t *counts) noexcept;
+
+/**
+ * @brief Run sample_count reads with sample_delay_ms between them
+ * @param sample_count Number of reads
+ * @param sample_delay_ms Delay between reads (ms)
+ * @param read Callable invoked once per read
+ */
+template <typename ReadFn>
+void RunPacedReads(uint32_t sample_count, uint32_t sample_delay_ms,
+                   ReadFn read) noexcept;
+
+/**
+ * @brief Get the error of an acquisition without a valid sample
+ *
+ * Single-sample reads keep the ADC's error; a failed burst reports
+ * NtcError::AdcReadFailed.
+ *
+ * @param sample_count Number of samples of the acquisition
+ * @param last_error Last ADC error seen
+ * @return Driver error code
+ */
+[[nodiscard]] inline NtcError
+NoValidSampleError(uint32_t sample_count, ntc::AdcError last_error) noexcept;
+
+/**
+ * @brief Convert ADC error code to driver error code
+ * @param error ADC error code
+ * @return Driver error code
+ */
+[[nodiscard]] inline NtcError ConvertAdcError(ntc::AdcError error) noexcept;
+
+/**
+ * @brief Busy-wait for approximately the given time
+ * @param delay_ms Delay (ms)
+ */
+inline void DelayMilliseconds(uint32_t delay_ms) noexcept;
+
+/**
+ * @brief Read the ADC type's acquisition clock
+ * @param adc ADC interface (may be nullptr)
+ * @return Time (µs), 0 without the ReadTimestampUs() hook
+ */
+template <typename AdcType>
+[[nodiscard]] uint64_t ReadTimestampUs(AdcType *adc) noexcept;
+
+/**
+ * @brief Get the midpoint of a sampling window
+ * @param start_us Time of the first sample (µs)
+ * @param end_us Time of the last sample (µs)
+ * @return Midpoint (µs), start_us if the clock went backwards
+ */
+[[nodiscard]] constexpr uint64_t WindowMidpointUs(uint64_t start_us,
+                                                  uint64_t end_us) noexcept {
+  return (end_us > start_us) ? start_us + ((end_us - start_us) / 2U)
+                             : start_us;
+}
+
+/**
+ * @brief Convert a reduced count to fixed point
+ *
+ * Keeps COUNT_FRACTION_BITS_ of the fraction that integer division would
+ * drop, rounded to nearest.
+ *
+ * @param numerator Reduced count numerator (e.g. a sum of counts)
+ * @param divisor Reduced count divisor (at least 1)
+ * @return numerator / divisor with COUNT_FRACTION_BITS_ fractional bits
+ */
+[[nodiscard]] constexpr uint64_t FixedPointCount(uint64_t numerator,
+                                                 uint32_t divisor) noexcept {
+  // Split off the whole part so the shift cannot overflow
+  const uint64_t remainder = numerator % divisor;
+  return ((numerator / divisor) << COUNT_FRACTION_BITS_) +
+         (((remainder << COUNT_FRACTION_BITS_) + (divisor / 2U)) / divisor);
+}
+
+//--------------------------------------
+//  ADC Count Table
+//--------------------------------------
+
+/**
+ * @brief Get the node spacing of the count table for an ADC resolution
+ *
+ * Nodes are spaced 2^shift counts apart so a read needs only a shift and a
+ * mask to find its segment.
+ *
+ * @param adc_resolution_bits ADC resolution (bits)
+ * @return log2(ADC counts per table segment)
+ */
+[[nodiscard]] constexpr uint32_t
+CountTableShift(uint32_t adc_resolution_bits) noexcept {
+  return (adc_resolution_bits > COUNT_TABLE_SEGMENTS_LOG2_)
+             ? adc_resolution_bits - COUNT_TABLE_SEGMENTS_LOG2_
+             : 0U;
+}
+
+/**
+ * @brief Fill the count table from a count -> temperature conversion
+ *
+ * Nodes the conversion rejects, or whose temperature does not fit in
+ * int16_t centi-degrees, are marked COUNT_TABLE_INVALID_.
+ *
+ * @param shift Node spacing (see CountTableShift())
+ * @param convert Callable `bool(float count, float *temperature_celsius)`
+ * @param table Table to fill
+ */
+template <typename ConvertFn>
+void FillCountTable(uint32_t shift, ConvertFn convert,
+                    CountTable *table) noexcept;
+
+/**
+ * @brief Interpolate the count table at a fixed-point ADC count
+ *
+ * The count carries segment_shift - table shift fractional bits, so an
+ * averaged count keeps its fraction through the interpolation.
+ *
+ * @param table Count table
+ * @param segment_shift Table shift plus the count's fractional bits
+ * @param count_q ADC count in fixed point
+ * @param temperature_centi_celsius Pointer to store temperature (0.01°C)
+ * @return true if the count lies inside the table's convertible range
+ */
+[[nodiscard]] inline bool InterpolateCountTable(
+    const CountTable &table, uint32_t segment_shift, uint64_t count_q,
+    int32_t *temperature_centi_celsius) noexcept;
+
+} // namespace NTC::Acquisition
+
+// Include implementation
+#define NTC_ACQUISITION_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Template implementation file
+#include "../src/ntc_acquisition.cpp"
+#undef NTC_ACQUISITION_HEADER_INCLUDED
+
+#endif // NTC_ACQUISITION_H
@@ -0,0 +1,233 @@
+/**
+ * @file ntc_adaptive_sampler.hpp
+ * @brief Slope- and threshold-driven read scheduling for NtcThermistor.
+ *
+ * This header provides a scheduler that reads a thermistor rarely and with
+ * few samples while its temperature is flat and far from the watched limits,
+ * and escalates the read rate and sample count as the temperature moves or
+ * approaches a limit. It exposes the next due time so one task can service
+ * many sensors.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_ADAPTIVE_SAMPLER_H
+#define NTC_ADAPTIVE_SAMPLER_H
+
+#include <cstdint>
+
+#include "ntc_thermistor.hpp"
+#include "ntc_types.hpp"
+
+//--------------------------------------
+//  NtcAdaptiveSampler Class
+//--------------------------------------
+
+/**
+ * @class NtcAdaptiveSampler
+ * @brief Adaptive read scheduler for one NtcThermistor
+ *
+ * After every read the sampler rates its urgency from 0 to 1 as the larger
+ * of:
+ *
+ * - |dT/dt| between the last two reads over full_rate_slope_celsius_per_second;
+ * - how far the temperature has entered limit_margin_celsius of
+ *   low_limit_celsius or high_limit_celsius.
+ *
+ * The next interval runs geometrically from max_interval_ms (urgency 0) to
+ * min_interval_ms (urgency 1), and sample_count linearly from
+ * min_sample_count to max_sample_count. Escalation takes effect at once; on
+ * the way down the urgency falls by at most one doubling of the interval per
+ * read, so a single flat read does not end an escalation. A failed read is
+ * retried at min_interval_ms.
+ *
+ * Reads use the thermistor's ReadTemperatureIfChanged(). A configured report
+ * deadband skips conversion of unchanged readings and doubles as the noise
+ * floor of the slope: a read within it counts as flat, and the next reported
+ * reading takes its slope from the last reported one. The sampler
+ * changes the thermistor's sample_count (keeping sample_delay_ms) and keeps
+ * no other state in it.
+ *
+ * @tparam AdcType ADC implementation type of the thermistor
+ *
+ * @example
+ * @code
+ * NtcAdaptiveSampler<MyAdc> sampler(&thermistor);
+ * sampler.Initialize();
+ * // Sampling task:
+ * ntc_reading_t reading = {};
+ * if (sampler.Service(now_us, &reading) == NtcConversionStatus::Complete) {
+ *   // ... use reading ...
+ * }
+ * sleep_until(sampler.NextDueUs());
+ * @endcode
+ */
+template <typename AdcType> class NtcAdaptiveSampler {
+public:
+  /// Largest factor the interval grows by per read while relaxing
+  static constexpr uint32_t MAX_INTERVAL_GROWTH_ = 2U;
+
+  //==============================================================//
+  // CONSTRUCTORS
+  //==============================================================//
+
+  /**
+   * @brief Construct a sampler for a thermistor
+   * @param thermistor Thermistor to read (must outlive the sampler)
+   * @param config Adaptive sampling configuration
+   */
+  explicit NtcAdaptiveSampler(
+      NtcThermistor<AdcType> *thermistor,
+      const ntc_adaptive_config_t &config =
+          GetDefaultNtcAdaptiveConfig()) noexcept;
+
+  //==============================================================//
+  // INITIALIZATION AND CONFIGURATION
+  //==============================================================//
+
+  /**
+   * @brief Validate the configuration and schedule the first read
+   *
+   * The first Service() call reads at once and at full urgency.
+   *
+   * @return true if the configuration is valid and the thermistor is
+   *         initialized
+   */
+  bool Initialize() noexcept;
+
+  /**
+   * @brief Set the adaptive sampling configuration
+   *
+   * Restarts at full urgency, like Reset().
+   *
+   * @param config Adaptive sampling configuration
+   * @return Error code (InvalidParameter if the bounds are inconsistent)
+   */
+  NtcError SetConfiguration(const ntc_adaptive_config_t &config) noexcept;
+
+  /**
+   * @brief Get the adaptive sampling configuration
+   * @param config Pointer to store the configuration
+   * @return Error code
+   */
+  NtcError GetConfiguration(ntc_adaptive_config_t *config) const noexcept;
+
+  /**
+   * @brief Forget the slope and read at full urgency on the next Service()
+   */
+  void Reset() noexcept;
+
+  //==============================================================//
+  // SCHEDULING
+  //==============================================================//
+
+  /**
+   * @brief Read the thermistor if it is due
+   * @param now_us Current time (µs, any monotonic time base)
+   * @param reading Pointer to store the reading
+   * @return Idle if not due, not initialized or reading is nullptr;
+   *         Complete once reading is filled in (check reading->error);
+   *         Unchanged if the read was within the thermistor's report
+   *         deadband (reading untouched)
+   */
+  NtcConversionStatus Service(uint64_t now_us,
+                              ntc_reading_t *reading) noexcept;
+
+  /**
+   * @brief Check if the next read is due
+   * @param now_us Current time (same time base as Service())
+   * @return true if Service() would read at now_us
+   */
+  [[nodiscard]] bool IsDue(uint64_t now_us) const noexcept;
+
+  /**
+   * @brief Get the time the next read is due
+   * @return Due time (same time base as Service())
+   */
+  [[nodiscard]] uint64_t NextDueUs() const noexcept;
+
+  /**
+   * @brief Get the current read interval
+   * @return Interval (ms)
+   */
+  [[nodiscard]] uint32_t GetIntervalMs() const noexcept;
+
+  /**
+   * @brief Get the sample count of the next read
+   * @return Samples per read
+   */
+  [[nodiscard]] uint32_t GetSampleCount() const noexcept;
+
+  /**
+   * @brief Get the urgency of the last read
+   * @return Urgency (0 = flat and safe, 1 = full rate)
+   */
+  [[nodiscard]] float GetUrgency() const noexcept;
+
+  /**
+   * @brief Get the temperature slope between the last two reads
+   * @return Slope (°C/s)
+   */
+  [[nodiscard]] float GetSlopeCelsiusPerSecond() const noexcept;
+
+private:
+  //==============================================================//
+  // PRIVATE MEMBER VARIABLES
+  //==============================================================//
+
+  NtcThermistor<AdcType> *thermistor_; ///< Thermistor read
+  ntc_adaptive_config_t config_;       ///< Adaptive sampling configuration
+  bool initialized_;                   ///< Initialization status
+
+  uint64_t next_due_us_;  ///< Time the next read is due
+  uint32_t interval_ms_;  ///< Current read interval (ms)
+  uint32_t sample_count_; ///< sample_count of the next read
+  float urgency_;         ///< Urgency of the last read (0-1)
+  float slope_celsius_per_second_; ///< Slope between the last two reads
+
+  float last_temperature_celsius_; ///< Temperature of the last read (°C)
+  uint64_t last_read_us_;          ///< Time of the last read
+  bool has_last_read_;             ///< last_* describe a valid read
+
+  //==============================================================//
+  // PRIVATE HELPER METHODS
+  //==============================================================//
+
+  /**
+   * @brief Check an adaptive sampling configuration
+   * @param config Configuration to check
+   * @return true if the bounds are consistent
+   */
+  [[nodiscard]] static bool
+  isValidConfiguration(const ntc_adaptive_config_t &config) noexcept;
+
+  /**
+   * @brief Rate the urgency of a reading
+   * @param temperature_celsius Temperature of the reading (°C)
+   * @return Urgency (0-1)
+   */
+  [[nodiscard]] float
+  rateUrgency(float temperature_celsius) const noexcept;
+
+  /**
+   * @brief Derive the interval and sample count from the urgency
+   * @param urgency Urgency of the last read (0-1), before relax limiting
+   */
+  void applyUrgency(float urgency) noexcept;
+
+  /**
+   * @brief Set the thermistor's sample_count if it differs
+   * @return Error code of the thermistor
+   */
+  NtcError applySampleCount() noexcept;
+};
+
+// Include template implementation
+#define NTC_ADAPTIVE_SAMPLER_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Template implementation file
+#include "../src/ntc_adaptive_sampler.cpp"
+#undef NTC_ADAPTIVE_SAMPLER_HEADER_INCLUDED
+
+#endif // NTC_ADAPTIVE_SAMPLER_H
@@ -15,7 +15,10 @@
 #ifndef NTC_ADC_INTERFACE_H
 #define NTC_ADC_INTERFACE_H
 
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 
 namespace ntc {
 
@@ -43,6 +46,12 @@ enum class AdcError : uint8_t {
  * - Static dispatch instead of dynamic dispatch
  * - Better optimization opportunities for the compiler
  *
+ * Optional hooks (ReadChannelsCount(), ReadChannelBurst()) let ADCs with a
+ * sequencer or DMA acquire several samples per call; see
+ * HasReadChannelBurst. ReadCycleCounter() feeds the driver's cycle timing;
+ * see HasReadCycleCounter. ReadTimestampUs() stamps readings with their
+ * acquisition time; see HasReadTimestampUs.
+ *
  * Example usage:
  * @code
  * class Esp32C6Adc : public ntc::AdcInterface<Esp32C6Adc> {
@@ -93,6 +102,32 @@ public:
     return static_cast<Derived *>(this)->ReadChannelCount(channel, count);
   }
 
+  /**
+   * @brief Read raw ADC counts from several channels in one scan
+   *
+   * The default reads the channels one after another through
+   * ReadChannelCount(). ADCs with a hardware sequencer can define their own
+   * ReadChannelsCount() with this signature in the derived class to convert
+   * all channels in a single scan; callers holding the derived type pick it
+   * up at compile time.
+   *
+   * @param channels Array of ADC channels to read
+   * @param counts Array to store the raw count of each channel
+   * @param channel_count Number of channels
+   * @return AdcError::Success if every channel was read, error code otherwise
+   */
+  AdcError ReadChannelsCount(const uint8_t *channels, uint32_t *counts,
+                             size_t channel_count) {
+    for (size_t i = 0; i < channel_count; ++i) {
+      AdcError err = static_cast<Derived *>(this)->ReadChannelCount(
+          channels[i], &counts[i]);
+      if (err != AdcError::Success) {
+        return err;
+      }
+    }
+    return AdcError::Success;
+  }
+
   /**
    * @brief Read voltage value from specified channel
    * @param channel ADC channel to read from
@@ -140,6 +175,76 @@ protected:
   ~AdcInterface() = default;
 };
 
+/**
+ * @brief Detects the optional ReadChannelBurst() hook of an ADC type
+ *
+ * An ADC implementation may provide
+ * `AdcError ReadChannelBurst(uint8_t channel, uint32_t *counts, size_t count)`
+ * to acquire count samples of one channel in a single transfer (e.g.
+ * continuous mode with DMA). The driver uses it for oversampling when it is
+ * present and falls back to one ReadChannelCount() call per sample
+ * otherwise. The hook must fill all count samples or return an error.
+ *
+ * @tparam AdcType ADC implementation type
+ */
+template <typename AdcType, typename = void>
+struct HasReadChannelBurst : std::false_type {};
+
+/**
+ * @brief HasReadChannelBurst specialization for ADC types with the hook
+ */
+template <typename AdcType>
+struct HasReadChannelBurst<
+    AdcType, std::void_t<decltype(std::declval<AdcType &>().ReadChannelBurst(
+                 std::declval<uint8_t>(), std::declval<uint32_t *>(),
+                 std::declval<size_t>()))>> : std::true_type {};
+
+/**
+ * @brief Detects the optional ReadCycleCounter() hook of an ADC type
+ *
+ * An ADC implementation may provide `uint32_t ReadCycleCounter()` returning
+ * a free-running cycle counter (e.g. esp_cpu_get_cycle_count() or DWT
+ * CYCCNT). With NTC_ENABLE_STATS set the driver times its read stages with
+ * it; wrap-around is handled. Without the hook stage cycles stay 0.
+ *
+ * @tparam AdcType ADC implementation type
+ */
+template <typename AdcType, typename = void>
+struct HasReadCycleCounter : std::false_type {};
+
+/**
+ * @brief HasReadCycleCounter specialization for ADC types with the hook
+ */
+template <typename AdcType>
+struct HasReadCycleCounter<
+    AdcType,
+    std::void_t<decltype(std::declval<AdcType &>().ReadCycleCounter())>>
+    : std::true_type {};
+
+/**
+ * @brief Detects the optional ReadTimestampUs() hook of an ADC type
+ *
+ * An ADC implementation may provide `uint64_t ReadTimestampUs()` returning a
+ * monotonic time in microseconds (e.g. esp_timer_get_time() or a timer
+ * capture). The driver reads it around each acquisition and stamps readings
+ * with the midpoint of the sampling window, so downstream consumers get the
+ * acquisition time rather than the time they happened to look. Without the
+ * hook synchronous readings carry timestamp 0.
+ *
+ * @tparam AdcType ADC implementation type
+ */
+template <typename AdcType, typename = void>
+struct HasReadTimestampUs : std::false_type {};
+
+/**
+ * @brief HasReadTimestampUs specialization for ADC types with the hook
+ */
+template <typename AdcType>
+struct HasReadTimestampUs<
+    AdcType,
+    std::void_t<decltype(std::declval<AdcType &>().ReadTimestampUs())>>
+    : std::true_type {};
+
 } // namespace ntc
 
 #endif // NTC_ADC_INTERFACE_H
@@ -19,7 +19,9 @@
 #define NTC_CONVERSION_H
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 //--------------------------------------
 //  Conversion Constants
@@ -59,6 +61,8 @@ constexpr float ZERO_FLOAT_ = 0.0F;       ///< Zero as float
 // Time conversion constants
 constexpr uint32_t MILLISECONDS_PER_SECOND_ =
     1000U; ///< Milliseconds per second
+constexpr float MICROSECONDS_PER_SECOND_ =
+    1000000.0F; ///< Microseconds per second
 
 // Temperature conversion constants
 constexpr float CELSIUS_TO_FAHRENHEIT_MULTIPLIER_ =
@@ -68,6 +72,59 @@ constexpr float FAHRENHEIT_TO_CELSIUS_MULTIPLIER_ =
     5.0F / 9.0F; ///< Fahrenheit to Celsius multiplier
 } // namespace NTC::Constants
 
+//--------------------------------------
+//  Fast Math
+//--------------------------------------
+
+namespace NTC {
+
+/**
+ * @brief Fast natural logarithm approximation
+ *
+ * Splits x into 2^k * m with m in [sqrt(1/2), sqrt(2)) using its IEEE-754
+ * bit pattern and evaluates a degree-5 polynomial for ln(m). The absolute
+ * error is below 4e-5 for all positive normal inputs, which is below 0.01°C
+ * in beta and Steinhart-Hart conversions over -40..125°C (about 0.002°C for
+ * β=3435K). Needs only multiplies and adds, so it is much cheaper than
+ * std::log on MCUs without a hardware log unit.
+ *
+ * @param x Argument, must be a positive normal float
+ * @return Approximation of ln(x)
+ */
+[[nodiscard]] inline float FastLog(float x) noexcept {
+  static_assert(sizeof(float) == sizeof(uint32_t),
+                "FastLog requires 32-bit IEEE-754 floats");
+  constexpr uint32_t ONE_BITS_ = 0x3F800000U;       // 1.0F
+  constexpr uint32_t SQRT_HALF_BITS_ = 0x3F3504F3U; // sqrt(0.5F)
+  constexpr uint32_t MANTISSA_MASK_ = 0x007FFFFFU;
+  constexpr int32_t MANTISSA_BITS_ = 23;
+  constexpr int32_t EXPONENT_BIAS_ = 127;
+  constexpr float LN2_ = 0.693147180559945F;
+  // Fit of (ln(1 + f) - f) / f^2 on [sqrt(0.5) - 1, sqrt(2) - 1]
+  constexpr float C0_ = -0.4997762111F;
+  constexpr float C1_ = 0.3352615257F;
+  constexpr float C2_ = -0.2669345403F;
+  constexpr float C3_ = 0.1784898835F;
+
+  uint32_t bits = 0;
+  std::memcpy(&bits, &x, sizeof(bits));
+
+  // Bias so mantissas at or above sqrt(2) carry into the exponent
+  bits += ONE_BITS_ - SQRT_HALF_BITS_;
+  const int32_t exponent =
+      static_cast<int32_t>(bits >> MANTISSA_BITS_) - EXPONENT_BIAS_;
+  bits = (bits & MANTISSA_MASK_) + SQRT_HALF_BITS_;
+
+  float mantissa = 0.0F;
+  std::memcpy(&mantissa, &bits, sizeof(mantissa));
+
+  const float f = mantissa - 1.0F;
+  const float q = C0_ + (f * (C1_ + (f * (C2_ + (f * C3_)))));
+  return (static_cast<float>(exponent) * LN2_) + f + (f * f * q);
+}
+
+} // namespace NTC
+
 //--------------------------------------
 //  Conversion Methods
 //--------------------------------------
@@ -98,6 +155,22 @@ bool ConvertResistanceToTemperatureBeta(float resistance_ohms,
                                         float beta_value,
                                         float *temperature_celsius) noexcept;
 
+/**
+ * @brief Convert resistance to temperature using beta parameter and FastLog()
+ *
+ * Same as ConvertResistanceToTemperatureBeta() with std::log replaced by
+ * FastLog(). Adds less than 0.01°C of error over -40..125°C.
+ *
+ * @param resistance_ohms Thermistor resistance (ohms)
+ * @param resistance_at_25c Resistance at 25°C (ohms)
+ * @param beta_value Beta value (K)
+ * @param temperature_celsius Pointer to store temperature (°C)
+ * @return true if successful, false otherwise
+ */
+bool ConvertResistanceToTemperatureBetaFast(
+    float resistance_ohms, float resistance_at_25c, float beta_value,
+    float *temperature_celsius) noexcept;
+
 /**
  * @brief Convert temperature to resistance using beta parameter
  * @param temperature_celsius Temperature (°C)
@@ -136,6 +209,23 @@ bool ConvertResistanceToTemperatureSteinhartHart(
     float resistance_ohms, float coeff_a, float coeff_b, float coeff_c,
     float *temperature_celsius) noexcept;
 
+/**
+ * @brief Convert resistance to temperature using Steinhart-Hart and FastLog()
+ *
+ * Same as ConvertResistanceToTemperatureSteinhartHart() with std::log
+ * replaced by FastLog(). Adds less than 0.01°C of error over -40..125°C.
+ *
+ * @param resistance_ohms Thermistor resistance (ohms)
+ * @param coeff_a Steinhart-Hart coefficient A
+ * @param coeff_b Steinhart-Hart coefficient B
+ * @param coeff_c Steinhart-Hart coefficient C
+ * @param temperature_celsius Pointer to store temperature (°C)
+ * @return true if successful, false otherwise
+ */
+bool ConvertResistanceToTemperatureSteinhartHartFast(
+    float resistance_ohms, float coeff_a, float coeff_b, float coeff_c,
+    float *temperature_celsius) noexcept;
+
 /**
  * @brief Convert temperature to resistance using Steinhart-Hart equation
  * @param temperature_celsius Temperature (°C)
@@ -209,6 +299,94 @@ bool CalculateVoltageDividerRatio(float resistance_ohms,
                                   float series_resistance,
                                   float *ratio) noexcept;
 
+//--------------------------------------
+//  Batch Conversions
+//--------------------------------------
+
+/**
+ * @brief Number of bytes needed for a batch out-of-range mask
+ *
+ * Batch conversions report out-of-range elements in a bit mask: bit (i % 8)
+ * of byte (i / 8) is set when element i was out of range.
+ *
+ * @param count Number of batch elements
+ * @return Mask size in bytes
+ */
+[[nodiscard]] constexpr size_t BatchMaskBytes(size_t count) noexcept {
+  return (count + 7U) / 8U;
+}
+
+/**
+ * @brief Convert an array of resistances to temperatures (beta parameter)
+ *
+ * The conversion loop has no per-element branches or error checks so the
+ * compiler can vectorize it. Resistances outside the valid range are
+ * clamped before conversion and flagged in out_of_range_mask instead of
+ * aborting the batch. Converting in place (temperatures_celsius ==
+ * resistances_ohms) is allowed.
+ *
+ * @param resistances_ohms Array of thermistor resistances (ohms)
+ * @param temperatures_celsius Array to store temperatures (°C)
+ * @param count Number of elements
+ * @param resistance_at_25c Resistance at 25°C (ohms)
+ * @param beta_value Beta value (K)
+ * @param out_of_range_mask Mask of BatchMaskBytes(count) bytes to store
+ *        out-of-range flags (nullable)
+ * @return true if every element was in range, false otherwise (also false
+ *         with every flag set if the parameters are invalid)
+ */
+bool ConvertResistanceToTemperatureBeta(const float *resistances_ohms,
+                                        float *temperatures_celsius,
+                                        size_t count, float resistance_at_25c,
+                                        float beta_value,
+                                        uint8_t *out_of_range_mask) noexcept;
+
+/**
+ * @brief Convert an array of resistances to temperatures (Steinhart-Hart)
+ *
+ * Batch counterpart of the scalar Steinhart-Hart conversion, with the same
+ * clamping, masking and aliasing rules as the beta batch conversion.
+ *
+ * @param resistances_ohms Array of thermistor resistances (ohms)
+ * @param temperatures_celsius Array to store temperatures (°C)
+ * @param count Number of elements
+ * @param coeff_a Steinhart-Hart coefficient A
+ * @param coeff_b Steinhart-Hart coefficient B
+ * @param coeff_c Steinhart-Hart coefficient C
+ * @param out_of_range_mask Mask of BatchMaskBytes(count) bytes to store
+ *        out-of-range flags (nullable)
+ * @return true if every element was in range, false otherwise
+ */
+bool ConvertResistanceToTemperatureSteinhartHart(
+    const float *resistances_ohms, float *temperatures_celsius, size_t count,
+    float coeff_a, float coeff_b, float coeff_c,
+    uint8_t *out_of_range_mask) noexcept;
+
+/**
+ * @brief Convert an array of raw ADC counts to temperatures (beta parameter)
+ *
+ * Assumes a ratiometric divider (ADC full scale equals the divider supply)
+ * with the thermistor on the low side, so the reference voltage cancels
+ * out. Counts at the rails (open or shorted sensor) or whose resistance is
+ * outside the valid range are clamped and flagged in out_of_range_mask.
+ *
+ * @param adc_counts Array of raw ADC counts
+ * @param temperatures_celsius Array to store temperatures (°C)
+ * @param count Number of elements
+ * @param adc_resolution_bits ADC resolution (1-32 bits)
+ * @param series_resistance Series resistance (ohms)
+ * @param resistance_at_25c Resistance at 25°C (ohms)
+ * @param beta_value Beta value (K)
+ * @param out_of_range_mask Mask of BatchMaskBytes(count) bytes to store
+ *        out-of-range flags (nullable)
+ * @return true if every element was in range, false otherwise
+ */
+bool ConvertAdcCountsToTemperatureBeta(
+    const uint32_t *adc_counts, float *temperatures_celsius, size_t count,
+    uint8_t adc_resolution_bits, float series_resistance,
+    float resistance_at_25c, float beta_value,
+    uint8_t *out_of_range_mask) noexcept;
+
 //--------------------------------------
 //  Validation Functions
 //--------------------------------------
@@ -0,0 +1,186 @@
+/**
+ * @file ntc_history.hpp
+ * @brief Fixed-capacity temperature history with windowed statistics.
+ *
+ * This header provides a ring buffer of recent readings that keeps rolling
+ * min/max/mean and rate-of-change up to date as readings arrive, without heap
+ * allocation and without copying the window. It can be fed directly or
+ * attached to an NtcThermistor, which pushes every successful reading.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_HISTORY_H
+#define NTC_HISTORY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ntc_types.hpp"
+
+//--------------------------------------
+//  NtcHistory Class
+//--------------------------------------
+
+/**
+ * @class NtcHistory
+ * @brief Ring buffer of the last Capacity readings with O(1) statistics
+ *
+ * The window is the last Capacity readings. Each Push() updates:
+ *
+ * - a running sum (mean) and index-weighted sum (least-squares slope);
+ * - monotonic deques of buffer slots for the window minimum and maximum.
+ *
+ * Push() is amortized O(1): the running sums are recomputed from the buffer
+ * once per Capacity pushes to bound rounding drift. GetStats() is O(1).
+ *
+ * @tparam Capacity Number of readings in the window (at least 2)
+ *
+ * @example
+ * @code
+ * NtcHistory<64> history;
+ * thermistor.AttachHistory(&history);
+ * // ... reads ...
+ * ntc_history_stats_t stats = {};
+ * history.GetStats(&stats);
+ * @endcode
+ */
+template <size_t Capacity> class NtcHistory {
+public:
+  static_assert(Capacity >= 2U, "History needs at least two readings");
+  static_assert(Capacity <= UINT16_MAX, "History capacity too large");
+
+  /// Number of readings in the window
+  static constexpr size_t CAPACITY_ = Capacity;
+
+  //==============================================================//
+  // CONSTRUCTORS
+  //==============================================================//
+
+  /**
+   * @brief Construct an empty history
+   */
+  NtcHistory() noexcept;
+
+  //==============================================================//
+  // RECORDING
+  //==============================================================//
+
+  /**
+   * @brief Add a reading, evicting the oldest one when full
+   * @param temperature_celsius Temperature (°C)
+   * @param timestamp_us Reading time (µs); 0 if unknown
+   */
+  void Push(float temperature_celsius, uint64_t timestamp_us = 0U) noexcept;
+
+  /**
+   * @brief Remove all readings
+   */
+  void Clear() noexcept;
+
+  //==============================================================//
+  // ACCESS
+  //==============================================================//
+
+  /**
+   * @brief Get the number of readings in the window
+   * @return Reading count (0 to Capacity)
+   */
+  [[nodiscard]] size_t Size() const noexcept;
+
+  /**
+   * @brief Check if the window is full
+   * @return true if Capacity readings are held
+   */
+  [[nodiscard]] bool IsFull() const noexcept;
+
+  /**
+   * @brief Get a reading by age
+   * @param age 0 for the newest reading, Size() - 1 for the oldest
+   * @param temperature_celsius Pointer to store the temperature (°C)
+   * @param timestamp_us Pointer to store the timestamp (µs, may be nullptr)
+   * @return Error code (InvalidParameter if age is out of range)
+   */
+  NtcError GetReading(size_t age, float *temperature_celsius,
+                      uint64_t *timestamp_us = nullptr) const noexcept;
+
+  /**
+   * @brief Get the window statistics
+   * @param stats Pointer to store the statistics
+   * @return Error code (NotInitialized while the window is empty)
+   */
+  NtcError GetStats(ntc_history_stats_t *stats) const noexcept;
+
+private:
+  //==============================================================//
+  // PRIVATE TYPES
+  //==============================================================//
+
+  /**
+   * @brief Ring of buffer slots ordered by age, used as a monotonic deque
+   */
+  struct SlotDeque {
+    std::array<uint16_t, Capacity> slots; ///< Buffer slots
+    size_t front;                         ///< Index of the oldest slot
+    size_t size;                          ///< Number of slots held
+  };
+
+  //==============================================================//
+  // PRIVATE MEMBER VARIABLES
+  //==============================================================//
+
+  std::array<float, Capacity> temperatures_;  ///< Readings (°C)
+  std::array<uint64_t, Capacity> timestamps_; ///< Reading times (µs)
+  size_t next_;  ///< Slot of the next reading (oldest when full)
+  size_t count_; ///< Readings held
+
+  // Running sums over the window (x = 0 for the oldest reading)
+  double sum_;          ///< Sum of temperatures
+  double weighted_sum_; ///< Sum of x * temperature
+
+  SlotDeque min_slots_; ///< Ascending temperatures, front is the minimum
+  SlotDeque max_slots_; ///< Descending temperatures, front is the maximum
+
+  //==============================================================//
+  // PRIVATE HELPER METHODS
+  //==============================================================//
+
+  /**
+   * @brief Get the slot of a reading by age
+   * @param age 0 for the newest reading
+   * @return Buffer slot
+   */
+  [[nodiscard]] size_t slotOfAge(size_t age) const noexcept;
+
+  /**
+   * @brief Recompute the running sums from the buffer
+   */
+  void resyncSums() noexcept;
+
+  /**
+   * @brief Drop a deque's front if it refers to the evicted slot
+   * @param deque Deque to update
+   * @param slot Evicted slot
+   */
+  static void expireSlot(SlotDeque *deque, size_t slot) noexcept;
+
+  /**
+   * @brief Append a slot, dropping slots it dominates
+   * @tparam Keep Comparison that keeps an older slot (e.g. less for minimum)
+   * @param deque Deque to update
+   * @param slot New slot
+   */
+  template <typename Keep>
+  void appendSlot(SlotDeque *deque, size_t slot) noexcept;
+};
+
+// Include template implementation
+#define NTC_HISTORY_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Template implementation file
+#include "../src/ntc_history.cpp"
+#undef NTC_HISTORY_HEADER_INCLUDED
+
+#endif // NTC_HISTORY_H
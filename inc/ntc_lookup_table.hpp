@@ -9,8 +9,11 @@
  * Lookup tables provide a balance between speed and accuracy, making them ideal
  * for real-time applications where computational resources are limited.
  *
- * @note Lookup tables use binary search and linear interpolation for efficient
- *       temperature lookups. Accuracy depends on table resolution.
+ * @note Tables spaced uniformly in the resistance key domain (see
+ *       ResistanceKey()) are indexed in O(1) by resistance, tables spaced
+ *       uniformly in temperature in O(1) by temperature; other lookups use
+ *       binary search. All use linear interpolation. Accuracy depends on
+ *       table resolution.
  *
  * @author Nebiyu Tadesse
  * @date 2025
@@ -22,6 +25,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 
 namespace NTC {
 
@@ -43,17 +48,358 @@ struct ntc_lookup_entry_t {
 
 /**
  * @brief Lookup table structure
+ *
+ * Entries are sorted by descending resistance (ascending temperature).
+ *
+ * When resistance_step is non-zero the entries are spaced uniformly in the
+ * resistance key domain (see ResistanceKey()), which is a fixed-point
+ * log2(R). The bucket for a resistance is then found with one subtraction
+ * and one multiply by inverse_resistance_step instead of a binary search.
+ *
+ * When inverse_temperature_step is non-zero the entries are spaced uniformly
+ * in temperature, so the reverse (temperature to resistance) lookup is O(1)
+ * as well. Tables whose temperatures are not uniform can carry a reverse
+ * index instead: temperature_index[b] is the last entry at or below the
+ * start of the b-th temperature bucket, buckets being 1 /
+ * inverse_index_step °C wide from min_temperature. The reverse lookup then
+ * starts at that entry and steps over the few entries inside the bucket.
+ *
+ * Compact tables leave entries null and store one uint16_t code per entry
+ * instead of an ntc_lookup_entry_t (2 bytes instead of 8). They are always
+ * uniformly keyed, so entry i's resistance follows from max_resistance and
+ * resistance_step; its temperature is min_temperature +
+ * temperature_codes[i] * temperature_code_step. Lookups decode entries
+ * inline, so both layouts are used through the same functions.
  */
 struct ntc_lookup_table_t {
-  const ntc_lookup_entry_t *entries; ///< Array of lookup entries
+  const ntc_lookup_entry_t *entries; ///< Lookup entries (nullptr: compact)
   size_t entry_count;                ///< Number of entries
   float min_resistance;              ///< Minimum resistance in table
   float max_resistance;              ///< Maximum resistance in table
   float min_temperature;             ///< Minimum temperature in table
   float max_temperature;             ///< Maximum temperature in table
-  float resistance_step;             ///< Resistance step between entries
+  float resistance_step; ///< Entry spacing in resistance key units (0: none)
+  float inverse_resistance_step; ///< 1 / resistance_step (0: not uniform)
+  float inverse_temperature_step; ///< 1 / temperature step (0: not uniform)
+  const uint16_t *temperature_codes; ///< Compact temperatures (nullptr: none)
+  float temperature_code_step; ///< Compact temperature resolution (°C/code)
+  const uint16_t *temperature_index; ///< Reverse index (nullptr: none)
+  size_t temperature_index_count;    ///< Buckets in temperature_index
+  float inverse_index_step;          ///< Reverse index buckets per °C
 };
 
+//--------------------------------------
+//  Lookup Table Validation
+//--------------------------------------
+
+/// Largest key step of a uniformly keyed table (one entry per octave)
+constexpr float MAX_RESISTANCE_KEY_STEP_ = 8388608.0F; // 2^23
+
+/**
+ * @brief Check that a resistance has a well-defined resistance key
+ * @param resistance_ohms Resistance (ohms)
+ * @return true if the resistance is a positive, normal, finite float
+ */
+[[nodiscard]] constexpr bool
+IsKeyableResistance(float resistance_ohms) noexcept {
+  return resistance_ohms >= std::numeric_limits<float>::min() &&
+         resistance_ohms <= std::numeric_limits<float>::max();
+}
+
+/**
+ * @brief Compile-time resistance key (see ResistanceKey())
+ *
+ * Gives the same key as ResistanceKey() without reinterpreting the bits, so
+ * tables can be validated in constant expressions.
+ *
+ * @param resistance_ohms Resistance (ohms), see IsKeyableResistance()
+ * @return Resistance key
+ */
+[[nodiscard]] constexpr uint32_t
+ConstantResistanceKey(float resistance_ohms) noexcept {
+  constexpr uint32_t MANTISSA_BITS_ = 23U;
+  constexpr int32_t EXPONENT_BIAS_ = 127;
+
+  // Scaling by two is exact, so the mantissa comes out exact as well
+  double value = static_cast<double>(resistance_ohms);
+  int32_t exponent = 0;
+  while (value >= 2.0) {
+    value /= 2.0;
+    exponent++;
+  }
+  while (value < 1.0) {
+    value *= 2.0;
+    exponent--;
+  }
+  const auto mantissa = static_cast<uint32_t>(
+      (value - 1.0) * static_cast<double>(1UL << MANTISSA_BITS_));
+  return (static_cast<uint32_t>(exponent + EXPONENT_BIAS_) << MANTISSA_BITS_) |
+         mantissa;
+}
+
+/**
+ * @brief Check an entry spacing against its stored reciprocal
+ * @param step Spacing between two entries
+ * @param inverse_step Stored reciprocal of the spacing
+ * @return true if step * inverse_step is 1 to within float rounding
+ */
+[[nodiscard]] constexpr bool UniformStepMatches(float step,
+                                                float inverse_step) noexcept {
+  constexpr float MAX_STEP_MISMATCH_ = 1.0e-4F;
+  const float product = step * inverse_step;
+  return product >= 1.0F - MAX_STEP_MISMATCH_ &&
+         product <= 1.0F + MAX_STEP_MISMATCH_;
+}
+
+/**
+ * @brief Get the temperature of a table entry at compile time
+ * @param table Lookup table (regular or compact)
+ * @param index Entry index
+ * @return Entry temperature (°C)
+ */
+[[nodiscard]] constexpr float
+ConstantEntryTemperature(const ntc_lookup_table_t *table,
+                         size_t index) noexcept {
+  if (table->entries != nullptr) {
+    return table->entries[index].temperature_celsius;
+  }
+  return table->min_temperature +
+         (static_cast<float>(table->temperature_codes[index]) *
+          table->temperature_code_step);
+}
+
+/**
+ * @brief Get the start of a reverse index bucket
+ * @param min_temperature Temperature of the first entry (°C)
+ * @param inverse_index_step Reverse index buckets per °C
+ * @param bucket Bucket number
+ * @return Lowest temperature of the bucket (°C)
+ */
+[[nodiscard]] constexpr float
+TemperatureIndexBucketStart(float min_temperature, float inverse_index_step,
+                            size_t bucket) noexcept {
+  return min_temperature + (static_cast<float>(bucket) / inverse_index_step);
+}
+
+/**
+ * @brief Validate the reverse index of a lookup table
+ *
+ * Every bucket must point at an entry that starts a segment and lies at or
+ * below the bucket start, so the forward step in the reverse lookup always
+ * reaches the right segment.
+ *
+ * @param table Lookup table with valid entries
+ * @return true if the table has no reverse index or a consistent one
+ */
+[[nodiscard]] constexpr bool
+ValidateTemperatureIndex(const ntc_lookup_table_t *table) noexcept {
+  if (table->temperature_index == nullptr) {
+    return table->temperature_index_count == 0U &&
+           table->inverse_index_step == 0.0F;
+  }
+  if (table->temperature_index_count == 0U ||
+      !(table->inverse_index_step > 0.0F)) {
+    return false;
+  }
+
+  const float first = ConstantEntryTemperature(table, 0);
+  for (size_t bucket = 0; bucket < table->temperature_index_count; bucket++) {
+    const size_t index = table->temperature_index[bucket];
+    if (index + 1U >= table->entry_count ||
+        (bucket > 0U &&
+         ConstantEntryTemperature(table, index) >
+             TemperatureIndexBucketStart(first, table->inverse_index_step,
+                                         bucket))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Validate lookup table
+ *
+ * Checks that the table has at least two entries, that resistances are
+ * strictly descending and temperatures strictly ascending. Compact tables
+ * must be uniformly keyed with strictly ascending codes. The O(1) lookups
+ * trust the spacing fields, so they are checked against the entries too:
+ * resistance_step must be the key distance between every pair of
+ * neighbouring entries, and inverse_resistance_step and
+ * inverse_temperature_step the reciprocals of the actual spacing, and the
+ * reverse index must be consistent (see ValidateTemperatureIndex()). This
+ * walks the whole table; use ValidatedLookupTable to pay the cost once
+ * instead of on every lookup. Usable in constant expressions for constexpr
+ * tables.
+ *
+ * @param table Lookup table to validate
+ * @return true if valid, false otherwise
+ */
+[[nodiscard]] constexpr bool
+ValidateLookupTable(const ntc_lookup_table_t *table) noexcept {
+  if (table == nullptr || table->entry_count < 2) {
+    return false;
+  }
+
+  // Key spacing: both fields zero, or an integral step and its reciprocal
+  const bool keyed = table->resistance_step > 0.0F;
+  if (keyed) {
+    if (table->resistance_step > MAX_RESISTANCE_KEY_STEP_ ||
+        table->resistance_step !=
+            static_cast<float>(static_cast<uint32_t>(table->resistance_step)) ||
+        !UniformStepMatches(table->resistance_step,
+                            table->inverse_resistance_step)) {
+      return false;
+    }
+  } else if (table->resistance_step != 0.0F ||
+             table->inverse_resistance_step != 0.0F) {
+    return false;
+  }
+  if (!(table->inverse_temperature_step >= 0.0F)) {
+    return false;
+  }
+
+  // Compact tables: resistances descend by construction (uniform keys)
+  if (table->entries == nullptr) {
+    if (table->temperature_codes == nullptr || !keyed ||
+        !IsKeyableResistance(table->max_resistance) ||
+        !(table->temperature_code_step > 0.0F)) {
+      return false;
+    }
+    for (size_t i = 1; i < table->entry_count; i++) {
+      if (table->temperature_codes[i] <= table->temperature_codes[i - 1]) {
+        return false;
+      }
+      if (table->inverse_temperature_step > 0.0F &&
+          !UniformStepMatches(
+              static_cast<float>(table->temperature_codes[i] -
+                                 table->temperature_codes[i - 1]) *
+                  table->temperature_code_step,
+              table->inverse_temperature_step)) {
+        return false;
+      }
+    }
+    return ValidateTemperatureIndex(table);
+  }
+
+  // Entries must be sorted by resistance (descending for NTC)
+  const auto key_step = static_cast<uint32_t>(table->resistance_step);
+  for (size_t i = 1; i < table->entry_count; i++) {
+    const ntc_lookup_entry_t &previous = table->entries[i - 1];
+    const ntc_lookup_entry_t &entry = table->entries[i];
+    if (entry.resistance_ohms >= previous.resistance_ohms ||
+        entry.temperature_celsius <= previous.temperature_celsius) {
+      return false;
+    }
+    if (keyed && (!IsKeyableResistance(entry.resistance_ohms) ||
+                  !IsKeyableResistance(previous.resistance_ohms) ||
+                  ConstantResistanceKey(previous.resistance_ohms) -
+                          ConstantResistanceKey(entry.resistance_ohms) !=
+                      key_step)) {
+      return false;
+    }
+    if (table->inverse_temperature_step > 0.0F &&
+        !UniformStepMatches(entry.temperature_celsius -
+                                previous.temperature_celsius,
+                            table->inverse_temperature_step)) {
+      return false;
+    }
+  }
+
+  return ValidateTemperatureIndex(table);
+}
+
+/**
+ * @brief Handle to a lookup table that has passed ValidateLookupTable()
+ *
+ * Validation happens once, when the handle is constructed. Lookup functions
+ * taking a ValidatedLookupTable skip the O(n) check. For constexpr tables the
+ * handle can be a constexpr object, so validation happens at compile time:
+ *
+ * @code
+ * constexpr NTC::ValidatedLookupTable kTable{
+ *     NTC::MakeNtcLogTable<10000, 3950, -40, 125>()};
+ * static_assert(kTable.IsValid(), "table must be valid");
+ * @endcode
+ */
+class ValidatedLookupTable {
+public:
+  /**
+   * @brief Construct an empty (invalid) handle
+   */
+  constexpr ValidatedLookupTable() noexcept = default;
+
+  /**
+   * @brief Validate a table and construct a handle to it
+   * @param table Lookup table (must outlive the handle)
+   * @note The handle is empty if validation fails; check IsValid().
+   */
+  constexpr explicit ValidatedLookupTable(
+      const ntc_lookup_table_t *table) noexcept
+      : table_(ValidateLookupTable(table) ? table : nullptr) {}
+
+  /**
+   * @brief Check if the handle refers to a valid table
+   * @return true if valid, false otherwise
+   */
+  [[nodiscard]] constexpr bool IsValid() const noexcept {
+    return table_ != nullptr;
+  }
+
+  /**
+   * @brief Get the validated table
+   * @return Pointer to table (nullptr if the handle is empty)
+   */
+  [[nodiscard]] constexpr const ntc_lookup_table_t *Get() const noexcept {
+    return table_;
+  }
+
+  /**
+   * @brief Access the validated table
+   * @return Pointer to table
+   * @warning Only valid when IsValid() returns true
+   */
+  constexpr const ntc_lookup_table_t *operator->() const noexcept {
+    return table_;
+  }
+
+private:
+  const ntc_lookup_table_t *table_ = nullptr; ///< Validated table
+};
+
+//--------------------------------------
+//  Resistance Key
+//--------------------------------------
+
+/**
+ * @brief Get the resistance key of a resistance value
+ *
+ * The key is the IEEE-754 bit pattern of the (positive) resistance. It is
+ * monotonic in resistance and behaves as a fixed-point log2(R): the exponent
+ * forms the integer part and the mantissa a piecewise-linear fraction. Within
+ * one octave the key is exactly linear in resistance.
+ *
+ * @param resistance_ohms Resistance (ohms), must be positive
+ * @return Resistance key
+ */
+[[nodiscard]] inline uint32_t ResistanceKey(float resistance_ohms) noexcept {
+  static_assert(sizeof(float) == sizeof(uint32_t),
+                "Resistance key requires 32-bit IEEE-754 floats");
+  uint32_t key = 0;
+  std::memcpy(&key, &resistance_ohms, sizeof(key));
+  return key;
+}
+
+/**
+ * @brief Get the resistance value of a resistance key
+ * @param key Resistance key (see ResistanceKey())
+ * @return Resistance (ohms)
+ */
+[[nodiscard]] inline float ResistanceFromKey(uint32_t key) noexcept {
+  float resistance_ohms = 0.0F;
+  std::memcpy(&resistance_ohms, &key, sizeof(resistance_ohms));
+  return resistance_ohms;
+}
+
 //--------------------------------------
 //  Lookup Table Functions
 //--------------------------------------
@@ -65,6 +411,10 @@ struct ntc_lookup_table_t {
  * Lookup tables are optimized for fast temperature conversion with minimal
  * computational overhead.
  *
+ * Part types are mapped onto shared curve storage: parts with the same
+ * resistance curve (e.g. every 10kΩ / β=3435K type) return the same table.
+ * Built-in curves use the compact layout when NTC_COMPACT_LOOKUP_TABLES is 1.
+ *
  * @param ntc_type NTC thermistor type (e.g., NTC_TYPE_NTCG163JFT103FT1S)
  * @return Pointer to lookup table (nullptr if not available for this type)
  *
@@ -73,28 +423,166 @@ struct ntc_lookup_table_t {
  */
 const ntc_lookup_table_t *GetNtcLookupTable(int ntc_type) noexcept;
 
+//--------------------------------------
+//  Runtime Table Registration
+//--------------------------------------
+
+/// Number of tables that can be registered with RegisterNtcLookupTable()
+constexpr size_t MAX_REGISTERED_LOOKUP_TABLES_ = 8U;
+
+/**
+ * @brief Register a caller-owned lookup table for an NTC type
+ *
+ * Registered tables take precedence over built-in tables, so a
+ * field-calibrated part (typically NtcType::Custom or a project-specific
+ * value above NtcType::Max) gets the table path in every driver. Drivers
+ * resolve the table when they are initialized or reconfigured and keep the
+ * pointer until the next time. Passing nullptr removes the registration for
+ * drivers that resolve the table afterwards only: the table must outlive
+ * every driver that resolved it, or those drivers must be reconfigured or
+ * deinitialized and initialized again before the table is released.
+ *
+ * @param ntc_type NTC type value the table applies to
+ * @param table Lookup table (must outlive the registration and every
+ *        driver that resolved it)
+ * @return true if registered, false if the table is invalid or all
+ *         MAX_REGISTERED_LOOKUP_TABLES_ slots are in use
+ *
+ * @note Not synchronized; register during start-up, before other tasks
+ *       look up tables.
+ */
+bool RegisterNtcLookupTable(int ntc_type,
+                            const ntc_lookup_table_t *table) noexcept;
+
+//--------------------------------------
+//  Runtime Table Building
+//--------------------------------------
+
+/**
+ * @brief Get the number of entries of a uniformly keyed table
+ *
+ * Use to size the entry buffer for BuildLookupTableSteinhartHart() and
+ * BuildLookupTableFromPoints(). The grid is rounded outward, so the result
+ * is an upper bound for both.
+ *
+ * @param min_resistance Lowest resistance to cover (ohms)
+ * @param max_resistance Highest resistance to cover (ohms)
+ * @param segments_per_octave Entries per resistance octave (power of two)
+ * @return Number of entries (0 if the arguments are invalid)
+ */
+[[nodiscard]] size_t
+LookupTableEntryCount(float min_resistance, float max_resistance,
+                      uint32_t segments_per_octave) noexcept;
+
+/**
+ * @brief Build a uniformly keyed lookup table from Steinhart-Hart
+ * coefficients
+ *
+ * Evaluates the equation once per entry into a caller-provided buffer, e.g.
+ * with coefficients from CalculateSteinhartHartCoefficients() after a
+ * field calibration. Lookups on the result are O(1). The table covers at
+ * least [min_temperature, max_temperature].
+ *
+ * @param coeff_a Steinhart-Hart coefficient A
+ * @param coeff_b Steinhart-Hart coefficient B
+ * @param coeff_c Steinhart-Hart coefficient C
+ * @param min_temperature Lowest temperature to cover (°C)
+ * @param max_temperature Highest temperature to cover (°C)
+ * @param segments_per_octave Entries per resistance octave (power of two)
+ * @param entries Entry buffer (must outlive the table)
+ * @param capacity Number of entries in the buffer
+ * @param table Pointer to store the table descriptor
+ * @return true if built, false if the arguments are invalid or the buffer
+ *         is too small (see LookupTableEntryCount())
+ */
+bool BuildLookupTableSteinhartHart(float coeff_a, float coeff_b, float coeff_c,
+                                   float min_temperature, float max_temperature,
+                                   uint32_t segments_per_octave,
+                                   ntc_lookup_entry_t *entries, size_t capacity,
+                                   ntc_lookup_table_t *table) noexcept;
+
+/**
+ * @brief Build a uniformly keyed lookup table from measured points
+ *
+ * Resamples the points onto the resistance key grid, interpolating 1/T
+ * linearly in ln(R) between neighbouring points (exact for a beta-model
+ * part, far closer than linear in R for real parts). Lookups on the result
+ * are O(1). The table covers the grid nodes inside the measured range.
+ *
+ * @param points Measured (R, T) points, descending resistance and ascending
+ *        temperature, at least two
+ * @param point_count Number of points
+ * @param segments_per_octave Entries per resistance octave (power of two)
+ * @param entries Entry buffer (must outlive the table)
+ * @param capacity Number of entries in the buffer
+ * @param table Pointer to store the table descriptor
+ * @return true if built, false if the points are not ordered, the range
+ *         holds fewer than two grid nodes or the buffer is too small
+ */
+bool BuildLookupTableFromPoints(const ntc_lookup_entry_t *points,
+                                size_t point_count,
+                                uint32_t segments_per_octave,
+                                ntc_lookup_entry_t *entries, size_t capacity,
+                                ntc_lookup_table_t *table) noexcept;
+
 /**
  * @brief Find temperature using lookup table
  * @param table Lookup table
  * @param resistance_ohms Resistance value
  * @param temperature_celsius Pointer to store temperature
  * @return true if found, false otherwise
+ *
+ * @note Slow path: validates the whole table (O(n)) on every call, which
+ *       costs more than the lookup itself. Kept for one-off queries; hot
+ *       paths should validate once with ValidatedLookupTable and use the
+ *       overload taking the handle.
  */
 bool FindTemperatureFromLookupTable(const ntc_lookup_table_t *table,
                                     float resistance_ohms,
                                     float *temperature_celsius) noexcept;
 
+/**
+ * @brief Find temperature using a validated lookup table
+ * @param table Validated lookup table handle
+ * @param resistance_ohms Resistance value
+ * @param temperature_celsius Pointer to store temperature
+ * @return true if found, false otherwise
+ */
+bool FindTemperatureFromLookupTable(const ValidatedLookupTable &table,
+                                    float resistance_ohms,
+                                    float *temperature_celsius) noexcept;
+
 /**
  * @brief Find resistance using lookup table
  * @param table Lookup table
  * @param temperature_celsius Temperature value
  * @param resistance_ohms Pointer to store resistance
  * @return true if found, false otherwise
+ *
+ * @note Slow path: validates the whole table (O(n)) on every call, which
+ *       costs more than the lookup itself. Kept for one-off queries; hot
+ *       paths should validate once with ValidatedLookupTable and use the
+ *       overload taking the handle.
  */
 bool FindResistanceFromLookupTable(const ntc_lookup_table_t *table,
                                    float temperature_celsius,
                                    float *resistance_ohms) noexcept;
 
+/**
+ * @brief Find resistance using a validated lookup table
+ *
+ * O(1) on tables with a uniform temperature step or a reverse index (all
+ * generated tables), a binary search on temperature otherwise.
+ *
+ * @param table Validated lookup table handle
+ * @param temperature_celsius Temperature value
+ * @param resistance_ohms Pointer to store resistance
+ * @return true if found, false otherwise
+ */
+bool FindResistanceFromLookupTable(const ValidatedLookupTable &table,
+                                   float temperature_celsius,
+                                   float *resistance_ohms) noexcept;
+
 /**
  * @brief Interpolate between two lookup table entries
  * @param entry1 First entry
@@ -121,11 +609,34 @@ bool BinarySearchLookupTable(const ntc_lookup_table_t *table,
                              size_t *upper_index) noexcept;
 
 /**
- * @brief Validate lookup table
- * @param table Lookup table to validate
- * @return true if valid, false otherwise
+ * @brief O(1) bucket lookup in a uniformly spaced table
+ *
+ * Computes the lower entry index and the interpolation fraction toward the
+ * next entry directly from the resistance key. Only valid for tables with a
+ * non-zero resistance_step.
+ *
+ * @param table Lookup table (uniformly spaced)
+ * @param resistance_ohms Target resistance
+ * @param lower_index Pointer to store lower index
+ * @param fraction Pointer to store fraction (0.0-1.0) toward lower_index + 1
+ * @return true if resistance is covered by the table, false otherwise
+ */
+bool UniformIndexLookupTable(const ntc_lookup_table_t *table,
+                             float resistance_ohms, size_t *lower_index,
+                             float *fraction) noexcept;
+
+/**
+ * @brief Get a lookup table entry
+ *
+ * Decodes the entry for compact tables; copies it for regular tables.
+ *
+ * @param table Lookup table
+ * @param index Entry index (0 to entry_count - 1)
+ * @param entry Pointer to store the entry
+ * @return true if successful, false otherwise
  */
-bool ValidateLookupTable(const ntc_lookup_table_t *table) noexcept;
+bool GetLookupTableEntry(const ntc_lookup_table_t *table, size_t index,
+                         ntc_lookup_entry_t *entry) noexcept;
 
 /**
  * @brief Get lookup table statistics
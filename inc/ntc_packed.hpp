@@ -0,0 +1,207 @@
+/**
+ * @file ntc_packed.hpp
+ * @brief Compact wire/log format for NTC readings.
+ *
+ * This header provides a streaming encoder that packs readings of many
+ * channels into a contiguous caller-owned buffer, ready to be handed to DMA,
+ * flash or a network stack as is, and the matching decoder.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_PACKED_H
+#define NTC_PACKED_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ntc_types.hpp"
+
+//--------------------------------------
+//  Packed Record Format
+//--------------------------------------
+
+/**
+ * @brief Layout of one packed reading (little-endian, no padding)
+ *
+ * | Bytes | Field                                               |
+ * |-------|-----------------------------------------------------|
+ * | 1     | Channel                                             |
+ * | 2     | Temperature (int16, 0.01°C, saturated)              |
+ * | 2     | Raw ADC count (uint16, saturated)                   |
+ * | 1     | NtcError of the reading                             |
+ * | 1-10  | Timestamp delta (µs, zigzag LEB128 varint)          |
+ *
+ * The timestamp delta is relative to the previous record of the batch (to 0
+ * for the first record), so each batch decodes on its own. Fahrenheit,
+ * Kelvin, voltage and resistance are not stored; the decoder derives them.
+ * A record with a 1 ms delta takes 8 bytes instead of sizeof(ntc_reading_t).
+ */
+namespace NTC::Packed {
+constexpr size_t FIXED_BYTES_ = 6U;   ///< Bytes before the timestamp delta
+constexpr size_t MAX_VARINT_BYTES_ = 10U; ///< Longest 64-bit varint
+constexpr size_t MAX_RECORD_BYTES_ =
+    FIXED_BYTES_ + MAX_VARINT_BYTES_; ///< Longest record
+constexpr float CENTI_DEGREES_PER_DEGREE_ = 100.0F; ///< Temperature scale
+} // namespace NTC::Packed
+
+//--------------------------------------
+//  NtcPackedEncoder Class
+//--------------------------------------
+
+/**
+ * @class NtcPackedEncoder
+ * @brief Appends packed readings to a caller-owned buffer
+ *
+ * Records are written back to back from the start of the buffer, so Data()
+ * and Size() describe a contiguous batch that can be transferred without a
+ * copy. Reset() starts the next batch in the same buffer.
+ *
+ * @example
+ * @code
+ * std::array<uint8_t, 512> page = {};
+ * NtcPackedEncoder encoder(page.data(), page.size());
+ * if (encoder.Append(channel, reading) == NtcError::OutOfMemory) {
+ *   flash.Write(encoder.Data(), encoder.Size());
+ *   encoder.Reset();
+ *   (void)encoder.Append(channel, reading);
+ * }
+ * @endcode
+ */
+class NtcPackedEncoder {
+public:
+  //==============================================================//
+  // CONSTRUCTORS
+  //==============================================================//
+
+  /**
+   * @brief Construct an encoder over a buffer
+   * @param buffer Output buffer (must outlive the encoder)
+   * @param capacity Buffer size (bytes)
+   */
+  NtcPackedEncoder(uint8_t *buffer, size_t capacity) noexcept;
+
+  //==============================================================//
+  // ENCODING
+  //==============================================================//
+
+  /**
+   * @brief Append a reading
+   * @param channel Channel the reading belongs to
+   * @param reading Reading to pack
+   * @return Error code (OutOfMemory if the record does not fit; nothing is
+   *         written then)
+   */
+  NtcError Append(uint8_t channel, const ntc_reading_t &reading) noexcept;
+
+  /**
+   * @brief Append a reading given by its stored fields
+   *
+   * For drivers that do not produce an ntc_reading_t (e.g.
+   * NtcThermistorArray, NtcThermistorQ).
+   *
+   * @param channel Channel the reading belongs to
+   * @param temperature_celsius Temperature (°C)
+   * @param adc_raw_value Raw ADC count
+   * @param timestamp_us Reading time (µs)
+   * @param error Error of the reading
+   * @return Error code (OutOfMemory if the record does not fit)
+   */
+  NtcError Append(uint8_t channel, float temperature_celsius,
+                  uint32_t adc_raw_value, uint64_t timestamp_us,
+                  NtcError error = NtcError::Success) noexcept;
+
+  /**
+   * @brief Discard the batch and start a new one in the same buffer
+   */
+  void Reset() noexcept;
+
+  //==============================================================//
+  // ACCESS
+  //==============================================================//
+
+  /**
+   * @brief Get the start of the batch
+   * @return Buffer passed to the constructor
+   */
+  [[nodiscard]] const uint8_t *Data() const noexcept;
+
+  /**
+   * @brief Get the size of the batch
+   * @return Bytes written since the last Reset()
+   */
+  [[nodiscard]] size_t Size() const noexcept;
+
+  /**
+   * @brief Get the number of records in the batch
+   * @return Records appended since the last Reset()
+   */
+  [[nodiscard]] size_t Records() const noexcept;
+
+private:
+  uint8_t *buffer_;            ///< Output buffer
+  size_t capacity_;            ///< Buffer size (bytes)
+  size_t size_;                ///< Bytes written
+  size_t records_;             ///< Records written
+  uint64_t last_timestamp_us_; ///< Timestamp of the previous record
+};
+
+//--------------------------------------
+//  NtcPackedDecoder Class
+//--------------------------------------
+
+/**
+ * @class NtcPackedDecoder
+ * @brief Reads packed readings back into ntc_reading_t
+ *
+ * Fahrenheit and Kelvin are derived from the stored temperature. With a
+ * configuration, voltage and resistance are derived from the stored count
+ * (reference_voltage, adc_resolution_bits, series_resistance); without one
+ * they are 0. accuracy_celsius and adc_conversions are not stored and read
+ * back as 0.
+ */
+class NtcPackedDecoder {
+public:
+  //==============================================================//
+  // CONSTRUCTORS
+  //==============================================================//
+
+  /**
+   * @brief Construct a decoder over a packed batch
+   * @param data Packed batch (must outlive the decoder)
+   * @param size Batch size (bytes)
+   * @param config Configuration of the encoded channels (may be nullptr)
+   */
+  NtcPackedDecoder(const uint8_t *data, size_t size,
+                   const ntc_config_t *config = nullptr) noexcept;
+
+  //==============================================================//
+  // DECODING
+  //==============================================================//
+
+  /**
+   * @brief Check if another record follows
+   * @return true if Next() has data to decode
+   */
+  [[nodiscard]] bool HasNext() const noexcept;
+
+  /**
+   * @brief Decode the next record
+   * @param channel Pointer to store the channel
+   * @param reading Pointer to store the reading
+   * @return Error code (InvalidParameter past the last record, Failure for a
+   *         truncated or corrupt record, which also ends decoding)
+   */
+  NtcError Next(uint8_t *channel, ntc_reading_t *reading) noexcept;
+
+private:
+  const uint8_t *data_;        ///< Packed batch
+  size_t size_;                ///< Batch size (bytes)
+  size_t position_;            ///< Offset of the next record
+  uint64_t last_timestamp_us_; ///< Timestamp of the previous record
+  const ntc_config_t *config_; ///< Channel configuration (may be nullptr)
+};
+
+#endif // NTC_PACKED_H
@@ -0,0 +1,278 @@
+/**
+ * @file ntc_scan_scheduler.hpp
+ * @brief Periodic, priority- and deadline-aware scheduling of many sensors.
+ *
+ * This header provides a scheduler that owns the read order of a set of
+ * NtcThermistor instances spread over one or more ADC units. Each sensor is
+ * released at its own period; conversions on the same unit are ordered by
+ * priority and deadline, conversions on different units run concurrently,
+ * and per-sensor jitter and deadline-miss statistics are kept.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_SCAN_SCHEDULER_H
+#define NTC_SCAN_SCHEDULER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ntc_thermistor.hpp"
+#include "ntc_types.hpp"
+
+//--------------------------------------
+//  NtcScanScheduler Class
+//--------------------------------------
+
+/**
+ * @class NtcScanScheduler
+ * @brief Non-blocking scan scheduler for up to Capacity thermistors
+ *
+ * Every sensor is released each period_us. A released sensor waits for its
+ * ADC unit, which runs one conversion (the sensor's whole StartConversion()
+ * / Poll() burst) at a time, so the multiplexer settles once per burst. When
+ * a unit frees up it starts the waiting sensor with the highest priority,
+ * and among equal priorities the one with the earliest absolute deadline.
+ * Units do not wait for each other: while one sensor waits sample_delay_ms
+ * between samples, the sensors of the other units convert.
+ *
+ * A release that arrives while the previous one of the same sensor has not
+ * completed is dropped and counted as an overrun. Conversions are not
+ * preempted; a high-priority sensor waits at most for the burst running on
+ * its unit.
+ *
+ * Service() does the work due at now_us and starts at most one conversion
+ * per unit, so every start is timed from a fresh now_us. Call it again at
+ * NextDueUs(). The scheduler is the only caller of the thermistors'
+ * asynchronous API while started; their readings are kept per sensor and
+ * are also published to an attached snapshot or history as usual.
+ *
+ * @tparam AdcType ADC implementation type of the thermistors
+ * @tparam Capacity Maximum number of sensors
+ * @tparam UnitCount Number of ADC units (adc_unit is 0..UnitCount-1)
+ *
+ * @example
+ * @code
+ * NtcScanScheduler<MyAdc, 32, 2> scheduler;
+ * scheduler.AddSensor(&winding_u, {.period_us = 10000, .deadline_us = 0,
+ *                                  .phase_us = 0, .priority = 10,
+ *                                  .adc_unit = 0});
+ * scheduler.AddSensor(&cabinet, {.period_us = 1000000, .deadline_us = 0,
+ *                                .phase_us = 0, .priority = 0,
+ *                                .adc_unit = 1});
+ * scheduler.Start(now_us);
+ * // Sampling task:
+ * scheduler.Service(now_us);
+ * sleep_until(scheduler.NextDueUs());
+ * @endcode
+ */
+template <typename AdcType, size_t Capacity, size_t UnitCount = 1U>
+class NtcScanScheduler {
+public:
+  static_assert(Capacity >= 1U, "Scheduler needs at least one sensor");
+  static_assert(Capacity < UINT16_MAX, "Scheduler capacity too large");
+  static_assert(UnitCount >= 1U && UnitCount <= UINT8_MAX + 1U,
+                "ADC unit count must fit in uint8_t");
+
+  /// Maximum number of sensors
+  static constexpr size_t CAPACITY_ = Capacity;
+
+  /// Number of ADC units
+  static constexpr size_t UNIT_COUNT_ = UnitCount;
+
+  //==============================================================//
+  // CONSTRUCTORS
+  //==============================================================//
+
+  /**
+   * @brief Construct an empty, stopped scheduler
+   */
+  NtcScanScheduler() noexcept;
+
+  //==============================================================//
+  // SENSORS
+  //==============================================================//
+
+  /**
+   * @brief Add a sensor
+   * @param thermistor Initialized thermistor (must outlive the scheduler)
+   * @param config Scheduling parameters of the sensor
+   * @param index Optional pointer to store the sensor index
+   * @return Error code (Busy while started, OutOfMemory when full,
+   *         InvalidParameter for a zero period, an out-of-range unit or a
+   *         thermistor added twice)
+   */
+  NtcError AddSensor(NtcThermistor<AdcType> *thermistor,
+                     const ntc_scan_sensor_config_t &config,
+                     size_t *index = nullptr) noexcept;
+
+  /**
+   * @brief Get the number of sensors
+   * @return Sensors added
+   */
+  [[nodiscard]] size_t GetSensorCount() const noexcept;
+
+  //==============================================================//
+  // SCHEDULING
+  //==============================================================//
+
+  /**
+   * @brief Arm every sensor, first released phase_us after now_us
+   *
+   * Restarts a running scheduler. Statistics are kept; see ResetStats().
+   *
+   * @param now_us Current time (µs, any monotonic time base)
+   */
+  void Start(uint64_t now_us) noexcept;
+
+  /**
+   * @brief Cancel running conversions and stop releasing sensors
+   */
+  void Stop() noexcept;
+
+  /**
+   * @brief Check if the scheduler is started
+   * @return true between Start() and Stop()
+   */
+  [[nodiscard]] bool IsStarted() const noexcept;
+
+  /**
+   * @brief Release, advance and start the conversions due at now_us
+   * @param now_us Current time (same time base as Start())
+   * @return Conversions completed by this call
+   */
+  uint32_t Service(uint64_t now_us) noexcept;
+
+  /**
+   * @brief Get the earliest time Service() has work to do
+   * @return Due time (same time base as Start(); UINT64_MAX when stopped or
+   *         empty)
+   */
+  [[nodiscard]] uint64_t NextDueUs() const noexcept;
+
+  //==============================================================//
+  // READINGS AND STATISTICS
+  //==============================================================//
+
+  /**
+   * @brief Get the last reading completed for a sensor
+   * @param index Sensor index
+   * @param reading Pointer to store the reading
+   * @return Error code (NotInitialized before the first reading)
+   */
+  NtcError GetReading(size_t index, ntc_reading_t *reading) const noexcept;
+
+  /**
+   * @brief Get the timing statistics of a sensor
+   * @param index Sensor index
+   * @param stats Pointer to store the statistics
+   * @return Error code
+   */
+  NtcError GetStats(size_t index, ntc_scan_stats_t *stats) const noexcept;
+
+  /**
+   * @brief Get the timing statistics over all sensors
+   * @param stats Pointer to store the counter sums and overall maxima
+   * @return Error code
+   */
+  NtcError GetTotalStats(ntc_scan_stats_t *stats) const noexcept;
+
+  /**
+   * @brief Clear the statistics of every sensor
+   */
+  void ResetStats() noexcept;
+
+private:
+  //==============================================================//
+  // PRIVATE TYPES
+  //==============================================================//
+
+  /// Scheduling state of one sensor
+  struct sensor_state_t {
+    NtcThermistor<AdcType> *thermistor; ///< Thermistor converted
+    ntc_scan_sensor_config_t config;    ///< Scheduling parameters
+    uint64_t next_release_us;           ///< Time of the next release
+    uint64_t release_us;                ///< Release being served
+    bool pending;                       ///< Released, waiting for its unit
+    bool active;                        ///< Conversion running
+    bool has_reading;                   ///< reading holds a reading
+    ntc_reading_t reading;              ///< Last completed reading
+    ntc_scan_stats_t stats;             ///< Statistics (mean not filled in)
+    uint64_t jitter_sum_us;             ///< Sum of release-to-start delays
+    uint32_t starts;                    ///< Conversions started or attempted
+  };
+
+  /// Unit slot value when no conversion runs on the unit
+  static constexpr uint16_t NO_SENSOR_ = UINT16_MAX;
+
+  //==============================================================//
+  // PRIVATE MEMBER VARIABLES
+  //==============================================================//
+
+  std::array<sensor_state_t, Capacity> sensors_; ///< Sensor states
+  size_t sensor_count_;                          ///< Sensors added
+  std::array<uint16_t, UnitCount>
+      unit_sensor_; ///< Sensor converting on each unit (NO_SENSOR_: none)
+  bool started_;    ///< Releasing sensors
+
+  //==============================================================//
+  // PRIVATE HELPER METHODS
+  //==============================================================//
+
+  /**
+   * @brief Release every sensor whose period has elapsed
+   * @param now_us Current time
+   */
+  void releaseDue(uint64_t now_us) noexcept;
+
+  /**
+   * @brief Pick the waiting sensor a unit converts next
+   * @param unit ADC unit
+   * @return Sensor index, or NO_SENSOR_ if none is waiting
+   */
+  [[nodiscard]] uint16_t selectPending(size_t unit) const noexcept;
+
+  /**
+   * @brief Start the conversion of a released sensor
+   * @param index Sensor index
+   * @param now_us Current time
+   * @return true if the conversion was started
+   */
+  bool startSensor(uint16_t index, uint64_t now_us) noexcept;
+
+  /**
+   * @brief Advance the conversion of a sensor
+   * @param index Sensor index
+   * @param now_us Current time
+   * @return true if the conversion completed
+   */
+  bool pollSensor(uint16_t index, uint64_t now_us) noexcept;
+
+  /**
+   * @brief Get the absolute deadline of a sensor's current release
+   * @param sensor Sensor state
+   * @return Deadline (same time base as Start())
+   */
+  [[nodiscard]] static uint64_t
+  deadlineUs(const sensor_state_t &sensor) noexcept;
+
+  /**
+   * @brief Fill in the derived fields of a statistics block
+   * @param jitter_sum_us Sum of release-to-start delays
+   * @param starts Conversions started or attempted
+   * @param stats Statistics to complete
+   */
+  static void finishStats(uint64_t jitter_sum_us, uint32_t starts,
+                          ntc_scan_stats_t *stats) noexcept;
+};
+
+// Include template implementation
+#define NTC_SCAN_SCHEDULER_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Template implementation file
+#include "../src/ntc_scan_scheduler.cpp"
+#undef NTC_SCAN_SCHEDULER_HEADER_INCLUDED
+
+#endif // NTC_SCAN_SCHEDULER_H
@@ -0,0 +1,128 @@
+/**
+ * @file ntc_snapshot.hpp
+ * @brief Lock-free single-writer, multi-reader snapshot of the latest value.
+ *
+ * This header provides a sequence lock that lets one sampling task publish
+ * readings while any number of consumers on other tasks or cores fetch the
+ * latest consistent copy, without a mutex and without touching the ADC.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_SNAPSHOT_H
+#define NTC_SNAPSHOT_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "ntc_types.hpp"
+
+//--------------------------------------
+//  NtcSnapshot Class
+//--------------------------------------
+
+/**
+ * @class NtcSnapshot
+ * @brief Sequence lock holding the latest published value
+ *
+ * Publish() bumps a sequence counter to odd, stores the value as relaxed
+ * atomic words and bumps the counter to even again. Read() copies the words
+ * and retries if the counter changed or was odd meanwhile, so a reader never
+ * sees a torn value and never blocks the writer.
+ *
+ * Only one task may call Publish(). Read() is safe from any number of tasks
+ * and cores. A reader that preempts the writer mid-publish on the same core
+ * cannot make progress, so Read() gives up with Busy after
+ * MAX_READ_ATTEMPTS_ attempts instead of spinning forever.
+ *
+ * @tparam T Trivially copyable value type
+ *
+ * @example
+ * @code
+ * NtcReadingSnapshot latest;
+ * thermistor.AttachSnapshot(&latest);
+ * // Sampling task: thermistor.ReadTemperature(&reading) or Poll()
+ * // Consumers:
+ * ntc_reading_t reading = {};
+ * if (latest.Read(&reading) == NtcError::Success && reading.is_valid) { ... }
+ * @endcode
+ */
+template <typename T> class NtcSnapshot {
+public:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Snapshot values are copied word by word");
+  static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                "Snapshot needs lock-free 32-bit atomics");
+
+  /// Read attempts before Read() reports Busy
+  static constexpr uint32_t MAX_READ_ATTEMPTS_ = 64U;
+
+  //==============================================================//
+  // CONSTRUCTORS
+  //==============================================================//
+
+  /**
+   * @brief Construct an empty snapshot
+   */
+  NtcSnapshot() noexcept;
+
+  NtcSnapshot(const NtcSnapshot &) = delete;
+  NtcSnapshot &operator=(const NtcSnapshot &) = delete;
+
+  //==============================================================//
+  // PUBLISHING
+  //==============================================================//
+
+  /**
+   * @brief Replace the published value (single writer only)
+   * @param value Value to publish
+   */
+  void Publish(const T &value) noexcept;
+
+  //==============================================================//
+  // READING
+  //==============================================================//
+
+  /**
+   * @brief Copy the latest published value
+   * @param value Pointer to store the value
+   * @param sequence Pointer to store the publish count of the value (may be
+   *                 nullptr); a changed count means a new value
+   * @return Error code (NotInitialized before the first Publish(), Busy if
+   *         the writer kept interrupting the copy)
+   */
+  NtcError Read(T *value, uint32_t *sequence = nullptr) const noexcept;
+
+  /**
+   * @brief Get the number of values published so far
+   * @return Publish count
+   */
+  [[nodiscard]] uint32_t Sequence() const noexcept;
+
+private:
+  //==============================================================//
+  // PRIVATE MEMBER VARIABLES
+  //==============================================================//
+
+  static constexpr size_t WORD_COUNT_ =
+      (sizeof(T) + sizeof(uint32_t) - 1U) / sizeof(uint32_t); ///< Words of T
+
+  std::atomic<uint32_t> sequence_; ///< Odd while a publish is in progress
+  std::array<std::atomic<uint32_t>, WORD_COUNT_> words_; ///< Value words
+};
+
+/// Snapshot of the latest NtcThermistor reading
+using NtcReadingSnapshot = NtcSnapshot<ntc_reading_t>;
+
+// Include template implementation
+#define NTC_SNAPSHOT_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Template implementation file
+#include "../src/ntc_snapshot.cpp"
+#undef NTC_SNAPSHOT_HEADER_INCLUDED
+
+#endif // NTC_SNAPSHOT_H
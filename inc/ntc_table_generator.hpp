@@ -0,0 +1,738 @@
+/**
+ * @file ntc_table_generator.hpp
+ * @brief Compile-time lookup table generation for NTC thermistors.
+ *
+ * This header provides a constexpr generator that builds an
+ * ntc_lookup_table_t for any thermistor described by its resistance at 25°C
+ * and beta value. The table is evaluated entirely at compile time and placed
+ * in read-only storage (flash on embedded targets), so custom parts get the
+ * fast lookup path without runtime table building or RAM cost.
+ *
+ * Two layouts are available:
+ * - MakeNtcTable(): entries at uniform temperature steps (binary search)
+ * - MakeNtcLogTable(): entries at uniform resistance key steps (O(1) index)
+ *   plus a uint16_t reverse temperature index (O(1) reverse lookup)
+ * - MakeNtcCompactTable(): MakeNtcLogTable() layout stored as uint16_t
+ *   temperature codes (2 bytes per entry instead of 8, plus the index)
+ *
+ * Generated resistances are in ohms and follow the same beta equation as
+ * NTC::ConvertTemperatureToResistanceBeta(), so they are directly comparable
+ * with the values produced by NTC::CalculateThermistorResistance().
+ *
+ * @example
+ * @code
+ * // 47kΩ @ 25°C, β=4050K, -20°C to +100°C in 1°C steps
+ * const NTC::ntc_lookup_table_t *table =
+ *     NTC::MakeNtcTable<47000, 4050, -20, 100, 1>();
+ *
+ * // Same part, 32 entries per resistance octave, O(1) lookup
+ * const NTC::ntc_lookup_table_t *fast_table =
+ *     NTC::MakeNtcLogTable<47000, 4050, -20, 100, 32>();
+ * @endcode
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_TABLE_GENERATOR_H
+#define NTC_TABLE_GENERATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ntc_conversion.hpp"
+#include "ntc_lookup_table.hpp"
+
+namespace NTC {
+
+//--------------------------------------
+//  Compile-Time Math Helpers
+//--------------------------------------
+
+namespace Generator {
+
+/**
+ * @brief Compile-time exponential function
+ *
+ * std::exp is not constexpr before C++26, so the generator uses its own
+ * implementation: the argument is halved until it is small, a Taylor series
+ * is evaluated, and the result is squared back up.
+ *
+ * @param value Exponent
+ * @return e raised to value
+ */
+[[nodiscard]] constexpr double ConstexprExp(double value) noexcept {
+  constexpr double REDUCTION_LIMIT_ = 0.5;
+  constexpr int SERIES_TERMS_ = 20;
+
+  int halvings = 0;
+  while (value > REDUCTION_LIMIT_ || value < -REDUCTION_LIMIT_) {
+    value /= 2.0;
+    halvings++;
+  }
+
+  double sum = 1.0;
+  double term = 1.0;
+  for (int i = 1; i <= SERIES_TERMS_; ++i) {
+    term *= value / static_cast<double>(i);
+    sum += term;
+  }
+
+  for (int i = 0; i < halvings; ++i) {
+    sum *= sum;
+  }
+  return sum;
+}
+
+/**
+ * @brief Compile-time beta equation resistance
+ * @param temperature_celsius Temperature (°C)
+ * @param resistance_at_25c Resistance at 25°C (ohms)
+ * @param beta_value Beta value (K)
+ * @return Thermistor resistance (ohms)
+ */
+[[nodiscard]] constexpr double
+BetaResistance(double temperature_celsius, double resistance_at_25c,
+               double beta_value) noexcept {
+  constexpr double REFERENCE_KELVIN_ =
+      static_cast<double>(Constants::REFERENCE_TEMPERATURE_C_) +
+      static_cast<double>(Constants::KELVIN_OFFSET_);
+  const double temp_kelvin =
+      temperature_celsius + static_cast<double>(Constants::KELVIN_OFFSET_);
+  return resistance_at_25c *
+         ConstexprExp(beta_value *
+                      ((1.0 / temp_kelvin) - (1.0 / REFERENCE_KELVIN_)));
+}
+
+/**
+ * @brief Compile-time natural logarithm
+ *
+ * The argument is split into a power of two and a mantissa in [1, 2); the
+ * mantissa logarithm is evaluated with the atanh series.
+ *
+ * @param value Argument (must be positive)
+ * @return Natural logarithm of value
+ */
+[[nodiscard]] constexpr double ConstexprLog(double value) noexcept {
+  constexpr double LN2_ = 0.69314718055994530942;
+  constexpr int SERIES_TERMS_ = 30;
+
+  int exponent = 0;
+  while (value >= 2.0) {
+    value /= 2.0;
+    exponent++;
+  }
+  while (value < 1.0) {
+    value *= 2.0;
+    exponent--;
+  }
+
+  const double z = (value - 1.0) / (value + 1.0);
+  const double z_squared = z * z;
+  double power = z;
+  double sum = 0.0;
+  for (int i = 0; i < SERIES_TERMS_; ++i) {
+    sum += power / static_cast<double>((2 * i) + 1);
+    power *= z_squared;
+  }
+  return (2.0 * sum) + (static_cast<double>(exponent) * LN2_);
+}
+
+/**
+ * @brief Compile-time beta equation temperature
+ * @param resistance_ohms Thermistor resistance (ohms)
+ * @param resistance_at_25c Resistance at 25°C (ohms)
+ * @param beta_value Beta value (K)
+ * @return Temperature (°C)
+ */
+[[nodiscard]] constexpr double
+BetaTemperature(double resistance_ohms, double resistance_at_25c,
+                double beta_value) noexcept {
+  constexpr double REFERENCE_KELVIN_ =
+      static_cast<double>(Constants::REFERENCE_TEMPERATURE_C_) +
+      static_cast<double>(Constants::KELVIN_OFFSET_);
+  const double inv_temperature =
+      (1.0 / REFERENCE_KELVIN_) +
+      (ConstexprLog(resistance_ohms / resistance_at_25c) / beta_value);
+  return (1.0 / inv_temperature) -
+         static_cast<double>(Constants::KELVIN_OFFSET_);
+}
+
+/// Number of mantissa bits in an IEEE-754 single precision float
+constexpr uint32_t FLOAT_MANTISSA_BITS_ = 23U;
+/// Exponent bias of an IEEE-754 single precision float
+constexpr int32_t FLOAT_EXPONENT_BIAS_ = 127;
+
+/**
+ * @brief Compile-time resistance key (see NTC::ResistanceKey())
+ *
+ * Matches the bit pattern of the value rounded down to float precision.
+ *
+ * @param resistance_ohms Resistance (ohms), must be positive and normal
+ * @return Resistance key
+ */
+[[nodiscard]] constexpr uint32_t
+KeyFromResistance(double resistance_ohms) noexcept {
+  int32_t exponent = 0;
+  while (resistance_ohms >= 2.0) {
+    resistance_ohms /= 2.0;
+    exponent++;
+  }
+  while (resistance_ohms < 1.0) {
+    resistance_ohms *= 2.0;
+    exponent--;
+  }
+  const auto mantissa = static_cast<uint32_t>(
+      (resistance_ohms - 1.0) *
+      static_cast<double>(1UL << FLOAT_MANTISSA_BITS_));
+  return (static_cast<uint32_t>(exponent + FLOAT_EXPONENT_BIAS_)
+          << FLOAT_MANTISSA_BITS_) |
+         mantissa;
+}
+
+/**
+ * @brief Compile-time resistance from resistance key
+ * @param key Resistance key
+ * @return Resistance (ohms), exactly representable as float
+ */
+[[nodiscard]] constexpr double ResistanceFromKey(uint32_t key) noexcept {
+  const int32_t exponent =
+      static_cast<int32_t>(key >> FLOAT_MANTISSA_BITS_) - FLOAT_EXPONENT_BIAS_;
+  const uint32_t mantissa = key & ((1UL << FLOAT_MANTISSA_BITS_) - 1UL);
+  double value =
+      1.0 + (static_cast<double>(mantissa) /
+             static_cast<double>(1UL << FLOAT_MANTISSA_BITS_));
+  for (int32_t i = 0; i < exponent; ++i) {
+    value *= 2.0;
+  }
+  for (int32_t i = 0; i > exponent; --i) {
+    value /= 2.0;
+  }
+  return value;
+}
+
+/**
+ * @brief Generate lookup table entries at compile time
+ *
+ * Entries are ordered by ascending temperature, i.e. descending resistance,
+ * which is the ordering expected by the lookup functions.
+ *
+ * @tparam Count Number of entries
+ * @param resistance_at_25c Resistance at 25°C (ohms)
+ * @param beta_value Beta value (K)
+ * @param min_temperature First table temperature (°C)
+ * @param step_temperature Temperature step between entries (°C)
+ * @return Array of lookup entries
+ */
+template <size_t Count>
+[[nodiscard]] constexpr std::array<ntc_lookup_entry_t, Count>
+GenerateEntries(double resistance_at_25c, double beta_value,
+                double min_temperature, double step_temperature) noexcept {
+  std::array<ntc_lookup_entry_t, Count> entries{};
+  for (size_t i = 0; i < Count; ++i) {
+    const double temperature =
+        min_temperature + (static_cast<double>(i) * step_temperature);
+    entries[i].resistance_ohms = static_cast<float>(
+        BetaResistance(temperature, resistance_at_25c, beta_value));
+    entries[i].temperature_celsius = static_cast<float>(temperature);
+  }
+  return entries;
+}
+
+/**
+ * @brief Check compile-time table ordering and resistance range
+ * @tparam Count Number of entries
+ * @param entries Generated entries
+ * @return true if resistances are strictly descending and within the valid
+ * ohm range of the conversion functions
+ */
+template <size_t Count>
+[[nodiscard]] constexpr bool
+EntriesAreValid(const std::array<ntc_lookup_entry_t, Count> &entries) noexcept {
+  for (size_t i = 0; i < Count; ++i) {
+    if (entries[i].resistance_ohms < Constants::MIN_RESISTANCE_OHMS_ ||
+        entries[i].resistance_ohms > Constants::MAX_RESISTANCE_OHMS_) {
+      return false;
+    }
+    if (i > 0 && entries[i].resistance_ohms >= entries[i - 1].resistance_ohms) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Generate uniformly keyed lookup table entries at compile time
+ *
+ * Entry i sits at resistance key first_key - i * key_step, so entries are
+ * ordered by descending resistance and every octave boundary falls on an
+ * entry (key_step divides 2^23).
+ *
+ * @tparam Count Number of entries
+ * @param resistance_at_25c Resistance at 25°C (ohms)
+ * @param beta_value Beta value (K)
+ * @param first_key Resistance key of the first (largest) entry
+ * @param key_step Key spacing between entries
+ * @return Array of lookup entries
+ */
+template <size_t Count>
+[[nodiscard]] constexpr std::array<ntc_lookup_entry_t, Count>
+GenerateLogEntries(double resistance_at_25c, double beta_value,
+                   uint32_t first_key, uint32_t key_step) noexcept {
+  std::array<ntc_lookup_entry_t, Count> entries{};
+  for (size_t i = 0; i < Count; ++i) {
+    const double resistance = ResistanceFromKey(
+        first_key - (static_cast<uint32_t>(i) * key_step));
+    entries[i].resistance_ohms = static_cast<float>(resistance);
+    entries[i].temperature_celsius = static_cast<float>(
+        BetaTemperature(resistance, resistance_at_25c, beta_value));
+  }
+  return entries;
+}
+
+/**
+ * @brief Generate compact table temperature codes at compile time
+ *
+ * Code i is the temperature of the entry at resistance key
+ * first_key - i * key_step, in code_step units above the first entry's
+ * temperature, rounded to nearest.
+ *
+ * @tparam Count Number of entries
+ * @param resistance_at_25c Resistance at 25°C (ohms)
+ * @param beta_value Beta value (K)
+ * @param first_key Resistance key of the first (largest) entry
+ * @param key_step Key spacing between entries
+ * @param code_step Temperature per code (°C)
+ * @return Array of temperature codes
+ */
+template <size_t Count>
+[[nodiscard]] constexpr std::array<uint16_t, Count>
+GenerateCompactCodes(double resistance_at_25c, double beta_value,
+                     uint32_t first_key, uint32_t key_step,
+                     double code_step) noexcept {
+  std::array<uint16_t, Count> codes{};
+  const double first_temperature = static_cast<double>(
+      static_cast<float>(BetaTemperature(ResistanceFromKey(first_key),
+                                         resistance_at_25c, beta_value)));
+  for (size_t i = 0; i < Count; ++i) {
+    const double temperature = BetaTemperature(
+        ResistanceFromKey(first_key - (static_cast<uint32_t>(i) * key_step)),
+        resistance_at_25c, beta_value);
+    codes[i] = static_cast<uint16_t>(
+        ((temperature - first_temperature) / code_step) + 0.5);
+  }
+  return codes;
+}
+
+/**
+ * @brief Get the entry temperatures of generated entries
+ * @tparam Count Number of entries
+ * @param entries Generated entries
+ * @return Entry temperatures (°C)
+ */
+template <size_t Count>
+[[nodiscard]] constexpr std::array<float, Count> EntryTemperatures(
+    const std::array<ntc_lookup_entry_t, Count> &entries) noexcept {
+  std::array<float, Count> temperatures{};
+  for (size_t i = 0; i < Count; ++i) {
+    temperatures[i] = entries[i].temperature_celsius;
+  }
+  return temperatures;
+}
+
+/**
+ * @brief Get the entry temperatures of compact table codes
+ *
+ * Decodes codes exactly as the lookups do, so the reverse index built from
+ * them matches the decoded table.
+ *
+ * @tparam Count Number of entries
+ * @param codes Generated temperature codes
+ * @param first_temperature Temperature of the first entry (°C)
+ * @param code_step Temperature per code (°C)
+ * @return Entry temperatures (°C)
+ */
+template <size_t Count>
+[[nodiscard]] constexpr std::array<float, Count>
+CodeTemperatures(const std::array<uint16_t, Count> &codes,
+                 float first_temperature, float code_step) noexcept {
+  std::array<float, Count> temperatures{};
+  for (size_t i = 0; i < Count; ++i) {
+    temperatures[i] =
+        first_temperature + (static_cast<float>(codes[i]) * code_step);
+  }
+  return temperatures;
+}
+
+/**
+ * @brief Get the reverse index bucket density of a temperature range
+ * @param first_temperature Temperature of the first entry (°C)
+ * @param last_temperature Temperature of the last entry (°C)
+ * @param bucket_count Number of buckets
+ * @return Buckets per °C
+ */
+[[nodiscard]] constexpr float
+TemperatureIndexDensity(float first_temperature, float last_temperature,
+                        size_t bucket_count) noexcept {
+  return static_cast<float>(bucket_count) /
+         (last_temperature - first_temperature);
+}
+
+/**
+ * @brief Generate the reverse (temperature to entry) index at compile time
+ *
+ * Bucket b holds the last entry that starts a segment at or below the
+ * bucket start (see NTC::TemperatureIndexBucketStart()).
+ *
+ * @tparam Count Number of entries
+ * @tparam BucketCount Number of buckets
+ * @param temperatures Entry temperatures (°C, strictly ascending)
+ * @param inverse_index_step Buckets per °C
+ * @return Reverse index
+ */
+template <size_t Count, size_t BucketCount>
+[[nodiscard]] constexpr std::array<uint16_t, BucketCount>
+GenerateTemperatureIndex(const std::array<float, Count> &temperatures,
+                         float inverse_index_step) noexcept {
+  static_assert(Count >= 2U && Count - 1U <= UINT16_MAX,
+                "Reverse index entries must fit in uint16_t");
+  std::array<uint16_t, BucketCount> index{};
+  size_t entry = 0;
+  for (size_t bucket = 1; bucket < BucketCount; ++bucket) {
+    const float start = TemperatureIndexBucketStart(
+        temperatures[0], inverse_index_step, bucket);
+    while (entry + 2U < Count && temperatures[entry + 1U] <= start) {
+      entry++;
+    }
+    index[bucket] = static_cast<uint16_t>(entry);
+  }
+  return index;
+}
+
+} // namespace Generator
+
+//--------------------------------------
+//  Generated Table Storage
+//--------------------------------------
+
+/**
+ * @brief Compile-time generated lookup table for a beta-model thermistor
+ *
+ * Each distinct parameter set instantiates exactly one constexpr table in
+ * read-only storage. Identical parameters share the same instantiation.
+ * Entries are spaced uniformly in temperature, so
+ * NTC::FindResistanceFromLookupTable() indexes such tables in O(1).
+ *
+ * @tparam ResistanceAt25cOhms Resistance at 25°C (ohms)
+ * @tparam BetaValueK Beta value (K)
+ * @tparam MinTemperatureC First table temperature (°C)
+ * @tparam MaxTemperatureC Last table temperature (°C)
+ * @tparam StepTemperatureC Temperature step between entries (°C)
+ */
+template <uint32_t ResistanceAt25cOhms, uint32_t BetaValueK,
+          int32_t MinTemperatureC, int32_t MaxTemperatureC,
+          uint32_t StepTemperatureC = 1U>
+struct GeneratedNtcTable {
+  static_assert(StepTemperatureC > 0U, "Temperature step must be positive");
+  static_assert(MaxTemperatureC > MinTemperatureC,
+                "Maximum temperature must exceed minimum temperature");
+  static_assert((MaxTemperatureC - MinTemperatureC) %
+                        static_cast<int32_t>(StepTemperatureC) ==
+                    0,
+                "Temperature range must be a multiple of the step");
+  static_assert(MinTemperatureC >
+                    static_cast<int32_t>(Constants::ABSOLUTE_ZERO_CELSIUS_),
+                "Minimum temperature must be above absolute zero");
+  static_assert(static_cast<float>(BetaValueK) >= Constants::MIN_BETA_VALUE_ &&
+                    static_cast<float>(BetaValueK) <= Constants::MAX_BETA_VALUE_,
+                "Beta value out of supported range");
+
+  /// Number of table entries
+  static constexpr size_t ENTRY_COUNT =
+      static_cast<size_t>((MaxTemperatureC - MinTemperatureC) /
+                          static_cast<int32_t>(StepTemperatureC)) +
+      1U;
+
+  /// Generated entries (ascending temperature, descending resistance)
+  static constexpr std::array<ntc_lookup_entry_t, ENTRY_COUNT> ENTRIES =
+      Generator::GenerateEntries<ENTRY_COUNT>(
+          static_cast<double>(ResistanceAt25cOhms),
+          static_cast<double>(BetaValueK),
+          static_cast<double>(MinTemperatureC),
+          static_cast<double>(StepTemperatureC));
+
+  static_assert(Generator::EntriesAreValid(ENTRIES),
+                "Generated resistances must be strictly descending and within "
+                "the valid ohm range");
+
+  /// Lookup table descriptor referencing ENTRIES
+  static constexpr ntc_lookup_table_t TABLE = {
+      .entries = ENTRIES.data(),
+      .entry_count = ENTRY_COUNT,
+      .min_resistance = ENTRIES[ENTRY_COUNT - 1U].resistance_ohms,
+      .max_resistance = ENTRIES[0].resistance_ohms,
+      .min_temperature = static_cast<float>(MinTemperatureC),
+      .max_temperature = static_cast<float>(MaxTemperatureC),
+      .resistance_step = 0.0F, // Resistance spacing is not uniform
+      .inverse_resistance_step = 0.0F,
+      .inverse_temperature_step =
+          1.0F / static_cast<float>(StepTemperatureC),
+      .temperature_codes = nullptr,
+      .temperature_code_step = 0.0F,
+      .temperature_index = nullptr, // Indexed by the temperature step
+      .temperature_index_count = 0U,
+      .inverse_index_step = 0.0F};
+};
+
+/**
+ * @brief Compile-time generated, uniformly keyed lookup table
+ *
+ * Entries are spaced uniformly in the resistance key domain (a fixed-point
+ * log2(R), see NTC::ResistanceKey()) with SegmentsPerOctave entries per
+ * doubling of resistance. NTC::FindTemperatureFromLookupTable() indexes such
+ * tables in O(1). A reverse index with one uint16_t bucket per entry, at
+ * uniform temperature spacing, keeps NTC::FindResistanceFromLookupTable()
+ * O(1) as well. The table covers at least [MinTemperatureC,
+ * MaxTemperatureC]; its endpoints are rounded outward to the key grid.
+ *
+ * @tparam ResistanceAt25cOhms Resistance at 25°C (ohms)
+ * @tparam BetaValueK Beta value (K)
+ * @tparam MinTemperatureC Lowest temperature to cover (°C)
+ * @tparam MaxTemperatureC Highest temperature to cover (°C)
+ * @tparam SegmentsPerOctave Entries per resistance octave (power of two)
+ */
+template <uint32_t ResistanceAt25cOhms, uint32_t BetaValueK,
+          int32_t MinTemperatureC, int32_t MaxTemperatureC,
+          uint32_t SegmentsPerOctave = 32U>
+struct GeneratedNtcLogTable {
+  static_assert(SegmentsPerOctave > 0U &&
+                    (SegmentsPerOctave & (SegmentsPerOctave - 1U)) == 0U &&
+                    SegmentsPerOctave <=
+                        (1UL << Generator::FLOAT_MANTISSA_BITS_),
+                "Segments per octave must be a power of two");
+  static_assert(MaxTemperatureC > MinTemperatureC,
+                "Maximum temperature must exceed minimum temperature");
+  static_assert(MinTemperatureC >
+                    static_cast<int32_t>(Constants::ABSOLUTE_ZERO_CELSIUS_),
+                "Minimum temperature must be above absolute zero");
+  static_assert(static_cast<float>(BetaValueK) >= Constants::MIN_BETA_VALUE_ &&
+                    static_cast<float>(BetaValueK) <= Constants::MAX_BETA_VALUE_,
+                "Beta value out of supported range");
+
+  /// Key spacing between entries
+  static constexpr uint32_t KEY_STEP =
+      static_cast<uint32_t>((1UL << Generator::FLOAT_MANTISSA_BITS_) /
+                            SegmentsPerOctave);
+
+  /// Key of the first entry (at or above the resistance at MinTemperatureC)
+  static constexpr uint32_t FIRST_KEY =
+      ((Generator::KeyFromResistance(Generator::BetaResistance(
+            MinTemperatureC, ResistanceAt25cOhms, BetaValueK)) +
+        KEY_STEP - 1U) /
+       KEY_STEP) *
+      KEY_STEP;
+
+  /// Key of the last entry (at or below the resistance at MaxTemperatureC)
+  static constexpr uint32_t LAST_KEY =
+      (Generator::KeyFromResistance(Generator::BetaResistance(
+           MaxTemperatureC, ResistanceAt25cOhms, BetaValueK)) /
+       KEY_STEP) *
+      KEY_STEP;
+
+  /// Number of table entries
+  static constexpr size_t ENTRY_COUNT =
+      static_cast<size_t>((FIRST_KEY - LAST_KEY) / KEY_STEP) + 1U;
+
+  /// Generated entries (descending resistance at uniform key spacing)
+  static constexpr std::array<ntc_lookup_entry_t, ENTRY_COUNT> ENTRIES =
+      Generator::GenerateLogEntries<ENTRY_COUNT>(
+          static_cast<double>(ResistanceAt25cOhms),
+          static_cast<double>(BetaValueK), FIRST_KEY, KEY_STEP);
+
+  static_assert(Generator::EntriesAreValid(ENTRIES),
+                "Generated resistances must be strictly descending and within "
+                "the valid ohm range");
+
+  /// Reverse index buckets per °C (one bucket per entry)
+  static constexpr float INDEX_DENSITY = Generator::TemperatureIndexDensity(
+      ENTRIES[0].temperature_celsius,
+      ENTRIES[ENTRY_COUNT - 1U].temperature_celsius, ENTRY_COUNT);
+
+  /// Reverse index: temperature bucket -> first candidate entry
+  static constexpr std::array<uint16_t, ENTRY_COUNT> TEMPERATURE_INDEX =
+      Generator::GenerateTemperatureIndex<ENTRY_COUNT, ENTRY_COUNT>(
+          Generator::EntryTemperatures(ENTRIES), INDEX_DENSITY);
+
+  /// Lookup table descriptor referencing ENTRIES
+  static constexpr ntc_lookup_table_t TABLE = {
+      .entries = ENTRIES.data(),
+      .entry_count = ENTRY_COUNT,
+      .min_resistance = ENTRIES[ENTRY_COUNT - 1U].resistance_ohms,
+      .max_resistance = ENTRIES[0].resistance_ohms,
+      .min_temperature = ENTRIES[0].temperature_celsius,
+      .max_temperature = ENTRIES[ENTRY_COUNT - 1U].temperature_celsius,
+      .resistance_step = static_cast<float>(KEY_STEP),
+      .inverse_resistance_step = 1.0F / static_cast<float>(KEY_STEP),
+      .inverse_temperature_step = 0.0F, // Temperature spacing is not uniform
+      .temperature_codes = nullptr,
+      .temperature_code_step = 0.0F,
+      .temperature_index = TEMPERATURE_INDEX.data(),
+      .temperature_index_count = ENTRY_COUNT,
+      .inverse_index_step = INDEX_DENSITY};
+};
+
+/**
+ * @brief Compile-time generated, uniformly keyed compact lookup table
+ *
+ * Same entry grid as GeneratedNtcLogTable, but only a uint16_t temperature
+ * code is stored per entry; resistances are implied by the key grid. Codes
+ * have a resolution of CODE_STEP (0.01°C), so the table spans at most
+ * 655.35°C and adds at most 0.005°C of quantization error.
+ *
+ * @tparam ResistanceAt25cOhms Resistance at 25°C (ohms)
+ * @tparam BetaValueK Beta value (K)
+ * @tparam MinTemperatureC Lowest temperature to cover (°C)
+ * @tparam MaxTemperatureC Highest temperature to cover (°C)
+ * @tparam SegmentsPerOctave Entries per resistance octave (power of two)
+ */
+template <uint32_t ResistanceAt25cOhms, uint32_t BetaValueK,
+          int32_t MinTemperatureC, int32_t MaxTemperatureC,
+          uint32_t SegmentsPerOctave = 32U>
+struct GeneratedNtcCompactTable {
+  /// Entry grid shared with the float layout (no float storage is emitted)
+  using Grid = GeneratedNtcLogTable<ResistanceAt25cOhms, BetaValueK,
+                                    MinTemperatureC, MaxTemperatureC,
+                                    SegmentsPerOctave>;
+
+  /// Temperature per code (°C)
+  static constexpr double CODE_STEP = 0.01;
+
+  static_assert(static_cast<double>(MaxTemperatureC - MinTemperatureC) /
+                        CODE_STEP <
+                    static_cast<double>(UINT16_MAX),
+                "Temperature range too wide for 16-bit codes");
+
+  /// Temperature of the first entry (°C)
+  static constexpr float FIRST_TEMPERATURE =
+      static_cast<float>(Generator::BetaTemperature(
+          Generator::ResistanceFromKey(Grid::FIRST_KEY),
+          static_cast<double>(ResistanceAt25cOhms),
+          static_cast<double>(BetaValueK)));
+
+  /// Generated temperature codes (ascending, one per key grid entry)
+  static constexpr std::array<uint16_t, Grid::ENTRY_COUNT> CODES =
+      Generator::GenerateCompactCodes<Grid::ENTRY_COUNT>(
+          static_cast<double>(ResistanceAt25cOhms),
+          static_cast<double>(BetaValueK), Grid::FIRST_KEY, Grid::KEY_STEP,
+          CODE_STEP);
+
+  /// Reverse index buckets per °C (one bucket per entry)
+  static constexpr float INDEX_DENSITY = Generator::TemperatureIndexDensity(
+      FIRST_TEMPERATURE,
+      FIRST_TEMPERATURE + (static_cast<float>(CODES[Grid::ENTRY_COUNT - 1U]) *
+                           static_cast<float>(CODE_STEP)),
+      Grid::ENTRY_COUNT);
+
+  /// Reverse index: temperature bucket -> first candidate entry
+  static constexpr std::array<uint16_t, Grid::ENTRY_COUNT>
+      TEMPERATURE_INDEX =
+          Generator::GenerateTemperatureIndex<Grid::ENTRY_COUNT,
+                                              Grid::ENTRY_COUNT>(
+              Generator::CodeTemperatures(CODES, FIRST_TEMPERATURE,
+                                          static_cast<float>(CODE_STEP)),
+              INDEX_DENSITY);
+
+  /// Lookup table descriptor referencing CODES
+  static constexpr ntc_lookup_table_t TABLE = {
+      .entries = nullptr,
+      .entry_count = Grid::ENTRY_COUNT,
+      .min_resistance = static_cast<float>(
+          Generator::ResistanceFromKey(Grid::LAST_KEY)),
+      .max_resistance = static_cast<float>(
+          Generator::ResistanceFromKey(Grid::FIRST_KEY)),
+      .min_temperature = FIRST_TEMPERATURE,
+      .max_temperature =
+          FIRST_TEMPERATURE +
+          (static_cast<float>(CODES[Grid::ENTRY_COUNT - 1U]) *
+           static_cast<float>(CODE_STEP)),
+      .resistance_step = static_cast<float>(Grid::KEY_STEP),
+      .inverse_resistance_step = 1.0F / static_cast<float>(Grid::KEY_STEP),
+      .inverse_temperature_step = 0.0F, // Temperature spacing is not uniform
+      .temperature_codes = CODES.data(),
+      .temperature_code_step = static_cast<float>(CODE_STEP),
+      .temperature_index = TEMPERATURE_INDEX.data(),
+      .temperature_index_count = Grid::ENTRY_COUNT,
+      .inverse_index_step = INDEX_DENSITY};
+
+  static_assert(ValidateLookupTable(&TABLE),
+                "Generated temperature codes must be strictly ascending");
+};
+
+/**
+ * @brief Get a compile-time generated lookup table
+ *
+ * @tparam ResistanceAt25cOhms Resistance at 25°C (ohms)
+ * @tparam BetaValueK Beta value (K)
+ * @tparam MinTemperatureC First table temperature (°C)
+ * @tparam MaxTemperatureC Last table temperature (°C)
+ * @tparam StepTemperatureC Temperature step between entries (°C)
+ * @return Pointer to the generated table (static storage duration)
+ *
+ * @see NtcThermistor::SetLookupTable() to attach the table to an instance
+ */
+template <uint32_t ResistanceAt25cOhms, uint32_t BetaValueK,
+          int32_t MinTemperatureC, int32_t MaxTemperatureC,
+          uint32_t StepTemperatureC = 1U>
+[[nodiscard]] constexpr const ntc_lookup_table_t *MakeNtcTable() noexcept {
+  return &GeneratedNtcTable<ResistanceAt25cOhms, BetaValueK, MinTemperatureC,
+                            MaxTemperatureC, StepTemperatureC>::TABLE;
+}
+
+/**
+ * @brief Get a compile-time generated, uniformly keyed lookup table
+ *
+ * @tparam ResistanceAt25cOhms Resistance at 25°C (ohms)
+ * @tparam BetaValueK Beta value (K)
+ * @tparam MinTemperatureC Lowest temperature to cover (°C)
+ * @tparam MaxTemperatureC Highest temperature to cover (°C)
+ * @tparam SegmentsPerOctave Entries per resistance octave (power of two)
+ * @return Pointer to the generated table (static storage duration)
+ *
+ * @see NtcThermistor::SetLookupTable() to attach the table to an instance
+ */
+template <uint32_t ResistanceAt25cOhms, uint32_t BetaValueK,
+          int32_t MinTemperatureC, int32_t MaxTemperatureC,
+          uint32_t SegmentsPerOctave = 32U>
+[[nodiscard]] constexpr const ntc_lookup_table_t *MakeNtcLogTable() noexcept {
+  return &GeneratedNtcLogTable<ResistanceAt25cOhms, BetaValueK,
+                               MinTemperatureC, MaxTemperatureC,
+                               SegmentsPerOctave>::TABLE;
+}
+
+/**
+ * @brief Get a compile-time generated, uniformly keyed compact lookup table
+ *
+ * @tparam ResistanceAt25cOhms Resistance at 25°C (ohms)
+ * @tparam BetaValueK Beta value (K)
+ * @tparam MinTemperatureC Lowest temperature to cover (°C)
+ * @tparam MaxTemperatureC Highest temperature to cover (°C)
+ * @tparam SegmentsPerOctave Entries per resistance octave (power of two)
+ * @return Pointer to the generated table (static storage duration)
+ *
+ * @see NtcThermistor::SetLookupTable() to attach the table to an instance
+ */
+template <uint32_t ResistanceAt25cOhms, uint32_t BetaValueK,
+          int32_t MinTemperatureC, int32_t MaxTemperatureC,
+          uint32_t SegmentsPerOctave = 32U>
+[[nodiscard]] constexpr const ntc_lookup_table_t *
+MakeNtcCompactTable() noexcept {
+  return &GeneratedNtcCompactTable<ResistanceAt25cOhms, BetaValueK,
+                                   MinTemperatureC, MaxTemperatureC,
+                                   SegmentsPerOctave>::TABLE;
+}
+
+} // namespace NTC
+
+#endif // NTC_TABLE_GENERATOR_H
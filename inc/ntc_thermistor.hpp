@@ -14,12 +14,22 @@
 #ifndef NTC_THERMISTOR_H
 #define NTC_THERMISTOR_H
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
+#include "ntc_acquisition.hpp"
 #include "ntc_adc_interface.hpp"
+#include "ntc_history.hpp"
+#include "ntc_lookup_table.hpp"
+#include "ntc_snapshot.hpp"
 #include "ntc_types.hpp"
 
+template <typename AdcType, size_t ChannelCount> class NtcThermistorArray;
+template <typename AdcType> class NtcThermistorQ;
+template <typename AdcType, typename Config> class StaticNtcThermistor;
+
 //--------------------------------------
 //  NtcThermistor Class
 //--------------------------------------
@@ -35,7 +45,8 @@
  * Key features:
  * - Hardware-agnostic design using CRTP-based ADC interface
  * - Support for multiple NTC types
- * - Dual conversion methods (lookup table and mathematical)
+ * - Lookup table, ADC count table, Beta and Steinhart-Hart conversion, with
+ *   cost-based automatic selection
  * - Built-in calibration and filtering
  * - Comprehensive error handling
  *
@@ -212,11 +223,94 @@ public:
 
   /**
    * @brief Read complete temperature information
+   *
+   * Performs a single acquisition burst and derives voltage, resistance and
+   * temperature (°C, °F, K) from it, so every field of the reading describes
+   * the same ADC samples. The number of ADC conversions used is reported in
+   * ntc_reading_t::adc_conversions. If the ADC type provides
+   * ReadTimestampUs() (see ntc::HasReadTimestampUs), timestamp_us is the
+   * midpoint of the burst; otherwise it is 0.
+   *
    * @param reading Pointer to store reading information
    * @return Error code
    */
   NtcError ReadTemperature(ntc_reading_t *reading) noexcept;
 
+  /**
+   * @brief Read complete temperature information only if it changed
+   *
+   * Change-driven reporting: after the acquisition, the raw ADC count is
+   * compared with the count of the last reported reading. If it moved by
+   * less than report_deadband_counts, conversion is skipped and Unchanged is
+   * returned with the reading untouched, so the caller can skip its publish
+   * too. Comparing against the last reported count (not the last sample)
+   * gives hysteresis: slow drift is reported once it adds up to the
+   * deadband. Failed readings are always reported.
+   *
+   * @param reading Pointer to store reading information
+   * @return Complete when reading was filled in (check its error field),
+   *         Unchanged when the count is within the deadband, Idle if
+   *         reading is nullptr
+   */
+  NtcConversionStatus ReadTemperatureIfChanged(ntc_reading_t *reading) noexcept;
+
+  /**
+   * @brief Get the number of ADC conversions used by the last acquisition
+   * @return ADC conversions performed by the most recent read call
+   */
+  [[nodiscard]] uint32_t GetLastAdcConversionCount() const noexcept;
+
+  //==============================================================//
+  // ASYNCHRONOUS READING
+  //==============================================================//
+
+  /**
+   * @brief Start a non-blocking conversion
+   *
+   * Arms an acquisition of sample_count samples spaced sample_delay_ms
+   * apart. Samples are taken by Poll() as their time comes instead of
+   * busy-waiting, so one task can overlap conversions of many sensors.
+   *
+   * @param now_us Current time (microseconds, any monotonic time base)
+   * @return Error code (Busy if a conversion is already in progress)
+   */
+  NtcError StartConversion(uint64_t now_us) noexcept;
+
+  /**
+   * @brief Advance a non-blocking conversion
+   *
+   * Takes every sample that is due at now_us. When the last sample has been
+   * taken the reading is converted exactly like ReadTemperature() and
+   * reading->timestamp_us is set to the midpoint between the first and the
+   * last sample, in the now_us time base.
+   *
+   * @param now_us Current time (same time base as StartConversion())
+   * @param reading Pointer to store the reading once complete
+   * @return Idle if no conversion is running (or reading is nullptr),
+   *         InProgress while samples are pending, Complete once reading is
+   *         filled in, Unchanged when the conversion finished within the
+   *         report deadband (see ReadTemperatureIfChanged())
+   */
+  NtcConversionStatus Poll(uint64_t now_us, ntc_reading_t *reading) noexcept;
+
+  /**
+   * @brief Abandon a non-blocking conversion
+   */
+  void CancelConversion() noexcept;
+
+  /**
+   * @brief Check if a non-blocking conversion is in progress
+   * @return true between StartConversion() and the Poll() that completes it
+   */
+  [[nodiscard]] bool IsConversionActive() const noexcept;
+
+  /**
+   * @brief Get the time the next sample of the conversion is due
+   * @return Due time (StartConversion() time base; meaningful while
+   *         IsConversionActive())
+   */
+  [[nodiscard]] uint64_t NextSampleDueUs() const noexcept;
+
   //==============================================================//
   // RESISTANCE AND VOLTAGE
   //==============================================================//
@@ -242,6 +336,28 @@ public:
    */
   NtcError GetRawAdcValue(uint32_t *adc_value) noexcept;
 
+  /**
+   * @brief Convert temperature setpoints to raw ADC counts
+   *
+   * Runs each setpoint backwards through the configured conversion
+   * (calibration offset, temperature to resistance, voltage divider, ADC
+   * scale) so alarm thresholds can be compared against GetRawAdcValue()
+   * counts without converting every sample. With the thermistor on the low
+   * side of the divider, higher temperatures map to lower counts.
+   *
+   * @param temperatures_celsius Array of setpoints (°C)
+   * @param adc_counts Array to store ADC counts (count elements)
+   * @param count Number of setpoints
+   * @return Error code (counts before the first failing setpoint are valid)
+   *
+   * @note Filtering is not inverted; the counts are unfiltered thresholds.
+   * @note Returns NotInitialized while a deferred conversion setup is
+   *       pending; see PrepareConversion().
+   */
+  NtcError ConvertTemperaturesToAdcCounts(const float *temperatures_celsius,
+                                          uint32_t *adc_counts,
+                                          size_t count) const noexcept;
+
   //==============================================================//
   // CALIBRATION
   //==============================================================//
@@ -321,14 +437,257 @@ public:
   NtcError SetSamplingParameters(uint32_t sample_count,
                                  uint32_t sample_delay_ms) noexcept;
 
+  /**
+   * @brief Set the reduction applied to the samples of a read
+   * @param strategy Sampling strategy
+   * @return Error code (InvalidParameter if the strategy cannot hold
+   *         sample_count samples)
+   */
+  NtcError SetSamplingStrategy(NtcSamplingStrategy strategy) noexcept;
+
+  /**
+   * @brief Set the change reporting deadband
+   * @param deadband_counts Raw ADC count change needed to report a reading
+   *                        from ReadTemperatureIfChanged() and Poll()
+   *                        (0 = report every reading)
+   * @return Error code
+   */
+  NtcError SetReportDeadband(uint32_t deadband_counts) noexcept;
+
+  /**
+   * @brief Report the next reading regardless of the deadband
+   */
+  void ResetChangeReference() noexcept;
+
   /**
    * @brief Enable/disable filtering
    * @param enable Enable filtering
    * @param alpha Filter alpha value (0.0-1.0)
-   * @return Error code
+   * @return Error code (InvalidParameter if the selected filter mode cannot
+   *         be enabled, see SetFilterMode())
    */
   NtcError SetFiltering(bool enable, float alpha = 0.1F) noexcept;
 
+  /**
+   * @brief Select the filter applied when filtering is enabled
+   *
+   * The mode's parameters (filter_time_constant_s for ThermalLag,
+   * filter_process_noise and filter_measurement_noise for Kalman) come from
+   * the configuration. The filter restarts from the next reading.
+   *
+   * @param mode Filter mode
+   * @return Error code (InvalidParameter if the mode's parameters are
+   *         invalid, or if it is ThermalLag or Kalman on an ADC without
+   *         ReadTimestampUs() and filter_sample_period_s is 0)
+   *
+   * @see NtcFilterMode
+   */
+  NtcError SetFilterMode(NtcFilterMode mode) noexcept;
+
+  /**
+   * @brief Attach a lookup table to this instance
+   *
+   * Overrides the built-in table for the configured NtcType, which allows
+   * NtcType::Custom thermistors to use NtcConversionMethod::LookupTable.
+   * Tables generated with NTC::MakeNtcTable() live in read-only storage and
+   * can be attached directly.
+   *
+   * @param table Lookup table (must outlive this instance), or nullptr to
+   * revert to the built-in table for the configured type
+   * @return Error code
+   *
+   * @see NTC::MakeNtcTable()
+   */
+  NtcError SetLookupTable(const NTC::ntc_lookup_table_t *table) noexcept;
+
+  /**
+   * @brief Attach an already validated lookup table to this instance
+   * @param table Validated table handle (an empty handle reverts to the
+   * built-in table for the configured type)
+   * @return Error code
+   */
+  NtcError SetLookupTable(const NTC::ValidatedLookupTable &table) noexcept;
+
+  /**
+   * @brief Set Steinhart-Hart coefficients
+   *
+   * Used by NtcConversionMethod::SteinhartHart and offered to
+   * NtcConversionMethod::Auto. Passing all three as 0 fits the coefficients
+   * to the lookup table (or the Beta curve) over the configured range.
+   *
+   * @param coeff_a Steinhart-Hart coefficient A
+   * @param coeff_b Steinhart-Hart coefficient B
+   * @param coeff_c Steinhart-Hart coefficient C
+   * @return Error code
+   */
+  NtcError SetSteinhartHartCoefficients(float coeff_a, float coeff_b,
+                                        float coeff_c) noexcept;
+
+  /**
+   * @brief Get the conversion method readings are converted with
+   *
+   * Resolves NtcConversionMethod::Auto to the selected method, and explicit
+   * methods whose table or coefficients are unavailable to Mathematical.
+   *
+   * @return Active conversion method (Auto only while a deferred conversion
+   *         setup is pending, see PrepareConversion())
+   */
+  [[nodiscard]] NtcConversionMethod GetActiveConversionMethod() const noexcept;
+
+  /**
+   * @brief Get the active conversion method, its error and cost estimate
+   *
+   * Auto measures the error of its candidates while it selects one. For an
+   * explicit method the error is measured here instead (a sweep over the
+   * ADC range) so setters do not pay for it; call it outside hot paths.
+   *
+   * @param report Pointer to store the report
+   * @return Error code (NotInitialized before Initialize() and while a
+   *         deferred conversion setup is pending)
+   *
+   * @see ntc_conversion_report_t
+   */
+  NtcError GetConversionReport(ntc_conversion_report_t *report) const noexcept;
+
+  //==============================================================//
+  // STARTUP AND WARM START
+  //==============================================================//
+
+  /// Version of the SaveState() blob layout
+  static constexpr uint16_t STATE_VERSION_ = 1U;
+
+  /// Size of a SaveState() blob (bytes)
+  static constexpr size_t STATE_BLOB_SIZE_ = 581U;
+
+  /**
+   * @brief Run a deferred conversion setup now
+   *
+   * With defer_conversion_setup set, Initialize() and configuration changes
+   * only mark the ADC count table and the conversion method selection as
+   * pending; the first conversion builds them. Call this from an idle hook
+   * to pay that cost outside the first reading. Does nothing if the setup
+   * is not pending.
+   *
+   * @return Error code (NotInitialized before Initialize())
+   */
+  NtcError PrepareConversion() noexcept;
+
+  /**
+   * @brief Check if the conversion setup is built
+   * @return true once readings convert without building tables first
+   */
+  [[nodiscard]] bool IsConversionPrepared() const noexcept;
+
+  /**
+   * @brief Save the derived conversion state, calibration and filter state
+   *
+   * Writes a STATE_BLOB_SIZE_ byte blob for NVS or flash holding the
+   * conversion context, the ADC count table, the selected conversion method
+   * and its report, the calibration offset and the filter state, tagged with
+   * STATE_VERSION_, a fingerprint of the configuration and a checksum.
+   * Multi-byte fields are written little-endian and floats as IEEE-754
+   * binary32, whatever the byte order of the target. Runs a pending
+   * conversion setup first.
+   *
+   * @param buffer Buffer to store the blob
+   * @param capacity Buffer size (bytes)
+   * @return Error code (OutOfMemory if capacity < STATE_BLOB_SIZE_)
+   *
+   * @see RestoreState()
+   */
+  NtcError SaveState(uint8_t *buffer, size_t capacity) noexcept;
+
+  /**
+   * @brief Restore a blob written by SaveState()
+   *
+   * Warm start: applies the saved conversion setup instead of building it and
+   * resumes the filter from its saved estimate. Call after Initialize(),
+   * typically with defer_conversion_setup set so Initialize() builds
+   * nothing. The calibration offset is restored too, so a field calibration
+   * survives a reboot; every other setting must match the configuration the
+   * blob was saved with. The filter's time step to the first reading after
+   * the restore is measured from time 0 of the ADC clock. The blob is
+   * applied completely or not at all.
+   *
+   * @param data Blob
+   * @param size Blob size (bytes)
+   * @return Error code (NotInitialized before Initialize(); InvalidParameter
+   *         if the blob is truncated, corrupt or was saved with another
+   *         configuration; UnsupportedOperation for another STATE_VERSION_)
+   */
+  NtcError RestoreState(const uint8_t *data, size_t size) noexcept;
+
+  //==============================================================//
+  // HISTORY
+  //==============================================================//
+
+  /**
+   * @brief Attach a history that receives every successful reading
+   *
+   * Readings are pushed after calibration and filtering, with the reading
+   * timestamp (0 if the ADC type has no ReadTimestampUs() hook and the read
+   * is synchronous). The history is
+   * owned by the caller; statistics are read from it directly.
+   *
+   * @tparam Capacity History window size
+   * @param history History (must outlive the attachment)
+   * @return Error code
+   *
+   * @see NtcHistory
+   */
+  template <size_t Capacity>
+  NtcError AttachHistory(NtcHistory<Capacity> *history) noexcept;
+
+  /**
+   * @brief Stop pushing readings to the attached history
+   */
+  void DetachHistory() noexcept;
+
+  //==============================================================//
+  // SNAPSHOT
+  //==============================================================//
+
+  /**
+   * @brief Attach a snapshot that receives every completed reading
+   *
+   * Publish/subscribe mode: one sampling task calls ReadTemperature() or
+   * StartConversion()/Poll(), and every reading they complete (including
+   * failed ones, with their error) is published. Consumers on other tasks
+   * or cores call NtcReadingSnapshot::Read() instead of reading the sensor,
+   * so they neither trigger ADC conversions nor touch the filter state.
+   *
+   * @param snapshot Snapshot (must outlive the attachment)
+   * @return Error code
+   *
+   * @see NtcSnapshot
+   */
+  NtcError AttachSnapshot(NtcReadingSnapshot *snapshot) noexcept;
+
+  /**
+   * @brief Stop publishing readings to the attached snapshot
+   */
+  void DetachSnapshot() noexcept;
+
+  //==============================================================//
+  // STATISTICS
+  //==============================================================//
+
+  /// Statistics block compiled in (NTC_ENABLE_STATS)
+  static constexpr bool STATS_ENABLED_ = NTC_ENABLE_STATS != 0;
+
+  /**
+   * @brief Get the hot-path counters and stage cycle timing
+   * @param stats Pointer to store the statistics
+   * @return Error code (UnsupportedOperation when NTC_ENABLE_STATS is 0)
+   */
+  NtcError GetStats(ntc_stats_t *stats) const noexcept;
+
+  /**
+   * @brief Clear the statistics
+   * @return Error code (UnsupportedOperation when NTC_ENABLE_STATS is 0)
+   */
+  NtcError ResetStats() noexcept;
+
   //==============================================================//
   // UTILITY FUNCTIONS
   //==============================================================//
@@ -387,25 +746,172 @@ private:
   // Filtering
   float filtered_temperature_; ///< Filtered temperature
   bool filter_initialized_;    ///< Filter initialization status
+  float filter_lead_;          ///< ThermalLag: lag compensation (°C)
+  float filter_variance_;      ///< Kalman: estimate variance (°C²)
+  uint64_t filter_timestamp_us_; ///< Timestamp of the last filtered reading
+
+  // Lookup tables, validated once when attached or resolved
+  NTC::ValidatedLookupTable attached_lookup_table_; ///< User-attached table
+  NTC::ValidatedLookupTable lookup_table_; ///< Table used for conversion
+
+  // Constants derived from the configuration
+  ntc_conversion_context_t context_; ///< Cached conversion constants
+
+  // Conversion method selection (resolves Auto)
+  NtcConversionMethod active_method_;         ///< Method used for conversion
+  ntc_conversion_report_t conversion_report_; ///< Error and cost of method
+  bool conversion_error_measured_; ///< Report error swept (Auto, restore)
+  bool conversion_pending_; ///< Deferred setup not built yet
+
+  // Warm-start blob (SaveState() / RestoreState())
+  static constexpr uint32_t STATE_MAGIC_ =
+      0x5743544EU; ///< "NTCW" as written little-endian
+  static constexpr size_t STATE_CHECKSUM_BYTES_ =
+      sizeof(uint32_t); ///< Trailing FNV-1a checksum
+  static constexpr uint32_t HASH_OFFSET_BASIS_ =
+      2166136261U; ///< FNV-1a 32-bit offset basis
+  static constexpr uint32_t HASH_PRIME_ = 16777619U; ///< FNV-1a 32-bit prime
+
+  // Acquisition
+  uint32_t last_adc_conversions_; ///< ADC conversions of the last acquisition
+
+  // ADC count -> temperature table (NtcConversionMethod::AdcCountTable)
+  NTC::Acquisition::CountTable
+      adc_count_table_;             ///< Temperatures at table nodes (0.01°C)
+  uint32_t adc_count_table_shift_;  ///< log2(ADC counts per table segment)
+  bool adc_count_table_valid_;      ///< Table matches current configuration
+
+  // Asynchronous conversion (StartConversion() / Poll())
+  bool async_active_;              ///< Conversion in progress
+  uint32_t async_samples_taken_;   ///< Samples taken so far
+  uint64_t async_count_sum_;       ///< Sum of valid sample counts
+  std::array<uint32_t, NTC::Acquisition::MAX_ORDERED_SAMPLES_>
+      async_counts_; ///< Valid sample counts (Median and TrimmedMean)
+  uint64_t async_next_sample_us_;  ///< Time the next sample is due
+  uint64_t async_first_sample_us_; ///< Time the first sample was taken
+  ntc::AdcError async_last_error_; ///< Last ADC error of the conversion
+  ntc_adc_sample_t async_sample_;  ///< Conversion and valid sample counts
+  uint32_t async_acquisition_cycles_; ///< Sampling cycles of the Poll() calls
+
+  // History (AttachHistory()), type-erased over the window size
+  void *history_; ///< Attached history (nullptr: none)
+  void (*history_push_)(void *, float,
+                        uint64_t) noexcept; ///< Pushes a reading to history_
+
+  // Snapshot (AttachSnapshot())
+  NtcReadingSnapshot *snapshot_; ///< Attached snapshot (nullptr: none)
+
+  // Change-driven reporting (report_deadband_counts)
+  uint32_t reported_count_; ///< Raw count of the last reported reading
+  bool reported_valid_;     ///< reported_count_ is a valid reference
+
+#if NTC_ENABLE_STATS
+  // Statistics
+  ntc_stats_t stats_; ///< Hot-path counters and stage timing
+#endif
 
   //==============================================================//
   // PRIVATE HELPER METHODS
   //==============================================================//
 
   /**
-   * @brief Validate configuration
-   * @param config Configuration to validate
+   * @brief Acquire one sample burst from the ADC
+   *
+   * Reads sample_count raw counts from the configured channel, reduces them
+   * with the sampling strategy and derives the thermistor voltage from the
+   * reduced count. Uses the ADC's
+   * ReadChannelBurst() hook when it has one and sample_delay_ms is 0. This is
+   * the only place the driver talks to the ADC during a read.
+   *
+   * @param sample Pointer to store the acquisition result
    * @return Error code
    */
-  [[nodiscard]] NtcError
-  validateConfiguration(const ntc_config_t &config) const noexcept;
+  NtcError acquireSample(ntc_adc_sample_t *sample) noexcept;
 
   /**
-   * @brief Read ADC voltage
-   * @param voltage_volts Pointer to store voltage
+   * @brief Finish an acquisition from its accumulated counts
+   *
+   * Reduces the valid counts with the sampling strategy and derives the
+   * reduced count and voltage, or the acquisition error when no sample was
+   * valid. sample->conversions and sample->valid_samples must already be set.
+   *
+   * @param count_sum Sum of the valid sample counts
+   * @param counts Valid sample counts (used by Median and TrimmedMean,
+   *               reordered)
+   * @param last_error Last ADC error seen during the acquisition
+   * @param sample Acquisition to finish
+   * @return Error code
+   */
+  NtcError finishSample(uint64_t count_sum, uint32_t *counts,
+                        ntc::AdcError last_error,
+                        ntc_adc_sample_t *sample) noexcept;
+
+  /**
+   * @brief Reduce the valid counts of an acquisition to one count
+   *
+   * The reduced count is the returned numerator over *divisor, so no
+   * resolution is lost before the conversion to volts.
+   *
+   * @param count_sum Sum of the valid sample counts
+   * @param counts Valid sample counts (used by Median and TrimmedMean,
+   *               reordered)
+   * @param valid_samples Number of valid counts (at least 1)
+   * @param divisor Pointer to store the divisor of the reduced count
+   * @return Numerator of the reduced count
+   */
+  uint64_t reduceCounts(uint64_t count_sum, uint32_t *counts,
+                        uint32_t valid_samples,
+                        uint32_t *divisor) const noexcept;
+
+  /**
+   * @brief Check if the sampling strategy needs the individual counts
+   * @return true for Median and TrimmedMean
+   */
+  [[nodiscard]] bool keepsSampleCounts() const noexcept;
+
+  /**
+   * @brief Check an acquisition against the report deadband
+   *
+   * Counts the skipped reading in the statistics when it is unchanged.
+   *
+   * @param sample Successful acquisition
+   * @return true if the reading does not need to be reported
+   */
+  bool isUnchangedReading(const ntc_adc_sample_t &sample) noexcept;
+
+  /**
+   * @brief Convert an acquisition and fill in a reading
+   * @param sample Acquisition result
+   * @param acquire_error Result of the acquisition
+   * @param reading Reading to fill (error and is_valid are always set)
+   * @return Error code
+   */
+  NtcError completeReading(const ntc_adc_sample_t &sample,
+                           NtcError acquire_error,
+                           ntc_reading_t *reading) noexcept;
+
+  /**
+   * @brief Convert an acquired sample to a calibrated temperature
+   *
+   * Runs resistance calculation, temperature conversion, calibration offset,
+   * filtering and range validation on the given acquisition.
+   *
+   * @param sample Acquisition result
+   * @param resistance_ohms Pointer to store resistance (may be nullptr when
+   * the caller does not need it)
+   * @param temperature_celsius Pointer to store temperature (°C)
    * @return Error code
    */
-  NtcError readAdcVoltage(float *voltage_volts) noexcept;
+  NtcError convertSample(const ntc_adc_sample_t &sample,
+                         float *resistance_ohms,
+                         float *temperature_celsius) noexcept;
+
+  /**
+   * @brief Convert ADC count to voltage using the configured scale
+   * @param raw_count Raw ADC count
+   * @return Voltage (V)
+   */
+  [[nodiscard]] float countToVoltage(float raw_count) const noexcept;
 
   /**
    * @brief Calculate resistance from voltage
@@ -425,12 +931,244 @@ private:
   NtcError convertResistanceToTemperature(float resistance_ohms,
                                           float *temperature_celsius) noexcept;
 
+  /**
+   * @brief Convert temperature to resistance (inverse of the conversion)
+   * @param temperature_celsius Uncalibrated temperature
+   * @param resistance_ohms Pointer to store resistance
+   * @return Error code
+   */
+  NtcError
+  convertTemperatureToResistance(float temperature_celsius,
+                                 float *resistance_ohms) const noexcept;
+
+  /**
+   * @brief Rebuild the ADC count table if the ADC count method may be used
+   *
+   * Must be called whenever a parameter the table depends on changes
+   * (conversion method, reference voltage, series resistance, resistance at
+   * 25°C, beta value, ADC resolution).
+   */
+  void updateAdcCountTable() noexcept;
+
+  /**
+   * @brief Convert ADC count to temperature using the ADC count table
+   * @param count_q Averaged ADC count
+   *        (NTC::Acquisition::COUNT_FRACTION_BITS_ fraction)
+   * @param temperature_celsius Pointer to store temperature (°C)
+   * @return true if the count is covered by the table, false otherwise
+   */
+  bool lookupAdcCountTable(uint64_t count_q,
+                           float *temperature_celsius) const noexcept;
+
+  /**
+   * @brief Recompute the cached conversion constants
+   *
+   * Must be called whenever a parameter the context depends on changes
+   * (reference voltage, ADC resolution, resistance at 25°C, beta value,
+   * Steinhart-Hart coefficients, temperature range, lookup table).
+   */
+  void updateConversionContext() noexcept;
+
+  /**
+   * @brief Convert resistance to temperature with the cached beta constants
+   * @param resistance_ohms Resistance (ohms)
+   * @param temperature_celsius Pointer to store temperature (°C)
+   * @return true if successful, false otherwise
+   */
+  bool convertResistanceBeta(float resistance_ohms,
+                             float *temperature_celsius) const noexcept;
+
+  /**
+   * @brief Convert resistance to temperature with a given method
+   *
+   * LookupTable falls back to the Beta equation outside the table.
+   * AdcCountTable is count based and also uses the Beta equation here.
+   *
+   * @param method Conversion method (not Auto)
+   * @param resistance_ohms Resistance (ohms)
+   * @param temperature_celsius Pointer to store temperature (°C)
+   * @param table_hit Pointer to store whether the lookup table served the
+   *        conversion (may be nullptr)
+   * @return true if successful, false otherwise
+   */
+  bool convertResistanceWith(NtcConversionMethod method, float resistance_ohms,
+                             float *temperature_celsius,
+                             bool *table_hit = nullptr) const noexcept;
+
+  /**
+   * @brief Select the active conversion method and measure it
+   *
+   * Rebuilds the ADC count table, then evaluates each available method
+   * against the reference model over min_temperature to max_temperature.
+   * Auto picks the cheapest method within auto_max_cost whose error is at
+   * most auto_max_error_celsius; explicit methods are measured as they are.
+   * Must be called whenever updateAdcCountTable() would be. With
+   * defer_conversion_setup set, only marks the setup as pending.
+   */
+  void updateConversionMethod() noexcept;
+
+  /**
+   * @brief Build the ADC count table and select the conversion method now
+   */
+  void buildConversionMethod() noexcept;
+
+  /**
+   * @brief Build a pending deferred conversion setup
+   */
+  void ensureConversionMethod() noexcept;
+
+  /**
+   * @brief Fingerprint the settings a SaveState() blob depends on
+   *
+   * Covers everything updateConversionContext(), updateConversionMethod()
+   * and the filter read, except the calibration offset the blob carries,
+   * plus every lookup table entry. Values are hashed in their little-endian
+   * blob encoding, so the hash matches across byte orders.
+   *
+   * @return FNV-1a hash
+   */
+  [[nodiscard]] uint32_t stateFingerprint() const noexcept;
+
+  /**
+   * @brief Continue an FNV-1a hash over a block of bytes
+   * @param hash Hash so far
+   * @param data Bytes to hash
+   * @param size Number of bytes
+   * @return Updated hash
+   */
+  [[nodiscard]] static uint32_t hashBytes(uint32_t hash, const void *data,
+                                          size_t size) noexcept;
+
+  /**
+   * @brief Append a value to a state blob, little-endian
+   * @param out Write position (nullptr after an earlier overflow)
+   * @param end End of the blob
+   * @param value Integer or float value
+   * @return Position after the value, nullptr if it does not fit
+   */
+  template <typename T>
+  static uint8_t *putState(uint8_t *out, const uint8_t *end,
+                           T value) noexcept;
+
+  /**
+   * @brief Read a little-endian value from a state blob
+   * @param in Read position (nullptr after an earlier overrun)
+   * @param end End of the blob
+   * @param value Pointer to store the integer or float value
+   * @return Position after the value, nullptr if the blob is too short
+   */
+  template <typename T>
+  static const uint8_t *getState(const uint8_t *in, const uint8_t *end,
+                                 T *value) noexcept;
+
+  /**
+   * @brief Measure the worst-case error of a method against the reference
+   * @param method Conversion method (not Auto)
+   * @return Worst-case error (°C), 0 if no point could be evaluated
+   */
+  [[nodiscard]] float
+  measureConversionError(NtcConversionMethod method) const noexcept;
+
+  /**
+   * @brief Get the worst-case error of the active method
+   * @return Error from the Auto selection or restored state, otherwise
+   *         measured now (°C)
+   */
+  [[nodiscard]] float activeConversionError() const noexcept;
+
+  /**
+   * @brief Static cost estimate of a method for the current configuration
+   * @param method Conversion method (not Auto)
+   * @return Cost (see NTC::ConversionCost)
+   */
+  [[nodiscard]] uint32_t
+  conversionCost(NtcConversionMethod method) const noexcept;
+
+  /// Read stages timed by the statistics block
+  enum class StatsStage : uint8_t { Acquisition, Conversion };
+
+  /// How a resistance was converted, for the statistics block
+  enum class StatsPath : uint8_t {
+    TableHit,
+    TableFallback,
+    Equation,
+    Failure,
+    OutOfRange
+  };
+
+  /**
+   * @brief Push a successful reading to the attached history
+   * @param temperature_celsius Temperature (°C)
+   * @param timestamp_us Reading time (µs); 0 if unknown
+   */
+  void recordHistory(float temperature_celsius,
+                     uint64_t timestamp_us) noexcept;
+
+  /**
+   * @brief Read the ADC type's cycle counter
+   * @return Cycle count, 0 without NTC_ENABLE_STATS or ReadCycleCounter()
+   */
+  [[nodiscard]] uint32_t statsCycles() const noexcept;
+
+  /**
+   * @brief Record the cycles of one stage execution
+   * @param stage Timed stage
+   * @param start_cycles statsCycles() at the start of the stage
+   */
+  void statsRecordStage(StatsStage stage, uint32_t start_cycles) noexcept;
+
+  /**
+   * @brief Record one stage execution of known length
+   * @param stage Timed stage
+   * @param cycles Cycles spent in the stage
+   */
+  void statsRecordCycles(StatsStage stage, uint32_t cycles) noexcept;
+
+  /**
+   * @brief Record the ADC conversions of one acquisition
+   * @param sample Acquisition result
+   */
+  void statsRecordSample(const ntc_adc_sample_t &sample) noexcept;
+
+  /**
+   * @brief Record how one conversion was served
+   * @param path Conversion path
+   */
+  void statsRecordPath(StatsPath path) noexcept;
+
+  /**
+   * @brief Resolve the lookup table used for conversion
+   *
+   * Uses the attached table if present, otherwise the built-in table for
+   * config_.type. Called when the type or the attached table changes so the
+   * read path never re-validates or re-resolves the table.
+   */
+  void updateLookupTable() noexcept;
+
   /**
    * @brief Apply filtering
    * @param new_temperature New temperature reading
+   * @param timestamp_us Reading timestamp (µs); 0 if unknown
    * @return Filtered temperature
    */
-  float applyFiltering(float new_temperature) noexcept;
+  float applyFiltering(float new_temperature, uint64_t timestamp_us) noexcept;
+
+  /**
+   * @brief Get the time since the last filtered reading
+   * @param timestamp_us Reading timestamp (µs); 0 if unknown
+   * @return Time step (s): filter_sample_period_s without timestamps, 0 if
+   *         the clock did not advance
+   */
+  [[nodiscard]] float filterTimeStep(uint64_t timestamp_us) const noexcept;
+
+  /**
+   * @brief Check that a filter mode gets the time step it needs
+   * @param config Configuration holding the filter mode
+   * @return true for Ema, and for ThermalLag and Kalman if AdcType has a
+   *         ReadTimestampUs() clock or filter_sample_period_s is set
+   */
+  [[nodiscard]] static bool
+  hasFilterTimeBase(const ntc_config_t &config) noexcept;
 
   /**
    * @brief Initialize configuration for NTC type
@@ -0,0 +1,307 @@
+/**
+ * @file ntc_thermistor_array.hpp
+ * @brief Multi-channel NTC thermistor driver scanning N sensors per pass.
+ *
+ * This header provides a driver for boards with several thermistors on one
+ * ADC. All channels are acquired with one multi-channel scan per sample and
+ * converted in a single loop over contiguous per-channel state.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_THERMISTOR_ARRAY_H
+#define NTC_THERMISTOR_ARRAY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ntc_acquisition.hpp"
+#include "ntc_adc_interface.hpp"
+#include "ntc_thermistor.hpp"
+#include "ntc_types.hpp"
+
+//--------------------------------------
+//  NtcThermistorArray Class
+//--------------------------------------
+
+/**
+ * @class NtcThermistorArray
+ * @brief Hardware-agnostic driver for N thermistors sharing one ADC
+ *
+ * Per-channel state (ADC channel, beta parameters, calibration offsets,
+ * filter state) is stored as structure-of-arrays, so a scan converts all
+ * channels in one tight loop. Each sample is acquired with
+ * AdcType::ReadChannelsCount(); ADCs with a hardware sequencer can
+ * implement it to read every channel in a single scan.
+ *
+ * Conversion always uses the beta equation on ratiometric ADC counts
+ * (honouring enable_fast_log); conversion_method, and the per-channel fields
+ * of the shared ntc_config_t, are ignored. Scans are averaged, so
+ * sampling_strategy must be Mean, and filtering is a moving average, so
+ * filter_mode must be Ema.
+ *
+ * @tparam AdcType The ADC implementation type that inherits from
+ * ntc::AdcInterface<AdcType>
+ * @tparam ChannelCount Number of thermistor channels (1-32)
+ *
+ * @example
+ * @code
+ * ntc_config_t config = GetDefaultNtcConfig();
+ * config.sample_count = 4;
+ * std::array<ntc_channel_config_t, 2> channels = {{
+ *     {.adc_channel = 0, .resistance_at_25c = 10000.0F,
+ *      .beta_value = 3435.0F, .series_resistance = 10000.0F,
+ *      .calibration_offset = 0.0F},
+ *     {.adc_channel = 1, .resistance_at_25c = 10000.0F,
+ *      .beta_value = 3950.0F, .series_resistance = 10000.0F,
+ *      .calibration_offset = 0.0F}}};
+ *
+ * NtcThermistorArray<MyAdc, 2> sensors(config, channels, &my_adc);
+ * sensors.Initialize();
+ * float temperatures[2];
+ * uint32_t valid_mask = 0;
+ * sensors.ReadTemperaturesCelsius(temperatures, &valid_mask);
+ * @endcode
+ */
+template <typename AdcType, size_t ChannelCount> class NtcThermistorArray {
+  static_assert(ChannelCount > 0U && ChannelCount <= 32U,
+                "NtcThermistorArray supports 1-32 channels");
+
+public:
+  //==============================================================//
+  // CONSTRUCTORS AND DESTRUCTOR
+  //==============================================================//
+
+  /**
+   * @brief Constructor with shared and per-channel configuration
+   * @param config Configuration shared by all channels
+   * @param channels Per-channel parameters
+   * @param adc_interface Pointer to ADC interface implementation
+   */
+  NtcThermistorArray(
+      const ntc_config_t &config,
+      const std::array<ntc_channel_config_t, ChannelCount> &channels,
+      AdcType *adc_interface) noexcept;
+
+  /**
+   * @brief Copy constructor is deleted
+   */
+  NtcThermistorArray(const NtcThermistorArray &) = delete;
+
+  /**
+   * @brief Assignment operator is deleted
+   */
+  NtcThermistorArray &operator=(const NtcThermistorArray &) = delete;
+
+  /**
+   * @brief Move constructor
+   */
+  NtcThermistorArray(NtcThermistorArray &&) noexcept = default;
+
+  /**
+   * @brief Move assignment operator
+   */
+  NtcThermistorArray &operator=(NtcThermistorArray &&) noexcept = default;
+
+  /**
+   * @brief Destructor
+   */
+  ~NtcThermistorArray() noexcept = default;
+
+  //==============================================================//
+  // INITIALIZATION
+  //==============================================================//
+
+  /**
+   * @brief Initialize the array driver
+   * @return true if successful, false otherwise
+   */
+  bool Initialize() noexcept;
+
+  /**
+   * @brief Deinitialize the array driver
+   * @return true if successful, false otherwise
+   */
+  bool Deinitialize() noexcept;
+
+  /**
+   * @brief Check if initialized
+   * @return true if initialized, false otherwise
+   */
+  [[nodiscard]] bool IsInitialized() const noexcept;
+
+  /**
+   * @brief Get the number of channels
+   * @return Channel count
+   */
+  [[nodiscard]] static constexpr size_t GetChannelCount() noexcept {
+    return ChannelCount;
+  }
+
+  //==============================================================//
+  // TEMPERATURE READING
+  //==============================================================//
+
+  /**
+   * @brief Read the temperature of every channel
+   *
+   * Performs sample_count multi-channel scans and converts all channels.
+   * Channels that fail conversion or range validation keep their slot in
+   * temperatures_celsius but are cleared in valid_mask.
+   *
+   * @param temperatures_celsius Array of ChannelCount elements to store
+   *        temperatures (°C)
+   * @param valid_mask Pointer to store a bit mask of valid channels (bit i
+   *        set when channel i is valid, may be nullptr)
+   * @return Success if every channel is valid, otherwise the error of the
+   *         acquisition or the first class of channel failure
+   */
+  NtcError ReadTemperaturesCelsius(float *temperatures_celsius,
+                                   uint32_t *valid_mask = nullptr) noexcept;
+
+  /**
+   * @brief Read the averaged raw ADC count of every channel
+   * @param adc_values Array of ChannelCount elements to store counts
+   * @return Error code
+   */
+  NtcError GetRawAdcValues(uint32_t *adc_values) noexcept;
+
+  /**
+   * @brief Get the number of ADC conversions used by the last acquisition
+   * @return ADC conversions performed by the most recent read call
+   */
+  [[nodiscard]] uint32_t GetLastAdcConversionCount() const noexcept;
+
+  /**
+   * @brief Get the acquisition time of the last read
+   *
+   * All channels of a read share this timestamp: the midpoint between the
+   * first and the last scan, from the ADC type's ReadTimestampUs() hook.
+   *
+   * @return Timestamp (µs), 0 without the hook
+   */
+  [[nodiscard]] uint64_t GetLastScanTimestampUs() const noexcept;
+
+  //==============================================================//
+  // CHANNEL CONFIGURATION
+  //==============================================================//
+
+  /**
+   * @brief Set the parameters of one channel
+   * @param channel_index Channel index (0 to ChannelCount - 1)
+   * @param channel Channel parameters
+   * @return Error code
+   */
+  NtcError SetChannelConfiguration(size_t channel_index,
+                                   const ntc_channel_config_t &channel) noexcept;
+
+  /**
+   * @brief Get the parameters of one channel
+   * @param channel_index Channel index (0 to ChannelCount - 1)
+   * @param channel Pointer to store channel parameters
+   * @return Error code
+   */
+  NtcError GetChannelConfiguration(size_t channel_index,
+                                   ntc_channel_config_t *channel) const noexcept;
+
+  /**
+   * @brief Set the calibration offset of one channel
+   * @param channel_index Channel index (0 to ChannelCount - 1)
+   * @param offset_celsius Calibration offset (°C)
+   * @return Error code
+   */
+  NtcError SetCalibrationOffset(size_t channel_index,
+                                float offset_celsius) noexcept;
+
+  /**
+   * @brief Get the calibration offset of one channel
+   * @param channel_index Channel index (0 to ChannelCount - 1)
+   * @param offset_celsius Pointer to store calibration offset
+   * @return Error code
+   */
+  NtcError GetCalibrationOffset(size_t channel_index,
+                                float *offset_celsius) const noexcept;
+
+private:
+  //==============================================================//
+  // PRIVATE MEMBER VARIABLES
+  //==============================================================//
+
+  ntc_config_t config_;    ///< Configuration shared by all channels
+  AdcType *adc_interface_; ///< ADC interface pointer
+  bool initialized_;       ///< Initialization status
+
+  // Per-channel parameters
+  std::array<uint8_t, ChannelCount> adc_channels_; ///< ADC channel numbers
+  std::array<float, ChannelCount> resistance_at_25c_; ///< R25 (ohms)
+  std::array<float, ChannelCount> beta_values_;       ///< Beta values (K)
+  std::array<float, ChannelCount> series_resistances_; ///< Series R (ohms)
+  std::array<float, ChannelCount> calibration_offsets_; ///< Offsets (°C)
+
+  // Conversion terms derived from the per-channel parameters
+  std::array<float, ChannelCount> inverse_beta_values_; ///< 1 / beta
+  std::array<float, ChannelCount>
+      log_series_ratios_; ///< ln(series resistance / R25)
+
+  // Filtering
+  std::array<float, ChannelCount> filtered_temperatures_; ///< Filter states
+  uint32_t filter_initialized_mask_; ///< Channels with a primed filter
+
+  // Acquisition
+  std::array<uint32_t, ChannelCount> scan_counts_; ///< Counts of one scan
+  std::array<uint64_t, ChannelCount> count_sums_;  ///< Accumulated counts
+  std::array<float, ChannelCount> mean_counts_;    ///< Averaged counts
+  uint32_t last_adc_conversions_; ///< ADC conversions of the last acquisition
+  uint64_t last_scan_timestamp_us_; ///< Midpoint of the last acquisition (µs)
+
+  //==============================================================//
+  // PRIVATE HELPER METHODS
+  //==============================================================//
+
+  /**
+   * @brief Validate channel parameters
+   * @param channel Channel parameters
+   * @return Error code
+   */
+  [[nodiscard]] static NtcError
+  validateChannel(const ntc_channel_config_t &channel) noexcept;
+
+  /**
+   * @brief Store channel parameters and update its derived terms
+   * @param channel_index Channel index
+   * @param channel Channel parameters
+   */
+  void storeChannel(size_t channel_index,
+                    const ntc_channel_config_t &channel) noexcept;
+
+  /**
+   * @brief Acquire sample_count scans and average the counts per channel
+   *
+   * Fills mean_counts_. This is the only place the driver talks to the ADC
+   * during a read.
+   *
+   * @return Error code
+   */
+  NtcError acquireScans() noexcept;
+
+  /**
+   * @brief Convert mean_counts_ of all channels to temperatures
+   * @param temperatures_celsius Array to store temperatures (°C)
+   * @param log_fn Natural logarithm implementation
+   * @return Bit mask of channels whose counts are convertible
+   */
+  template <typename LogFn>
+  uint32_t convertScans(float *temperatures_celsius,
+                        LogFn log_fn) const noexcept;
+};
+
+// Include template implementation
+#define NTC_THERMISTOR_ARRAY_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Template implementation file
+#include "../src/ntc_thermistor_array.cpp"
+#undef NTC_THERMISTOR_ARRAY_HEADER_INCLUDED
+
+#endif // NTC_THERMISTOR_ARRAY_H
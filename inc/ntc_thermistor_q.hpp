@@ -0,0 +1,292 @@
+/**
+ * @file ntc_thermistor_q.hpp
+ * @brief Fixed-point NTC thermistor driver for targets without an FPU.
+ *
+ * This header provides a driver whose read path is integer-only: raw ADC
+ * counts are averaged in Q format and converted to centi-degrees Celsius
+ * through an integer ADC count table, so reads do not pull in soft-float
+ * emulation.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_THERMISTOR_Q_H
+#define NTC_THERMISTOR_Q_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ntc_acquisition.hpp"
+#include "ntc_adc_interface.hpp"
+#include "ntc_lookup_table.hpp"
+#include "ntc_thermistor.hpp"
+#include "ntc_types.hpp"
+
+//--------------------------------------
+//  NtcThermistorQ Class
+//--------------------------------------
+
+/**
+ * @class NtcThermistorQ
+ * @brief Hardware-agnostic NTC thermistor driver with an integer read path
+ *
+ * Initialize() and SetConfiguration() convert the configuration into integer
+ * form once: an ADC count -> centi-degree table (built from the type's
+ * lookup table for NtcConversionMethod::LookupTable, from the configured
+ * coefficients for NtcConversionMethod::SteinhartHart, otherwise from the
+ * beta equation), the calibration offset and temperature limits in
+ * centi-degrees and the filter alpha in Q15. Every read after that uses
+ * integer arithmetic only:
+ *
+ * - sample counts are summed and averaged with COUNT_FRACTION_BITS_
+ *   fractional bits (sampling_strategy must be Mean);
+ * - the averaged count is linearly interpolated between table nodes;
+ * - filtering is an integer exponential moving average (filter_mode must be
+ *   Ema).
+ *
+ * MeasureConversionError() reports the worst-case difference to the float
+ * conversion path for the active configuration.
+ *
+ * @tparam AdcType The ADC implementation type that inherits from
+ * ntc::AdcInterface<AdcType>
+ *
+ * @example
+ * @code
+ * NtcThermistorQ<MyAdc> thermistor(config, &my_adc);
+ * thermistor.Initialize();
+ * int32_t centi_celsius = 0;
+ * thermistor.ReadTemperatureCentiCelsius(&centi_celsius); // 2512 = 25.12°C
+ * @endcode
+ */
+template <typename AdcType> class NtcThermistorQ {
+public:
+  //==============================================================//
+  // CONSTRUCTORS AND DESTRUCTOR
+  //==============================================================//
+
+  /**
+   * @brief Constructor with configuration
+   * @param config NTC configuration
+   * @param adc_interface Pointer to ADC interface implementation
+   */
+  NtcThermistorQ(const ntc_config_t &config, AdcType *adc_interface) noexcept;
+
+  /**
+   * @brief Copy constructor is deleted
+   */
+  NtcThermistorQ(const NtcThermistorQ &) = delete;
+
+  /**
+   * @brief Assignment operator is deleted
+   */
+  NtcThermistorQ &operator=(const NtcThermistorQ &) = delete;
+
+  /**
+   * @brief Move constructor
+   */
+  NtcThermistorQ(NtcThermistorQ &&) noexcept = default;
+
+  /**
+   * @brief Move assignment operator
+   */
+  NtcThermistorQ &operator=(NtcThermistorQ &&) noexcept = default;
+
+  /**
+   * @brief Destructor
+   */
+  ~NtcThermistorQ() noexcept = default;
+
+  //==============================================================//
+  // INITIALIZATION
+  //==============================================================//
+
+  /**
+   * @brief Initialize the driver and build the integer conversion table
+   * @return true if successful, false otherwise
+   */
+  bool Initialize() noexcept;
+
+  /**
+   * @brief Deinitialize the driver
+   * @return true if successful, false otherwise
+   */
+  bool Deinitialize() noexcept;
+
+  /**
+   * @brief Check if initialized
+   * @return true if initialized, false otherwise
+   */
+  [[nodiscard]] bool IsInitialized() const noexcept;
+
+  //==============================================================//
+  // TEMPERATURE READING
+  //==============================================================//
+
+  /**
+   * @brief Read temperature in centi-degrees Celsius
+   * @param temperature_centi_celsius Pointer to store temperature (0.01°C)
+   * @return Error code
+   */
+  NtcError ReadTemperatureCentiCelsius(
+      int32_t *temperature_centi_celsius) noexcept;
+
+  /**
+   * @brief Get raw ADC value
+   * @param adc_value Pointer to store the averaged raw ADC count
+   * @return Error code
+   */
+  NtcError GetRawAdcValue(uint32_t *adc_value) noexcept;
+
+  /**
+   * @brief Convert an averaged ADC count to centi-degrees Celsius
+   *
+   * Applies calibration and range validation but not filtering.
+   *
+   * @param count_q Averaged ADC count with COUNT_FRACTION_BITS_ fractional
+   *        bits
+   * @param temperature_centi_celsius Pointer to store temperature (0.01°C)
+   * @return Error code
+   */
+  NtcError
+  ConvertCountToCentiCelsius(uint64_t count_q,
+                             int32_t *temperature_centi_celsius) const noexcept;
+
+  /**
+   * @brief Get the number of ADC conversions used by the last acquisition
+   * @return ADC conversions performed by the most recent read call
+   */
+  [[nodiscard]] uint32_t GetLastAdcConversionCount() const noexcept;
+
+  //==============================================================//
+  // CONFIGURATION
+  //==============================================================//
+
+  /**
+   * @brief Get current configuration
+   * @param config Pointer to store configuration
+   * @return Error code
+   */
+  NtcError GetConfiguration(ntc_config_t *config) const noexcept;
+
+  /**
+   * @brief Set configuration and rebuild the integer conversion table
+   * @param config New configuration
+   * @return Error code
+   */
+  NtcError SetConfiguration(const ntc_config_t &config) noexcept;
+
+  /**
+   * @brief Reset the filter state
+   * @return Error code
+   */
+  NtcError ResetFilter() noexcept;
+
+  //==============================================================//
+  // ACCURACY
+  //==============================================================//
+
+  /**
+   * @brief Measure the worst-case error against the float conversion path
+   *
+   * Evaluates ERROR_POINTS_PER_SEGMENT_ counts in every convertible table
+   * segment with both the integer path and the float path (exact logarithm,
+   * same conversion method) and reports the largest difference between
+   * min_temperature and max_temperature. Uses float arithmetic; intended for
+   * host tests or commissioning, not the read loop.
+   *
+   * @param max_error_centi_celsius Pointer to store the worst-case error
+   *        (0.01°C)
+   * @return Error code
+   */
+  NtcError
+  MeasureConversionError(uint32_t *max_error_centi_celsius) const noexcept;
+
+  //==============================================================//
+  // CONSTANTS
+  //==============================================================//
+
+  static constexpr uint32_t COUNT_FRACTION_BITS_ =
+      NTC::Acquisition::COUNT_FRACTION_BITS_; ///< Fractional bits of counts
+  static constexpr uint32_t FILTER_ALPHA_BITS_ =
+      15U; ///< Fractional bits of the filter alpha
+  static constexpr uint32_t ERROR_POINTS_PER_SEGMENT_ =
+      16U; ///< Counts checked per segment by MeasureConversionError()
+
+private:
+  //==============================================================//
+  // PRIVATE MEMBER VARIABLES
+  //==============================================================//
+
+  ntc_config_t config_;    ///< NTC configuration
+  AdcType *adc_interface_; ///< ADC interface pointer
+  bool initialized_;       ///< Initialization status
+
+  // Configuration in integer form
+  int32_t calibration_offset_centi_;  ///< Calibration offset (0.01°C)
+  int32_t min_temperature_centi_;     ///< Minimum temperature (0.01°C)
+  int32_t max_temperature_centi_;     ///< Maximum temperature (0.01°C)
+  uint32_t filter_alpha_q_;           ///< Filter alpha (Q15)
+
+  // Filtering
+  int64_t filtered_temperature_q_; ///< Filter state (0.01°C, Q8)
+  bool filter_initialized_;        ///< Filter initialization status
+
+  // Acquisition
+  uint32_t last_adc_conversions_; ///< ADC conversions of the last acquisition
+
+  // ADC count -> temperature table
+  NTC::Acquisition::CountTable table_; ///< Temperatures at nodes (0.01°C)
+  uint32_t table_shift_; ///< log2(ADC counts per table segment)
+
+  // Lookup table used to build the count table
+  NTC::ValidatedLookupTable lookup_table_; ///< Table for LookupTable method
+
+  //==============================================================//
+  // PRIVATE HELPER METHODS
+  //==============================================================//
+
+  /**
+   * @brief Convert the configuration to integer form and build the table
+   * @return Error code
+   */
+  NtcError buildTables() noexcept;
+
+  /**
+   * @brief Convert an ADC count with the float path
+   * @param count ADC count
+   * @param temperature_celsius Pointer to store temperature (°C, before
+   *        calibration)
+   * @return true if the count is convertible, false otherwise
+   */
+  bool convertCountFloat(float count,
+                         float *temperature_celsius) const noexcept;
+
+  /**
+   * @brief Interpolate the table at an averaged ADC count
+   * @param count_q Averaged ADC count (COUNT_FRACTION_BITS_ fraction)
+   * @param temperature_centi_celsius Pointer to store temperature (0.01°C,
+   *        before calibration)
+   * @return true if the count lies inside the convertible range
+   */
+  bool interpolate(uint64_t count_q,
+                   int32_t *temperature_centi_celsius) const noexcept;
+
+  /**
+   * @brief Acquire sample_count raw counts and average them
+   * @param count_q Pointer to store the averaged count (COUNT_FRACTION_BITS_
+   *        fraction)
+   * @return Error code
+   */
+  NtcError acquireCount(uint64_t *count_q) noexcept;
+};
+
+// Include template implementation
+#define NTC_THERMISTOR_Q_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Template implementation file
+#include "../src/ntc_thermistor_q.cpp"
+#undef NTC_THERMISTOR_Q_HEADER_INCLUDED
+
+#endif // NTC_THERMISTOR_Q_H
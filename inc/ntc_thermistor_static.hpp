@@ -0,0 +1,300 @@
+/**
+ * @file ntc_thermistor_static.hpp
+ * @brief NTC thermistor driver specialized on a build-time configuration.
+ *
+ * This header provides a driver for channels whose configuration is fixed
+ * when the firmware is built. The configuration is a template parameter, so
+ * conversion method dispatch, filtering, sampling and every derived constant
+ * fold at compile time and the read path carries no ntc_config_t.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#ifndef NTC_THERMISTOR_STATIC_H
+#define NTC_THERMISTOR_STATIC_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ntc_acquisition.hpp"
+#include "ntc_adc_interface.hpp"
+#include "ntc_conversion.hpp"
+#include "ntc_lookup_table.hpp"
+#include "ntc_table_generator.hpp"
+#include "ntc_thermistor.hpp"
+#include "ntc_types.hpp"
+
+//--------------------------------------
+//  StaticNtcThermistor Class
+//--------------------------------------
+
+/**
+ * @class StaticNtcThermistor
+ * @brief Hardware-agnostic NTC thermistor driver with a constexpr
+ * configuration
+ *
+ * C++17 does not allow floating-point non-type template parameters, so the
+ * configuration is supplied by a provider type with a
+ * `static constexpr ntc_config_t CONFIG` member. The configuration is
+ * validated with static_assert and all constants derived from it are
+ * computed at compile time. For NtcConversionMethod::AdcCountTable the count
+ * table itself is generated at compile time and placed in read-only storage.
+ *
+ * Behaviour matches NtcThermistor with the same configuration: LookupTable
+ * falls back to the beta equation outside the table, Mathematical uses the
+ * beta equation and SteinhartHart the configured coefficients (fitting them
+ * needs the runtime driver). Auto is not measured at build time and uses the
+ * beta equation. Use NtcThermistor when the configuration has to change at
+ * runtime.
+ *
+ * @tparam AdcType The ADC implementation type that inherits from
+ * ntc::AdcInterface<AdcType>
+ * @tparam Config Configuration provider with a
+ * `static constexpr ntc_config_t CONFIG` member
+ *
+ * @example
+ * @code
+ * struct BoardSensorConfig {
+ *   static constexpr ntc_config_t CONFIG = [] {
+ *     ntc_config_t config = GetDefaultNtcConfig();
+ *     config.conversion_method = NtcConversionMethod::AdcCountTable;
+ *     config.sample_count = 4;
+ *     return config;
+ *   }();
+ * };
+ *
+ * StaticNtcThermistor<MyAdc, BoardSensorConfig> thermistor(&my_adc);
+ * thermistor.Initialize();
+ * float temperature = 0.0F;
+ * thermistor.ReadTemperatureCelsius(&temperature);
+ * @endcode
+ */
+template <typename AdcType, typename Config> class StaticNtcThermistor {
+public:
+  /// Build-time configuration
+  static constexpr ntc_config_t CONFIG = Config::CONFIG;
+
+  static_assert(CONFIG.resistance_at_25c > 0.0F,
+                "Resistance at 25°C must be positive");
+  static_assert(CONFIG.beta_value >= NTC::Constants::MIN_BETA_VALUE_ &&
+                    CONFIG.beta_value <= NTC::Constants::MAX_BETA_VALUE_,
+                "Beta value out of supported range");
+  static_assert(CONFIG.reference_voltage > 0.0F,
+                "Reference voltage must be positive");
+  static_assert(CONFIG.series_resistance > 0.0F,
+                "Series resistance must be positive");
+  static_assert(CONFIG.sample_count > 0U, "Sample count must be positive");
+  static_assert(CONFIG.adc_resolution_bits > 0U &&
+                    CONFIG.adc_resolution_bits <= 32U,
+                "ADC resolution must be 1-32 bits");
+  static_assert(CONFIG.min_temperature < CONFIG.max_temperature,
+                "Minimum temperature must be below maximum temperature");
+  static_assert(!CONFIG.enable_filtering || (CONFIG.filter_alpha >= 0.0F &&
+                                             CONFIG.filter_alpha <= 1.0F),
+                "Filter alpha must be within 0.0-1.0");
+  static_assert(CONFIG.conversion_method !=
+                        NtcConversionMethod::SteinhartHart ||
+                    CONFIG.steinhart_hart_b > 0.0F,
+                "Steinhart-Hart needs explicit coefficients (no runtime fit)");
+  static_assert(CONFIG.sampling_strategy == NtcSamplingStrategy::Mean,
+                "Static driver averages its samples (Mean strategy only)");
+  static_assert(!CONFIG.enable_filtering ||
+                    CONFIG.filter_mode == NtcFilterMode::Ema,
+                "Static driver filters with a moving average (Ema only)");
+
+  //==============================================================//
+  // CONSTRUCTORS AND DESTRUCTOR
+  //==============================================================//
+
+  /**
+   * @brief Constructor
+   * @param adc_interface Pointer to ADC interface implementation
+   */
+  explicit StaticNtcThermistor(AdcType *adc_interface) noexcept;
+
+  /**
+   * @brief Copy constructor is deleted
+   */
+  StaticNtcThermistor(const StaticNtcThermistor &) = delete;
+
+  /**
+   * @brief Assignment operator is deleted
+   */
+  StaticNtcThermistor &operator=(const StaticNtcThermistor &) = delete;
+
+  /**
+   * @brief Move constructor
+   */
+  StaticNtcThermistor(StaticNtcThermistor &&) noexcept = default;
+
+  /**
+   * @brief Move assignment operator
+   */
+  StaticNtcThermistor &operator=(StaticNtcThermistor &&) noexcept = default;
+
+  /**
+   * @brief Destructor
+   */
+  ~StaticNtcThermistor() noexcept = default;
+
+  //==============================================================//
+  // INITIALIZATION
+  //==============================================================//
+
+  /**
+   * @brief Initialize the driver
+   * @return true if successful, false otherwise
+   */
+  bool Initialize() noexcept;
+
+  /**
+   * @brief Deinitialize the driver
+   * @return true if successful, false otherwise
+   */
+  bool Deinitialize() noexcept;
+
+  /**
+   * @brief Check if initialized
+   * @return true if initialized, false otherwise
+   */
+  [[nodiscard]] bool IsInitialized() const noexcept;
+
+  //==============================================================//
+  // TEMPERATURE READING
+  //==============================================================//
+
+  /**
+   * @brief Read temperature in Celsius
+   * @param temperature_celsius Pointer to store temperature
+   * @return Error code
+   */
+  NtcError ReadTemperatureCelsius(float *temperature_celsius) noexcept;
+
+  /**
+   * @brief Read complete temperature information
+   *
+   * timestamp_us is the midpoint of the burst when the ADC type provides
+   * ReadTimestampUs(), 0 otherwise.
+   *
+   * @param reading Pointer to store reading
+   * @return Error code
+   */
+  NtcError ReadTemperature(ntc_reading_t *reading) noexcept;
+
+  /**
+   * @brief Get raw ADC value
+   * @param adc_value Pointer to store the averaged raw ADC count
+   * @return Error code
+   */
+  NtcError GetRawAdcValue(uint32_t *adc_value) noexcept;
+
+  /**
+   * @brief Get the number of ADC conversions used by the last acquisition
+   * @return ADC conversions performed by the most recent read call
+   */
+  [[nodiscard]] uint32_t GetLastAdcConversionCount() const noexcept;
+
+  /**
+   * @brief Reset the filter state
+   * @return Error code
+   */
+  NtcError ResetFilter() noexcept;
+
+private:
+  //==============================================================//
+  // COMPILE-TIME CONSTANTS
+  //==============================================================//
+
+  static constexpr float FULL_SCALE_ =
+      static_cast<float>((1ULL << CONFIG.adc_resolution_bits) -
+                         1ULL); ///< ADC full-scale count
+  static constexpr float VOLTS_PER_COUNT_ =
+      CONFIG.reference_voltage / FULL_SCALE_; ///< Volts per ADC count
+  static constexpr float INVERSE_RESISTANCE_AT_25C_ =
+      1.0F / CONFIG.resistance_at_25c; ///< 1 / R25 (1/ohm)
+  static constexpr float INVERSE_BETA_VALUE_ =
+      1.0F / CONFIG.beta_value; ///< 1 / beta (1/K)
+  static constexpr float INVERSE_REFERENCE_KELVIN_ =
+      1.0F / (NTC::Constants::REFERENCE_TEMPERATURE_C_ +
+              NTC::Constants::KELVIN_OFFSET_); ///< 1 / T0 (1/K)
+  // ADC count -> temperature table (NtcConversionMethod::AdcCountTable)
+  static constexpr uint32_t ADC_COUNT_TABLE_SHIFT_ =
+      NTC::Acquisition::CountTableShift(
+          CONFIG.adc_resolution_bits); ///< log2(ADC counts per table segment)
+
+  /**
+   * @brief Generate the ADC count table at compile time
+   * @return Temperatures at table nodes (0.01°C)
+   */
+  [[nodiscard]] static constexpr NTC::Acquisition::CountTable
+  generateAdcCountTable() noexcept;
+
+  //==============================================================//
+  // PRIVATE MEMBER VARIABLES
+  //==============================================================//
+
+  AdcType *adc_interface_; ///< ADC interface pointer
+  bool initialized_;       ///< Initialization status
+
+  // Filtering
+  float filtered_temperature_; ///< Filtered temperature
+  bool filter_initialized_;    ///< Filter initialization status
+
+  // Lookup table (NtcConversionMethod::LookupTable), resolved once
+  NTC::ValidatedLookupTable lookup_table_; ///< Table used for conversion
+
+  // Acquisition
+  uint32_t last_adc_conversions_; ///< ADC conversions of the last acquisition
+
+  //==============================================================//
+  // PRIVATE HELPER METHODS
+  //==============================================================//
+
+  /**
+   * @brief Acquire sample_count raw counts and average them
+   * @param sample Pointer to store the acquisition result
+   * @return Error code
+   */
+  NtcError acquireSample(ntc_adc_sample_t *sample) noexcept;
+
+  /**
+   * @brief Convert an acquisition to resistance and temperature
+   * @param sample Acquisition result
+   * @param resistance_ohms Pointer to store resistance (may be nullptr)
+   * @param temperature_celsius Pointer to store temperature
+   * @return Error code
+   */
+  NtcError convertSample(const ntc_adc_sample_t &sample,
+                         float *resistance_ohms,
+                         float *temperature_celsius) noexcept;
+
+  /**
+   * @brief Convert resistance to temperature with the beta equation
+   * @param resistance_ohms Resistance (ohms)
+   * @param temperature_celsius Pointer to store temperature (°C)
+   * @return true if successful, false otherwise
+   */
+  static bool convertResistanceBeta(float resistance_ohms,
+                                    float *temperature_celsius) noexcept;
+
+  /**
+   * @brief Interpolate the ADC count table
+   * @param count_q Averaged ADC count
+   *        (NTC::Acquisition::COUNT_FRACTION_BITS_ fraction)
+   * @param temperature_celsius Pointer to store temperature (°C)
+   * @return true if the count lies inside the table's convertible range
+   */
+  static bool lookupAdcCountTable(uint64_t count_q,
+                                  float *temperature_celsius) noexcept;
+};
+
+// Include template implementation
+#define NTC_THERMISTOR_STATIC_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Template implementation file
+#include "../src/ntc_thermistor_static.cpp"
+#undef NTC_THERMISTOR_STATIC_HEADER_INCLUDED
+
+#endif // NTC_THERMISTOR_STATIC_H
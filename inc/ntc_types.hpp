@@ -19,6 +19,30 @@
 
 #include <cstdint>
 
+/**
+ * @brief Enable the NtcThermistor statistics block (0 = disabled)
+ *
+ * Define as 1 in the build (e.g. target_compile_definitions()) to collect
+ * ntc_stats_t counters and per-stage cycle timing. When 0 the counters and
+ * their updates are not compiled in.
+ */
+#ifndef NTC_ENABLE_STATS
+#define NTC_ENABLE_STATS 0
+#endif
+
+/**
+ * @brief Store the built-in lookup tables in the compact layout (0 = float)
+ *
+ * Define as 1 in the build to store built-in curves as uint16_t temperature
+ * codes on a uniform resistance key grid (2 bytes per entry instead of 8).
+ * Adds at most 0.005°C of quantization error.
+ *
+ * @see NTC::ntc_lookup_table_t
+ */
+#ifndef NTC_COMPACT_LOOKUP_TABLES
+#define NTC_COMPACT_LOOKUP_TABLES 0
+#endif
+
 //--------------------------------------
 //  NTC Error Codes
 //--------------------------------------
@@ -51,7 +75,8 @@ enum class NtcError : uint8_t {
   UnsupportedOperation = 13, ///< Operation not supported
   Timeout = 14,              ///< Operation timeout
   HardwareFault = 15,        ///< Hardware fault
-  Max = 16                   ///< Maximum error code
+  Busy = 16,                 ///< Asynchronous conversion in progress
+  Max = 17                   ///< Maximum error code
 };
 
 //--------------------------------------
@@ -81,12 +106,17 @@ enum class NtcType : uint8_t {
  * @brief Temperature conversion methods
  *
  * Methods for converting resistance to temperature. The driver supports
- * two conversion approaches with different trade-offs:
+ * several conversion approaches with different trade-offs:
  *
  * - **Lookup Table**: Fast, pre-calculated values, slightly less accurate
- * - **Mathematical**: Slower, uses Steinhart-Hart or Beta equations, more
- * accurate
- * - **Auto**: Automatically selects the best method based on configuration
+ * - **Mathematical**: Slower, uses the Beta equation
+ * - **Auto**: Picks the cheapest method that meets the configured accuracy
+ *   and cost budgets (auto_max_error_celsius, auto_max_cost)
+ * - **ADC Count Table**: Fastest, maps the raw ADC count straight to
+ *   temperature through a table built from the configuration at
+ *   initialization (no division or logarithm per read)
+ * - **Steinhart-Hart**: Three-coefficient equation; uses the configured
+ *   coefficients or fits them to the lookup table (or Beta curve)
  *
  * @note For real-time applications requiring high update rates, use
  *       NtcConversionMethod::LookupTable. For maximum accuracy, use
@@ -95,7 +125,70 @@ enum class NtcType : uint8_t {
 enum class NtcConversionMethod : uint8_t {
   LookupTable = 0,  ///< Use lookup table (faster, less accurate)
   Mathematical = 1, ///< Use mathematical conversion (slower, more accurate)
-  Auto = 2          ///< Auto-select based on accuracy requirements
+  Auto = 2,          ///< Auto-select based on accuracy and cost budgets
+  AdcCountTable = 3, ///< Use precomputed ADC count table (fastest)
+  SteinhartHart = 4  ///< Use Steinhart-Hart equation
+};
+
+/**
+ * @brief Reduction of an oversampled burst to one ADC count
+ *
+ * Applied to the raw counts of the sample_count conversions of a read, in
+ * integer arithmetic; the reduced count is converted to volts once. Failed
+ * conversions are excluded before the reduction.
+ *
+ * - **Mean**: Mean of the valid counts
+ * - **Decimate**: Oversample and decimate: the sum of 4^k counts shifted
+ *   right by k keeps k extra bits, so the mean is quantized to 2^-k counts
+ *   (k = floor(log4(valid samples)))
+ * - **Median**: Median of the valid counts; rejects spikes entirely
+ * - **TrimmedMean**: Mean of the valid counts without the lowest and highest
+ *   quarter; rejects spikes while keeping most of the averaging
+ *
+ * @note Median and TrimmedMean hold the counts of a read and accept at most
+ *       32 samples.
+ */
+enum class NtcSamplingStrategy : uint8_t {
+  Mean = 0,       ///< Mean of all valid samples
+  Decimate = 1,   ///< Oversample and decimate (extra bits of resolution)
+  Median = 2,     ///< Median of the valid samples
+  TrimmedMean = 3 ///< Mean of the middle half of the valid samples
+};
+
+/**
+ * @brief Temperature filter applied when filtering is enabled
+ *
+ * - **Ema**: Exponential moving average with filter_alpha; trades noise
+ *   against lag
+ * - **ThermalLag**: Ema followed by a first-order lag compensator for a
+ *   sensor with time constant filter_time_constant_s, which recovers the
+ *   temperature the sensor is converging to instead of its lagging reading
+ * - **Kalman**: Scalar Kalman filter on a random-walk temperature model
+ *   (filter_process_noise, filter_measurement_noise); the gain adapts to the
+ *   time between readings
+ *
+ * ThermalLag and Kalman take the time step from the reading timestamps.
+ * Readings without a timestamp (see ntc_reading_t::timestamp_us) use
+ * filter_sample_period_s, so with an ADC type that has no ReadTimestampUs()
+ * clock these modes require filter_sample_period_s > 0.
+ */
+enum class NtcFilterMode : uint8_t {
+  Ema = 0,        ///< Exponential moving average
+  ThermalLag = 1, ///< Moving average with sensor lag compensation
+  Kalman = 2      ///< Scalar Kalman filter
+};
+
+/**
+ * @brief Status of an asynchronous conversion
+ *
+ * @see NtcThermistor::StartConversion()
+ * @see NtcThermistor::Poll()
+ */
+enum class NtcConversionStatus : uint8_t {
+  Idle = 0,       ///< No conversion started
+  InProgress = 1, ///< Samples still pending
+  Complete = 2,   ///< Reading available (check its error field)
+  Unchanged = 3   ///< Count within the report deadband; reading not updated
 };
 
 //--------------------------------------
@@ -133,6 +226,55 @@ struct ntc_config_t {
   float max_temperature;                 ///< Maximum temperature (°C)
   bool enable_filtering;                 ///< Enable temperature filtering
   float filter_alpha;                    ///< Filter alpha value (0.0-1.0)
+  NtcFilterMode filter_mode;             ///< Filter applied when enabled
+  float filter_time_constant_s;   ///< ThermalLag: sensor time constant (s)
+  float filter_process_noise;     ///< Kalman: process noise (°C²/s)
+  float filter_measurement_noise; ///< Kalman: measurement noise (°C²)
+  bool enable_fast_log; ///< Use NTC::FastLog() instead of std::log
+  float steinhart_hart_a; ///< Steinhart-Hart A (all three 0 = fit to table)
+  float steinhart_hart_b; ///< Steinhart-Hart B
+  float steinhart_hart_c; ///< Steinhart-Hart C
+  float auto_max_error_celsius; ///< Auto: accuracy budget (°C)
+  uint32_t auto_max_cost;       ///< Auto: cost budget (0 = unlimited)
+  uint32_t report_deadband_counts; ///< Change reporting deadband (0 = off)
+  bool defer_conversion_setup; ///< Build tables on first use, not up front
+  NtcSamplingStrategy sampling_strategy; ///< Reduction of the samples
+  float filter_sample_period_s; ///< Period of untimestamped readings (s)
+};
+
+/**
+ * @brief Conversion method selected by an NtcThermistor instance
+ *
+ * Describes the method the driver actually converts with (never Auto), its
+ * worst-case error against the reference model over min_temperature to
+ * max_temperature, and its estimated cost. The reference model is the
+ * explicit Steinhart-Hart coefficients when configured, otherwise the lookup
+ * table when available, otherwise the Beta equation. The error is measured
+ * per instance; the cost is the static NTC::ConversionCost estimate (exact
+ * Beta equation = 100), not a measurement on the target.
+ *
+ * @see NtcThermistor::GetConversionReport()
+ */
+struct ntc_conversion_report_t {
+  NtcConversionMethod method; ///< Method used for conversion
+  float max_error_celsius;    ///< Worst-case error vs reference model (°C)
+  uint32_t cost; ///< Static relative cost estimate (exact Beta = 100)
+};
+
+/**
+ * @brief Per-channel parameters of an NtcThermistorArray
+ *
+ * Parameters shared by all channels (reference voltage, ADC resolution,
+ * sampling, limits, filtering) come from the array's ntc_config_t.
+ *
+ * @see NtcThermistorArray
+ */
+struct ntc_channel_config_t {
+  uint8_t adc_channel;      ///< ADC channel number
+  float resistance_at_25c;  ///< Resistance at 25°C (ohms)
+  float beta_value;         ///< Beta value (K)
+  float series_resistance;  ///< Series resistance in voltage divider (ohms)
+  float calibration_offset; ///< Calibration offset (°C)
 };
 
 /**
@@ -153,10 +295,155 @@ struct ntc_reading_t {
   float resistance_ohms;        ///< Thermistor resistance (ohms)
   float voltage_volts;          ///< Voltage across thermistor (V)
   uint32_t adc_raw_value;       ///< Raw ADC value
-  uint64_t timestamp_us;        ///< Timestamp (microseconds)
+  uint64_t timestamp_us;        ///< Acquisition time (µs, 0 if unknown)
   NtcError error;               ///< Error code
   bool is_valid;                ///< Whether reading is valid
   float accuracy_celsius;       ///< Estimated accuracy (°C)
+  uint32_t adc_conversions;     ///< ADC conversions used for this reading
+};
+
+/**
+ * @brief Raw ADC acquisition result
+ *
+ * Result of a single acquisition burst (sample_count conversions on the
+ * configured channel). The averaged count and the voltage derived from it
+ * describe the same samples, so every value computed from one acquisition
+ * (resistance, temperature) is mutually consistent. count_q keeps the
+ * fraction of the averaged count (NTC::Acquisition::COUNT_FRACTION_BITS_)
+ * for the ADC count table.
+ *
+ * @see NtcThermistor::ReadTemperature()
+ */
+struct ntc_adc_sample_t {
+  uint32_t raw_count;       ///< Averaged raw ADC count (whole counts)
+  float voltage_volts;      ///< Voltage derived from the averaged count (V)
+  uint32_t conversions;     ///< ADC conversions attempted in the burst
+  uint32_t valid_samples;   ///< Conversions that completed successfully
+  uint64_t timestamp_us;    ///< Midpoint of the sampling window (µs)
+  uint64_t count_q;         ///< Averaged count with 8 fractional bits
+};
+
+/**
+ * @brief Cycle timing of one read stage
+ *
+ * Cycles come from the ADC type's optional ReadCycleCounter() hook (see
+ * ntc::HasReadCycleCounter) and stay 0 without it. The average is
+ * total_cycles / samples.
+ */
+struct ntc_stage_stats_t {
+  uint32_t samples;      ///< Timed executions of the stage
+  uint32_t min_cycles;   ///< Fastest execution (cycles)
+  uint32_t max_cycles;   ///< Slowest execution (cycles)
+  uint64_t total_cycles; ///< Sum over all executions (cycles)
+};
+
+/**
+ * @brief Hot-path counters of an NtcThermistor instance
+ *
+ * Collected only when NTC_ENABLE_STATS is 1.
+ *
+ * @see NtcThermistor::GetStats()
+ */
+struct ntc_stats_t {
+  uint32_t adc_conversions;      ///< ADC conversions requested
+  uint32_t failed_samples;       ///< Conversions that returned an error
+  uint32_t table_hits;           ///< Conversions served by a table
+  uint32_t table_fallbacks;      ///< Table misses converted by the equation
+  uint32_t equation_conversions; ///< Conversions by the Beta/S-H equation
+  uint32_t conversion_failures;  ///< Invalid resistance or conversion errors
+  uint32_t out_of_range;         ///< Readings outside min..max temperature
+  uint32_t unchanged_readings;   ///< Reads skipped within the report deadband
+  ntc_stage_stats_t acquisition; ///< ADC acquisition and averaging
+  ntc_stage_stats_t conversion;  ///< Count to temperature conversion
+};
+
+/**
+ * @brief Statistics of an NtcHistory window
+ *
+ * @see NtcHistory::GetStats()
+ */
+struct ntc_history_stats_t {
+  uint32_t count;                 ///< Readings in the window
+  float min_celsius;              ///< Minimum temperature (°C)
+  float max_celsius;              ///< Maximum temperature (°C)
+  float mean_celsius;             ///< Mean temperature (°C)
+  float slope_celsius_per_sample; ///< Least-squares slope (°C per reading)
+  float rate_celsius_per_second;  ///< Slope over time (0 without timestamps)
+};
+
+/**
+ * @brief Adaptive sampling configuration
+ *
+ * The sampler rates its urgency from 0 (flat, far from the limits) to 1
+ * (|dT/dt| at full_rate_slope_celsius_per_second, or at a limit) and picks
+ * the interval and sample count between the bounds accordingly.
+ *
+ * @see NtcAdaptiveSampler
+ */
+struct ntc_adaptive_config_t {
+  uint32_t min_interval_ms;  ///< Read interval at full urgency (ms)
+  uint32_t max_interval_ms;  ///< Read interval when flat (ms)
+  uint32_t min_sample_count; ///< sample_count when flat
+  uint32_t max_sample_count; ///< sample_count at full urgency
+  float full_rate_slope_celsius_per_second; ///< |dT/dt| for full urgency
+  float low_limit_celsius;    ///< Lower threshold watched (°C)
+  float high_limit_celsius;   ///< Upper threshold watched (°C)
+  float limit_margin_celsius; ///< Escalation distance from a limit (0 = off)
+};
+
+/**
+ * @brief Scheduling parameters of one sensor of an NtcScanScheduler
+ *
+ * The sensor is released every period_us, starting phase_us after
+ * NtcScanScheduler::Start(), and each release must complete within
+ * deadline_us. Sensors on the same adc_unit convert one at a time, highest
+ * priority first; sensors on different units convert concurrently.
+ *
+ * @see NtcScanScheduler::AddSensor()
+ */
+struct ntc_scan_sensor_config_t {
+  uint32_t period_us;   ///< Release period (µs, > 0)
+  uint32_t deadline_us; ///< Completion deadline after release (µs, 0 = period)
+  uint32_t phase_us;    ///< First release after Start() (µs)
+  uint8_t priority;     ///< Higher is converted first on a shared unit
+  uint8_t adc_unit;     ///< ADC unit the sensor is converted on
+};
+
+/**
+ * @brief Timing statistics of NtcScanScheduler releases
+ *
+ * Jitter is the delay from a release to the start of its conversion,
+ * response time the delay from a release to its completion.
+ *
+ * @see NtcScanScheduler::GetStats()
+ */
+struct ntc_scan_stats_t {
+  uint32_t releases;        ///< Releases (periods elapsed)
+  uint32_t completed;       ///< Conversions completed
+  uint32_t overruns;        ///< Releases dropped: previous one not complete
+  uint32_t deadline_misses; ///< Conversions completed after the deadline
+  uint32_t errors;          ///< Conversions that failed or did not start
+  uint32_t max_jitter_us;   ///< Largest release-to-start delay (µs)
+  uint32_t mean_jitter_us;  ///< Mean release-to-start delay (µs)
+  uint32_t max_response_us; ///< Largest release-to-completion delay (µs)
+};
+
+/**
+ * @brief Conversion constants derived from an ntc_config_t
+ *
+ * Cached by NtcThermistor whenever a parameter they depend on changes, so
+ * the read path multiplies by them instead of re-deriving them per sample.
+ *
+ * @see NtcThermistor::SetConfiguration()
+ */
+struct ntc_conversion_context_t {
+  float volts_per_count;           ///< Reference voltage / ADC full scale (V)
+  float inverse_resistance_at_25c; ///< 1 / resistance at 25°C (1/ohm)
+  float inverse_beta_value;        ///< 1 / beta value (1/K)
+  float steinhart_hart_a;          ///< Resolved Steinhart-Hart A
+  float steinhart_hart_b;          ///< Resolved Steinhart-Hart B
+  float steinhart_hart_c;          ///< Resolved Steinhart-Hart C
+  bool steinhart_hart_valid;       ///< Steinhart-Hart coefficients usable
 };
 
 //--------------------------------------
@@ -181,14 +468,68 @@ constexpr uint32_t DEFAULT_ADC_RESOLUTION_BITS_ =
     12U; ///< Default ADC resolution (12-bit)
 constexpr uint32_t DEFAULT_SAMPLE_COUNT_ = 1U;    ///< Default sample count
 constexpr uint32_t DEFAULT_SAMPLE_DELAY_MS_ = 0U; ///< Default sample delay (ms)
+constexpr NtcSamplingStrategy DEFAULT_SAMPLING_STRATEGY_ =
+    NtcSamplingStrategy::Mean; ///< Default sampling strategy
 constexpr float DEFAULT_MIN_TEMPERATURE_ =
     -40.0F; ///< Default minimum temperature (°C)
 constexpr float DEFAULT_MAX_TEMPERATURE_ =
     125.0F; ///< Default maximum temperature (°C)
 constexpr bool DEFAULT_ENABLE_FILTERING_ = false; ///< Default filtering enabled
 constexpr float DEFAULT_FILTER_ALPHA_ = 0.1F; ///< Default filter alpha value
+constexpr NtcFilterMode DEFAULT_FILTER_MODE_ =
+    NtcFilterMode::Ema; ///< Default filter mode
+constexpr float DEFAULT_FILTER_TIME_CONSTANT_S_ =
+    5.0F; ///< Default sensor time constant (s)
+constexpr float DEFAULT_FILTER_PROCESS_NOISE_ =
+    0.01F; ///< Default Kalman process noise (°C²/s)
+constexpr float DEFAULT_FILTER_MEASUREMENT_NOISE_ =
+    0.01F; ///< Default Kalman measurement noise (°C², 0.1°C RMS)
+constexpr float DEFAULT_FILTER_SAMPLE_PERIOD_S_ =
+    0.0F; ///< Default nominal reading period (none: timestamps required)
+constexpr bool DEFAULT_ENABLE_FAST_LOG_ = false; ///< Default fast log enabled
+constexpr float DEFAULT_STEINHART_HART_COEFFICIENT_ =
+    0.0F; ///< Default Steinhart-Hart coefficients (fit at initialization)
+constexpr float DEFAULT_AUTO_MAX_ERROR_CELSIUS_ =
+    0.1F; ///< Default Auto accuracy budget (°C)
+constexpr uint32_t DEFAULT_AUTO_MAX_COST_ =
+    0U; ///< Default Auto cost budget (unlimited)
+constexpr uint32_t DEFAULT_REPORT_DEADBAND_COUNTS_ =
+    0U; ///< Default report deadband (report every reading)
+constexpr bool DEFAULT_DEFER_CONVERSION_SETUP_ =
+    false; ///< Default conversion setup (built eagerly)
+constexpr uint32_t DEFAULT_ADAPTIVE_MIN_INTERVAL_MS_ =
+    100U; ///< Default adaptive interval at full urgency (ms)
+constexpr uint32_t DEFAULT_ADAPTIVE_MAX_INTERVAL_MS_ =
+    5000U; ///< Default adaptive interval when flat (ms)
+constexpr uint32_t DEFAULT_ADAPTIVE_MIN_SAMPLE_COUNT_ =
+    1U; ///< Default adaptive sample count when flat
+constexpr uint32_t DEFAULT_ADAPTIVE_MAX_SAMPLE_COUNT_ =
+    8U; ///< Default adaptive sample count at full urgency
+constexpr float DEFAULT_ADAPTIVE_FULL_RATE_SLOPE_ =
+    0.5F; ///< Default |dT/dt| for full urgency (°C/s)
+constexpr float DEFAULT_ADAPTIVE_LIMIT_MARGIN_ =
+    10.0F; ///< Default escalation distance from a limit (°C)
 } // namespace NTC::DefaultConfig
 
+/**
+ * @brief Relative cost of each conversion method (exact Beta equation = 100)
+ *
+ * Static estimates: time per count-to-temperature conversion on the host
+ * benchmark, normalized to the exact Beta equation. They are not measured on
+ * the target, so the ranking can differ on an MCU (e.g. without an FPU).
+ * Used by NtcConversionMethod::Auto against ntc_config_t::auto_max_cost and
+ * reported in ntc_conversion_report_t.
+ */
+namespace NTC::ConversionCost {
+constexpr uint32_t ADC_COUNT_TABLE_ = 10U; ///< ADC count table
+constexpr uint32_t LOOKUP_TABLE_ = 35U;    ///< Resistance lookup table
+constexpr uint32_t BETA_ = 100U;           ///< Beta equation, std::log
+constexpr uint32_t BETA_FAST_LOG_ = 85U;   ///< Beta equation, NTC::FastLog()
+constexpr uint32_t STEINHART_HART_ = 110U; ///< Steinhart-Hart, std::log
+constexpr uint32_t STEINHART_HART_FAST_LOG_ =
+    95U; ///< Steinhart-Hart, NTC::FastLog()
+} // namespace NTC::ConversionCost
+
 /**
  * @brief Default NTC configuration for NTCG163JFT103FT1S
  *
@@ -221,7 +562,31 @@ GetDefaultNtcG163Jft103Ft1SConfig() noexcept {
           .min_temperature = NTC::DefaultConfig::DEFAULT_MIN_TEMPERATURE_,
           .max_temperature = NTC::DefaultConfig::DEFAULT_MAX_TEMPERATURE_,
           .enable_filtering = NTC::DefaultConfig::DEFAULT_ENABLE_FILTERING_,
-          .filter_alpha = NTC::DefaultConfig::DEFAULT_FILTER_ALPHA_};
+          .filter_alpha = NTC::DefaultConfig::DEFAULT_FILTER_ALPHA_,
+          .filter_mode = NTC::DefaultConfig::DEFAULT_FILTER_MODE_,
+          .filter_time_constant_s =
+              NTC::DefaultConfig::DEFAULT_FILTER_TIME_CONSTANT_S_,
+          .filter_process_noise =
+              NTC::DefaultConfig::DEFAULT_FILTER_PROCESS_NOISE_,
+          .filter_measurement_noise =
+              NTC::DefaultConfig::DEFAULT_FILTER_MEASUREMENT_NOISE_,
+          .enable_fast_log = NTC::DefaultConfig::DEFAULT_ENABLE_FAST_LOG_,
+          .steinhart_hart_a =
+              NTC::DefaultConfig::DEFAULT_STEINHART_HART_COEFFICIENT_,
+          .steinhart_hart_b =
+              NTC::DefaultConfig::DEFAULT_STEINHART_HART_COEFFICIENT_,
+          .steinhart_hart_c =
+              NTC::DefaultConfig::DEFAULT_STEINHART_HART_COEFFICIENT_,
+          .auto_max_error_celsius =
+              NTC::DefaultConfig::DEFAULT_AUTO_MAX_ERROR_CELSIUS_,
+          .auto_max_cost = NTC::DefaultConfig::DEFAULT_AUTO_MAX_COST_,
+          .report_deadband_counts =
+              NTC::DefaultConfig::DEFAULT_REPORT_DEADBAND_COUNTS_,
+          .defer_conversion_setup =
+              NTC::DefaultConfig::DEFAULT_DEFER_CONVERSION_SETUP_,
+          .sampling_strategy = NTC::DefaultConfig::DEFAULT_SAMPLING_STRATEGY_,
+          .filter_sample_period_s =
+              NTC::DefaultConfig::DEFAULT_FILTER_SAMPLE_PERIOD_S_};
 }
 
 /**
@@ -238,4 +603,32 @@ GetDefaultNtcG163Jft103Ft1SConfig() noexcept {
   return GetDefaultNtcG163Jft103Ft1SConfig();
 }
 
+/**
+ * @brief Default adaptive sampling configuration
+ *
+ * Reads every 5 s with one sample while the temperature is flat and within
+ * the default temperature range, escalating to every 100 ms with 8 samples.
+ *
+ * @return ntc_adaptive_config_t with default values
+ *
+ * @see NtcAdaptiveSampler
+ */
+[[nodiscard]] constexpr ntc_adaptive_config_t
+GetDefaultNtcAdaptiveConfig() noexcept {
+  return {.min_interval_ms =
+              NTC::DefaultConfig::DEFAULT_ADAPTIVE_MIN_INTERVAL_MS_,
+          .max_interval_ms =
+              NTC::DefaultConfig::DEFAULT_ADAPTIVE_MAX_INTERVAL_MS_,
+          .min_sample_count =
+              NTC::DefaultConfig::DEFAULT_ADAPTIVE_MIN_SAMPLE_COUNT_,
+          .max_sample_count =
+              NTC::DefaultConfig::DEFAULT_ADAPTIVE_MAX_SAMPLE_COUNT_,
+          .full_rate_slope_celsius_per_second =
+              NTC::DefaultConfig::DEFAULT_ADAPTIVE_FULL_RATE_SLOPE_,
+          .low_limit_celsius = NTC::DefaultConfig::DEFAULT_MIN_TEMPERATURE_,
+          .high_limit_celsius = NTC::DefaultConfig::DEFAULT_MAX_TEMPERATURE_,
+          .limit_margin_celsius =
+              NTC::DefaultConfig::DEFAULT_ADAPTIVE_LIMIT_MARGIN_};
+}
+
 #endif // NTC_TYPES_H
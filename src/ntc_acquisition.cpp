@@ -0,0 +1,313 @@
+/**
+ * @file ntc_acquisition.cpp
+ * @brief Acquisition and ADC count table helpers shared by the drivers.
+ *
+ * This file contains the implementation of the helpers declared in
+ * ntc_acquisition.hpp.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ *
+ * @note This file is included by ntc_acquisition.hpp for template
+ *       instantiation. It should not be compiled separately when included.
+ */
+
+#ifndef NTC_ACQUISITION_IMPL
+#define NTC_ACQUISITION_IMPL
+
+// When included from header, use relative path; when compiled directly, use
+// standard include
+#ifdef NTC_ACQUISITION_HEADER_INCLUDED
+#include "../inc/ntc_acquisition.hpp"
+#include "../inc/ntc_conversion.hpp"
+#else
+#include "ntc_acquisition.hpp"
+#include "ntc_conversion.hpp"
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+namespace NTC::Acquisition {
+
+using NTC::Constants::MILLISECONDS_PER_SECOND_;
+using NTC::Constants::ZERO_FLOAT_;
+
+//--------------------------------------
+//  CONFIGURATION CHECKS
+//--------------------------------------
+
+inline NtcError ValidateConfiguration(const ntc_config_t &config) noexcept {
+  if (config.resistance_at_25c <= ZERO_FLOAT_) {
+    return NtcError::InvalidParameter;
+  }
+
+  if (!NTC::ValidateBetaValue(config.beta_value)) {
+    return NtcError::InvalidParameter;
+  }
+
+  if (config.reference_voltage <= ZERO_FLOAT_) {
+    return NtcError::InvalidParameter;
+  }
+
+  if (config.series_resistance <= ZERO_FLOAT_) {
+    return NtcError::InvalidParameter;
+  }
+
+  if (!IsValidSamplingPlan(config.sample_count, config.sampling_strategy)) {
+    return NtcError::InvalidParameter;
+  }
+
+  constexpr uint32_t MAX_ADC_RESOLUTION_BITS_ = 32U;
+  if (config.adc_resolution_bits == 0 ||
+      config.adc_resolution_bits > MAX_ADC_RESOLUTION_BITS_) {
+    return NtcError::InvalidParameter;
+  }
+
+  if (config.min_temperature >= config.max_temperature) {
+    return NtcError::InvalidParameter;
+  }
+
+  constexpr float MIN_FILTER_ALPHA_ = ZERO_FLOAT_;
+  constexpr float MAX_FILTER_ALPHA_ = 1.0F;
+  if (config.enable_filtering && (config.filter_alpha < MIN_FILTER_ALPHA_ ||
+                                  config.filter_alpha > MAX_FILTER_ALPHA_)) {
+    return NtcError::InvalidParameter;
+  }
+
+  if (config.enable_filtering && !IsValidFilterMode(config)) {
+    return NtcError::InvalidParameter;
+  }
+
+  // All-zero Steinhart-Hart coefficients request a fit
+  const bool fit_steinhart_hart = config.steinhart_hart_a == ZERO_FLOAT_ &&
+                                  config.steinhart_hart_b == ZERO_FLOAT_ &&
+                                  config.steinhart_hart_c == ZERO_FLOAT_;
+  if (!fit_steinhart_hart && !NTC::ValidateSteinhartHartCoefficients(
+                                 config.steinhart_hart_a,
+                                 config.steinhart_hart_b,
+                                 config.steinhart_hart_c)) {
+    return NtcError::InvalidParameter;
+  }
+
+  if (!(config.auto_max_error_celsius >= ZERO_FLOAT_)) {
+    return NtcError::InvalidParameter;
+  }
+
+  return NtcError::Success;
+}
+
+inline bool IsValidSamplingPlan(uint32_t sample_count,
+                                NtcSamplingStrategy strategy) noexcept {
+  if (sample_count == 0U) {
+    return false;
+  }
+
+  switch (strategy) {
+  case NtcSamplingStrategy::Mean:
+  case NtcSamplingStrategy::Decimate:
+    return true;
+  case NtcSamplingStrategy::Median:
+  case NtcSamplingStrategy::TrimmedMean:
+    return sample_count <= MAX_ORDERED_SAMPLES_;
+  default:
+    return false;
+  }
+}
+
+inline bool IsValidFilterMode(const ntc_config_t &config) noexcept {
+  if (!(config.filter_sample_period_s >= ZERO_FLOAT_) ||
+      !std::isfinite(config.filter_sample_period_s)) {
+    return false;
+  }
+
+  switch (config.filter_mode) {
+  case NtcFilterMode::Ema:
+    return true;
+  case NtcFilterMode::ThermalLag:
+    return config.filter_time_constant_s > ZERO_FLOAT_ &&
+           std::isfinite(config.filter_time_constant_s);
+  case NtcFilterMode::Kalman:
+    return config.filter_process_noise >= ZERO_FLOAT_ &&
+           config.filter_measurement_noise > ZERO_FLOAT_ &&
+           std::isfinite(config.filter_process_noise) &&
+           std::isfinite(config.filter_measurement_noise);
+  default:
+    return false;
+  }
+}
+
+//--------------------------------------
+//  ACQUISITION
+//--------------------------------------
+
+template <typename AdcType>
+ntc_count_sum_t AcquireCounts(AdcType *adc, uint8_t channel,
+                              uint32_t sample_count, uint32_t sample_delay_ms,
+                              uint32_t *counts) noexcept {
+  ntc_count_sum_t result = {0U, 0U, 0U, ntc::AdcError::Success};
+
+  if constexpr (ntc::HasReadChannelBurst<AdcType>::value) {
+    // One transfer per chunk instead of one driver round trip per sample;
+    // an explicit sample delay keeps the paced loop below
+    if (sample_delay_ms == 0U) {
+      std::array<uint32_t, BURST_CHUNK_SAMPLES_> burst = {};
+      for (uint32_t done = 0; done < sample_count;) {
+        const uint32_t chunk =
+            std::min(BURST_CHUNK_SAMPLES_, sample_count - done);
+        ntc::AdcError err =
+            adc->ReadChannelBurst(channel, burst.data(), chunk);
+        result.conversions += chunk;
+        if (err == ntc::AdcError::Success) {
+          for (uint32_t j = 0; j < chunk; ++j) {
+            result.sum += burst[j];
+          }
+          if (counts != nullptr) {
+            std::copy(burst.begin(), burst.begin() + chunk,
+                      counts + result.valid_samples);
+          }
+          result.valid_samples += chunk;
+        } else {
+          result.last_error = err;
+        }
+        done += chunk;
+      }
+      return result;
+    }
+  }
+
+  RunPacedReads(sample_count, sample_delay_ms, [&]() noexcept {
+    uint32_t sample_value = 0;
+    ntc::AdcError err = adc->ReadChannelCount(channel, &sample_value);
+    result.conversions++;
+    if (err == ntc::AdcError::Success) {
+      result.sum += sample_value;
+      if (counts != nullptr) {
+        counts[result.valid_samples] = sample_value;
+      }
+      result.valid_samples++;
+    } else {
+      result.last_error = err;
+    }
+  });
+  return result;
+}
+
+template <typename ReadFn>
+void RunPacedReads(uint32_t sample_count, uint32_t sample_delay_ms,
+                   ReadFn read) noexcept {
+  for (uint32_t i = 0; i < sample_count; ++i) {
+    read();
+    if (i < sample_count - 1U) {
+      DelayMilliseconds(sample_delay_ms);
+    }
+  }
+}
+
+inline NtcError NoValidSampleError(uint32_t sample_count,
+                                   ntc::AdcError last_error) noexcept {
+  // Preserve the ADC error for single-sample reads
+  return (sample_count == 1U) ? ConvertAdcError(last_error)
+                              : NtcError::AdcReadFailed;
+}
+
+inline NtcError ConvertAdcError(ntc::AdcError error) noexcept {
+  switch (error) {
+  case ntc::AdcError::Success:
+    return NtcError::Success;
+  case ntc::AdcError::NotInitialized:
+    return NtcError::NotInitialized;
+  case ntc::AdcError::InvalidChannel:
+    return NtcError::InvalidParameter;
+  case ntc::AdcError::ReadFailed:
+    return NtcError::AdcReadFailed;
+  case ntc::AdcError::Timeout:
+    return NtcError::Timeout;
+  case ntc::AdcError::HardwareError:
+    return NtcError::HardwareFault;
+  default:
+    return NtcError::AdcReadFailed;
+  }
+}
+
+inline void DelayMilliseconds(uint32_t delay_ms) noexcept {
+  if (delay_ms == 0) {
+    return;
+  }
+
+  // Simple busy-wait delay (approximate, but hardware-agnostic)
+  volatile uint32_t delay_count =
+      delay_ms * static_cast<uint32_t>(MILLISECONDS_PER_SECOND_);
+  while (delay_count-- > 0) {
+    // Busy wait
+  }
+}
+
+template <typename AdcType> uint64_t ReadTimestampUs(AdcType *adc) noexcept {
+  if constexpr (ntc::HasReadTimestampUs<AdcType>::value) {
+    if (adc != nullptr) {
+      return adc->ReadTimestampUs();
+    }
+  }
+  (void)adc;
+  return 0U;
+}
+
+//--------------------------------------
+//  ADC COUNT TABLE
+//--------------------------------------
+
+template <typename ConvertFn>
+void FillCountTable(uint32_t shift, ConvertFn convert,
+                    CountTable *table) noexcept {
+  constexpr float CENTI_DEGREES_PER_DEGREE_ = 100.0F;
+  constexpr float MAX_TABLE_CENTI_DEGREES_ = 32767.0F;
+  constexpr float MIN_TABLE_CENTI_DEGREES_ = -32767.0F;
+
+  for (uint32_t node = 0; node <= COUNT_TABLE_SEGMENTS_; ++node) {
+    const float count =
+        static_cast<float>(static_cast<uint64_t>(node) << shift);
+
+    float temperature_celsius = 0.0F;
+    int16_t entry = COUNT_TABLE_INVALID_;
+    if (convert(count, &temperature_celsius)) {
+      const float centi_degrees =
+          std::round(temperature_celsius * CENTI_DEGREES_PER_DEGREE_);
+      if (centi_degrees >= MIN_TABLE_CENTI_DEGREES_ &&
+          centi_degrees <= MAX_TABLE_CENTI_DEGREES_) {
+        entry = static_cast<int16_t>(centi_degrees);
+      }
+    }
+    (*table)[node] = entry;
+  }
+}
+
+inline bool InterpolateCountTable(const CountTable &table,
+                                  uint32_t segment_shift, uint64_t count_q,
+                                  int32_t *temperature_centi_celsius) noexcept {
+  const uint64_t index = count_q >> segment_shift;
+  if (index >= COUNT_TABLE_SEGMENTS_) {
+    return false;
+  }
+
+  const int32_t lower = table[index];
+  const int32_t upper = table[index + 1U];
+  if (lower == COUNT_TABLE_INVALID_ || upper == COUNT_TABLE_INVALID_) {
+    // Outside the convertible range; let the mathematical path report it
+    return false;
+  }
+
+  // Integer linear interpolation inside the segment
+  const int64_t fraction =
+      static_cast<int64_t>(count_q & ((1ULL << segment_shift) - 1ULL));
+  *temperature_centi_celsius =
+      lower +
+      static_cast<int32_t>((static_cast<int64_t>(upper - lower) * fraction) >>
+                           segment_shift);
+  return true;
+}
+
+} // namespace NTC::Acquisition
+
+#endif // NTC_ACQUISITION_IMPL
@@ -0,0 +1,250 @@
+/**
+ * @file ntc_adaptive_sampler.cpp
+ * @brief Adaptive read scheduler implementation.
+ *
+ * This file contains the implementation of the NtcAdaptiveSampler class that
+ * picks the read interval and sample count of a thermistor from its
+ * temperature slope and distance to the watched limits.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ *
+ * @note This file is included by ntc_adaptive_sampler.hpp for template
+ *       instantiation. It should not be compiled separately when included.
+ */
+
+#ifndef NTC_ADAPTIVE_SAMPLER_IMPL
+#define NTC_ADAPTIVE_SAMPLER_IMPL
+
+// When included from header, use relative path; when compiled directly, use
+// standard include
+#ifdef NTC_ADAPTIVE_SAMPLER_HEADER_INCLUDED
+#include "../inc/ntc_adaptive_sampler.hpp"
+#else
+#include "ntc_adaptive_sampler.hpp"
+#endif
+
+#include "ntc_conversion.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//--------------------------------------
+//  CONSTRUCTORS
+//--------------------------------------
+
+template <typename AdcType>
+NtcAdaptiveSampler<AdcType>::NtcAdaptiveSampler(
+    NtcThermistor<AdcType> *thermistor,
+    const ntc_adaptive_config_t &config) noexcept
+    : thermistor_(thermistor), config_(config), initialized_(false),
+      next_due_us_(0U), interval_ms_(config.min_interval_ms),
+      sample_count_(config.max_sample_count), urgency_(1.0F),
+      slope_celsius_per_second_(0.0F), last_temperature_celsius_(0.0F),
+      last_read_us_(0U), has_last_read_(false) {}
+
+//--------------------------------------
+//  INITIALIZATION AND CONFIGURATION
+//--------------------------------------
+
+template <typename AdcType>
+bool NtcAdaptiveSampler<AdcType>::Initialize() noexcept {
+  if (thermistor_ == nullptr || !thermistor_->IsInitialized() ||
+      !isValidConfiguration(config_)) {
+    return false;
+  }
+
+  Reset();
+  initialized_ = true;
+  return true;
+}
+
+template <typename AdcType>
+NtcError NtcAdaptiveSampler<AdcType>::SetConfiguration(
+    const ntc_adaptive_config_t &config) noexcept {
+  if (!isValidConfiguration(config)) {
+    return NtcError::InvalidParameter;
+  }
+
+  config_ = config;
+  Reset();
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+NtcError NtcAdaptiveSampler<AdcType>::GetConfiguration(
+    ntc_adaptive_config_t *config) const noexcept {
+  if (config == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  *config = config_;
+  return NtcError::Success;
+}
+
+template <typename AdcType> void NtcAdaptiveSampler<AdcType>::Reset() noexcept {
+  next_due_us_ = 0U;
+  interval_ms_ = config_.min_interval_ms;
+  sample_count_ = config_.max_sample_count;
+  urgency_ = 1.0F;
+  slope_celsius_per_second_ = 0.0F;
+  has_last_read_ = false;
+
+  // The next read must report, or there is nothing to take the slope from
+  if (thermistor_ != nullptr) {
+    thermistor_->ResetChangeReference();
+  }
+}
+
+//--------------------------------------
+//  SCHEDULING
+//--------------------------------------
+
+template <typename AdcType>
+NtcConversionStatus
+NtcAdaptiveSampler<AdcType>::Service(uint64_t now_us,
+                                     ntc_reading_t *reading) noexcept {
+  if (!initialized_ || reading == nullptr || !IsDue(now_us)) {
+    return NtcConversionStatus::Idle;
+  }
+
+  (void)applySampleCount();
+  const NtcConversionStatus status =
+      thermistor_->ReadTemperatureIfChanged(reading);
+
+  if (status == NtcConversionStatus::Unchanged && has_last_read_) {
+    // Within the deadband: flat, and the slope of the next reported reading
+    // is taken from the last reported one
+    slope_celsius_per_second_ = 0.0F;
+    applyUrgency(rateUrgency(last_temperature_celsius_));
+  } else if (status == NtcConversionStatus::Complete && reading->is_valid) {
+    slope_celsius_per_second_ = 0.0F;
+    if (has_last_read_ && now_us > last_read_us_) {
+      slope_celsius_per_second_ =
+          (reading->temperature_celsius - last_temperature_celsius_) /
+          (static_cast<float>(now_us - last_read_us_) /
+           NTC::Constants::MICROSECONDS_PER_SECOND_);
+    }
+    last_temperature_celsius_ = reading->temperature_celsius;
+    last_read_us_ = now_us;
+    has_last_read_ = true;
+    applyUrgency(rateUrgency(reading->temperature_celsius));
+  } else {
+    // Retry soon, and make the retry report so the slope can restart
+    has_last_read_ = false;
+    thermistor_->ResetChangeReference();
+    urgency_ = 1.0F;
+    interval_ms_ = config_.min_interval_ms;
+  }
+
+  next_due_us_ = now_us + (static_cast<uint64_t>(interval_ms_) *
+                           NTC::Constants::MILLISECONDS_PER_SECOND_);
+  return status;
+}
+
+template <typename AdcType>
+bool NtcAdaptiveSampler<AdcType>::IsDue(uint64_t now_us) const noexcept {
+  return now_us >= next_due_us_;
+}
+
+template <typename AdcType>
+uint64_t NtcAdaptiveSampler<AdcType>::NextDueUs() const noexcept {
+  return next_due_us_;
+}
+
+template <typename AdcType>
+uint32_t NtcAdaptiveSampler<AdcType>::GetIntervalMs() const noexcept {
+  return interval_ms_;
+}
+
+template <typename AdcType>
+uint32_t NtcAdaptiveSampler<AdcType>::GetSampleCount() const noexcept {
+  return sample_count_;
+}
+
+template <typename AdcType>
+float NtcAdaptiveSampler<AdcType>::GetUrgency() const noexcept {
+  return urgency_;
+}
+
+template <typename AdcType>
+float NtcAdaptiveSampler<AdcType>::GetSlopeCelsiusPerSecond() const noexcept {
+  return slope_celsius_per_second_;
+}
+
+//--------------------------------------
+//  PRIVATE HELPER METHODS
+//--------------------------------------
+
+template <typename AdcType>
+bool NtcAdaptiveSampler<AdcType>::isValidConfiguration(
+    const ntc_adaptive_config_t &config) noexcept {
+  return config.min_interval_ms > 0U &&
+         config.min_interval_ms <= config.max_interval_ms &&
+         config.min_sample_count > 0U &&
+         config.min_sample_count <= config.max_sample_count &&
+         config.full_rate_slope_celsius_per_second > 0.0F &&
+         std::isfinite(config.full_rate_slope_celsius_per_second) &&
+         config.low_limit_celsius < config.high_limit_celsius &&
+         config.limit_margin_celsius >= 0.0F;
+}
+
+template <typename AdcType>
+float NtcAdaptiveSampler<AdcType>::rateUrgency(
+    float temperature_celsius) const noexcept {
+  float urgency = std::fabs(slope_celsius_per_second_) /
+                  config_.full_rate_slope_celsius_per_second;
+
+  if (config_.limit_margin_celsius > 0.0F) {
+    const float distance_celsius =
+        std::min(config_.high_limit_celsius - temperature_celsius,
+                 temperature_celsius - config_.low_limit_celsius);
+    urgency = std::max(urgency, 1.0F - (distance_celsius /
+                                        config_.limit_margin_celsius));
+  }
+
+  return std::clamp(urgency, 0.0F, 1.0F);
+}
+
+template <typename AdcType>
+void NtcAdaptiveSampler<AdcType>::applyUrgency(float urgency) noexcept {
+  // Geometric between the bounds: each step of urgency shortens the
+  // interval by the same factor
+  const float min_interval = static_cast<float>(config_.min_interval_ms);
+  const float max_interval = static_cast<float>(config_.max_interval_ms);
+  const float interval_ratio = max_interval / min_interval;
+
+  // Escalate at once; relax by at most one interval growth step per read
+  float max_drop = 1.0F;
+  if (interval_ratio > static_cast<float>(MAX_INTERVAL_GROWTH_)) {
+    max_drop = std::log(static_cast<float>(MAX_INTERVAL_GROWTH_)) /
+               std::log(interval_ratio);
+  }
+  urgency_ = std::max(urgency, urgency_ - max_drop);
+
+  interval_ms_ = std::clamp(
+      static_cast<uint32_t>(std::lround(
+          max_interval * std::pow(min_interval / max_interval, urgency_))),
+      config_.min_interval_ms, config_.max_interval_ms);
+
+  sample_count_ =
+      config_.min_sample_count +
+      static_cast<uint32_t>(std::lround(
+          urgency_ * static_cast<float>(config_.max_sample_count -
+                                       config_.min_sample_count)));
+}
+
+template <typename AdcType>
+NtcError NtcAdaptiveSampler<AdcType>::applySampleCount() noexcept {
+  ntc_config_t config = {};
+  NtcError error = thermistor_->GetConfiguration(&config);
+  if (error != NtcError::Success || config.sample_count == sample_count_) {
+    return error;
+  }
+
+  return thermistor_->SetSamplingParameters(sample_count_,
+                                            config.sample_delay_ms);
+}
+
+#endif // NTC_ADAPTIVE_SAMPLER_IMPL
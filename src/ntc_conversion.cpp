@@ -32,10 +32,21 @@ using NTC::Constants::ZERO_FLOAT_;
 
 namespace NTC {
 
-bool ConvertResistanceToTemperatureBeta(float resistance_ohms,
-                                        float resistance_at_25c,
-                                        float beta_value,
-                                        float *temperature_celsius) noexcept {
+namespace {
+
+// Exact and approximate logarithms for the conversion templates
+constexpr auto EXACT_LOG_ = [](float x) noexcept { return std::log(x); };
+constexpr auto FAST_LOG_ = [](float x) noexcept { return FastLog(x); };
+
+/**
+ * @brief Beta conversion with a selectable logarithm
+ * @param log_fn Natural logarithm implementation
+ */
+template <typename LogFn>
+bool resistanceToTemperatureBeta(float resistance_ohms,
+                                 float resistance_at_25c, float beta_value,
+                                 float *temperature_celsius,
+                                 LogFn log_fn) noexcept {
   if (temperature_celsius == nullptr) {
     return false;
   }
@@ -61,7 +72,7 @@ bool ConvertResistanceToTemperatureBeta(float resistance_ohms,
   constexpr float kReferenceTemperatureKelvin =
       NTC::Constants::REFERENCE_TEMPERATURE_C_ + KELVIN_OFFSET_; // 298.15K
   const float temp_reference_kelvin = kReferenceTemperatureKelvin;
-  const float ln_ratio = std::log(resistance_ohms / resistance_at_25c);
+  const float ln_ratio = log_fn(resistance_ohms / resistance_at_25c);
   const float inv_temperature =
       (ONE_FLOAT_ / temp_reference_kelvin) + (ln_ratio / beta_value);
 
@@ -75,6 +86,65 @@ bool ConvertResistanceToTemperatureBeta(float resistance_ohms,
   return true;
 }
 
+/**
+ * @brief Steinhart-Hart conversion with a selectable logarithm
+ * @param log_fn Natural logarithm implementation
+ */
+template <typename LogFn>
+bool resistanceToTemperatureSteinhartHart(float resistance_ohms, float coeff_a,
+                                          float coeff_b, float coeff_c,
+                                          float *temperature_celsius,
+                                          LogFn log_fn) noexcept {
+  if (temperature_celsius == nullptr) {
+    return false;
+  }
+
+  if (!ValidateResistance(resistance_ohms, MIN_RESISTANCE_OHMS_,
+                          MAX_RESISTANCE_OHMS_)) {
+    return false;
+  }
+
+  if (!ValidateSteinhartHartCoefficients(coeff_a, coeff_b, coeff_c)) {
+    return false;
+  }
+
+  // Steinhart-Hart equation: 1/T = A + B*ln(R) + C*ln(R)^3
+  // Where: T = temperature in Kelvin, R = resistance
+
+  const float ln_R = log_fn(resistance_ohms);
+  const float ln_R_cubed = ln_R * ln_R * ln_R;
+  const float inv_temperature =
+      coeff_a + (coeff_b * ln_R) + (coeff_c * ln_R_cubed);
+
+  if (inv_temperature <= ZERO_FLOAT_) {
+    return false; // Invalid result
+  }
+
+  const float temp_kelvin = ONE_FLOAT_ / inv_temperature;
+  *temperature_celsius = temp_kelvin - KELVIN_OFFSET_;
+
+  return true;
+}
+
+} // namespace
+
+bool ConvertResistanceToTemperatureBeta(float resistance_ohms,
+                                        float resistance_at_25c,
+                                        float beta_value,
+                                        float *temperature_celsius) noexcept {
+  return resistanceToTemperatureBeta(resistance_ohms, resistance_at_25c,
+                                     beta_value, temperature_celsius,
+                                     EXACT_LOG_);
+}
+
+bool ConvertResistanceToTemperatureBetaFast(
+    float resistance_ohms, float resistance_at_25c, float beta_value,
+    float *temperature_celsius) noexcept {
+  return resistanceToTemperatureBeta(resistance_ohms, resistance_at_25c,
+                                     beta_value, temperature_celsius,
+                                     FAST_LOG_);
+}
+
 bool ConvertTemperatureToResistanceBeta(float temperature_celsius,
                                         float resistance_at_25c,
                                         float beta_value,
@@ -121,35 +191,17 @@ bool ConvertTemperatureToResistanceBeta(float temperature_celsius,
 bool ConvertResistanceToTemperatureSteinhartHart(
     float resistance_ohms, float coeff_a, float coeff_b, float coeff_c,
     float *temperature_celsius) noexcept {
-  if (temperature_celsius == nullptr) {
-    return false;
-  }
-
-  if (!ValidateResistance(resistance_ohms, MIN_RESISTANCE_OHMS_,
-                          MAX_RESISTANCE_OHMS_)) {
-    return false;
-  }
-
-  if (!ValidateSteinhartHartCoefficients(coeff_a, coeff_b, coeff_c)) {
-    return false;
-  }
-
-  // Steinhart-Hart equation: 1/T = A + B*ln(R) + C*ln(R)^3
-  // Where: T = temperature in Kelvin, R = resistance
-
-  const float ln_R = std::log(resistance_ohms);
-  const float ln_R_cubed = ln_R * ln_R * ln_R;
-  const float inv_temperature =
-      coeff_a + (coeff_b * ln_R) + (coeff_c * ln_R_cubed);
-
-  if (inv_temperature <= ZERO_FLOAT_) {
-    return false; // Invalid result
-  }
-
-  const float temp_kelvin = ONE_FLOAT_ / inv_temperature;
-  *temperature_celsius = temp_kelvin - KELVIN_OFFSET_;
+  return resistanceToTemperatureSteinhartHart(
+      resistance_ohms, coeff_a, coeff_b, coeff_c, temperature_celsius,
+      EXACT_LOG_);
+}
 
-  return true;
+bool ConvertResistanceToTemperatureSteinhartHartFast(
+    float resistance_ohms, float coeff_a, float coeff_b, float coeff_c,
+    float *temperature_celsius) noexcept {
+  return resistanceToTemperatureSteinhartHart(
+      resistance_ohms, coeff_a, coeff_b, coeff_c, temperature_celsius,
+      FAST_LOG_);
 }
 
 bool ConvertTemperatureToResistanceSteinhartHart(
@@ -300,6 +352,187 @@ bool CalculateVoltageDividerRatio(float resistance_ohms,
   return true;
 }
 
+//--------------------------------------
+//  Batch Conversions
+//--------------------------------------
+
+namespace {
+
+/**
+ * @brief Fill an out-of-range mask, eight elements per byte
+ * @param count Number of elements
+ * @param out_of_range_mask Mask to fill (nullable)
+ * @param in_range Predicate taking an element index
+ * @return true if every element is in range
+ */
+template <typename InRange>
+bool buildMask(size_t count, uint8_t *out_of_range_mask,
+               InRange in_range) noexcept {
+  uint8_t any_out_of_range = 0U;
+  for (size_t base = 0; base < count; base += 8U) {
+    const size_t block = std::min<size_t>(8U, count - base);
+    uint8_t bits = 0U;
+    for (size_t j = 0; j < block; ++j) {
+      bits |= static_cast<uint8_t>(
+          static_cast<uint8_t>(!in_range(base + j)) << j);
+    }
+    any_out_of_range |= bits;
+    if (out_of_range_mask != nullptr) {
+      out_of_range_mask[base / 8U] = bits;
+    }
+  }
+  return any_out_of_range == 0U;
+}
+
+/**
+ * @brief Fill an out-of-range mask for a batch of resistances
+ * @return true if every resistance is in range
+ */
+bool buildResistanceMask(const float *resistances_ohms, size_t count,
+                         uint8_t *out_of_range_mask) noexcept {
+  return buildMask(count, out_of_range_mask, [resistances_ohms](size_t i) {
+    // Written so NaN counts as out of range
+    return resistances_ohms[i] >= MIN_RESISTANCE_OHMS_ &&
+           resistances_ohms[i] <= MAX_RESISTANCE_OHMS_;
+  });
+}
+
+/**
+ * @brief Flag every element of a batch as out of range
+ */
+void fillMask(size_t count, uint8_t *out_of_range_mask) noexcept {
+  if (out_of_range_mask == nullptr) {
+    return;
+  }
+  for (size_t base = 0; base < count; base += 8U) {
+    const size_t block = std::min<size_t>(8U, count - base);
+    out_of_range_mask[base / 8U] = static_cast<uint8_t>((1U << block) - 1U);
+  }
+}
+
+} // namespace
+
+bool ConvertResistanceToTemperatureBeta(const float *resistances_ohms,
+                                        float *temperatures_celsius,
+                                        size_t count, float resistance_at_25c,
+                                        float beta_value,
+                                        uint8_t *out_of_range_mask) noexcept {
+  if (resistances_ohms == nullptr || temperatures_celsius == nullptr) {
+    return false;
+  }
+
+  if (!ValidateBetaValue(beta_value) || resistance_at_25c <= ZERO_FLOAT_) {
+    fillMask(count, out_of_range_mask);
+    return false;
+  }
+
+  // Mask first: the conversion below may overwrite the input in place
+  const bool all_in_range =
+      buildResistanceMask(resistances_ohms, count, out_of_range_mask);
+
+  // 1/T = 1/T0 + ln(R/R0)/β, with every per-batch term hoisted
+  const float inv_reference_kelvin =
+      ONE_FLOAT_ / (NTC::Constants::REFERENCE_TEMPERATURE_C_ + KELVIN_OFFSET_);
+  const float inv_beta = ONE_FLOAT_ / beta_value;
+  const float inv_resistance_at_25c = ONE_FLOAT_ / resistance_at_25c;
+
+  for (size_t i = 0; i < count; ++i) {
+    const float resistance = std::min(
+        std::max(resistances_ohms[i], MIN_RESISTANCE_OHMS_),
+        MAX_RESISTANCE_OHMS_);
+    const float inv_kelvin =
+        inv_reference_kelvin +
+        (inv_beta * std::log(resistance * inv_resistance_at_25c));
+    temperatures_celsius[i] = (ONE_FLOAT_ / inv_kelvin) - KELVIN_OFFSET_;
+  }
+
+  return all_in_range;
+}
+
+bool ConvertResistanceToTemperatureSteinhartHart(
+    const float *resistances_ohms, float *temperatures_celsius, size_t count,
+    float coeff_a, float coeff_b, float coeff_c,
+    uint8_t *out_of_range_mask) noexcept {
+  if (resistances_ohms == nullptr || temperatures_celsius == nullptr) {
+    return false;
+  }
+
+  if (!ValidateSteinhartHartCoefficients(coeff_a, coeff_b, coeff_c)) {
+    fillMask(count, out_of_range_mask);
+    return false;
+  }
+
+  // Mask first: the conversion below may overwrite the input in place
+  const bool all_in_range =
+      buildResistanceMask(resistances_ohms, count, out_of_range_mask);
+
+  for (size_t i = 0; i < count; ++i) {
+    const float resistance = std::min(
+        std::max(resistances_ohms[i], MIN_RESISTANCE_OHMS_),
+        MAX_RESISTANCE_OHMS_);
+    const float ln_R = std::log(resistance);
+    const float inv_kelvin =
+        coeff_a + (ln_R * (coeff_b + (coeff_c * ln_R * ln_R)));
+    temperatures_celsius[i] = (ONE_FLOAT_ / inv_kelvin) - KELVIN_OFFSET_;
+  }
+
+  return all_in_range;
+}
+
+bool ConvertAdcCountsToTemperatureBeta(
+    const uint32_t *adc_counts, float *temperatures_celsius, size_t count,
+    uint8_t adc_resolution_bits, float series_resistance,
+    float resistance_at_25c, float beta_value,
+    uint8_t *out_of_range_mask) noexcept {
+  if (adc_counts == nullptr || temperatures_celsius == nullptr) {
+    return false;
+  }
+
+  constexpr uint8_t MAX_ADC_RESOLUTION_BITS_ = 32U;
+  if (adc_resolution_bits == 0U ||
+      adc_resolution_bits > MAX_ADC_RESOLUTION_BITS_ ||
+      series_resistance <= ZERO_FLOAT_ || !ValidateBetaValue(beta_value) ||
+      resistance_at_25c <= ZERO_FLOAT_) {
+    fillMask(count, out_of_range_mask);
+    return false;
+  }
+
+  // R = Rs * c / (FS - c) grows with c, so the valid resistance range maps
+  // to a count window; anything outside it (including the rails) is flagged
+  const float full_scale =
+      static_cast<float>((1ULL << adc_resolution_bits) - 1ULL);
+  const float min_count = std::max(
+      std::ceil(full_scale * MIN_RESISTANCE_OHMS_ /
+                (series_resistance + MIN_RESISTANCE_OHMS_)),
+      ONE_FLOAT_);
+  const float max_count = std::min(
+      std::floor(full_scale * MAX_RESISTANCE_OHMS_ /
+                 (series_resistance + MAX_RESISTANCE_OHMS_)),
+      full_scale - ONE_FLOAT_);
+
+  const bool all_in_range =
+      buildMask(count, out_of_range_mask, [&](size_t i) {
+        const auto adc_count = static_cast<float>(adc_counts[i]);
+        return adc_count >= min_count && adc_count <= max_count;
+      });
+
+  const float inv_reference_kelvin =
+      ONE_FLOAT_ / (NTC::Constants::REFERENCE_TEMPERATURE_C_ + KELVIN_OFFSET_);
+  const float inv_beta = ONE_FLOAT_ / beta_value;
+  const float series_over_r25 = series_resistance / resistance_at_25c;
+
+  for (size_t i = 0; i < count; ++i) {
+    const float adc_count = std::min(
+        std::max(static_cast<float>(adc_counts[i]), min_count), max_count);
+    const float ratio = adc_count / (full_scale - adc_count);
+    const float inv_kelvin =
+        inv_reference_kelvin + (inv_beta * std::log(ratio * series_over_r25));
+    temperatures_celsius[i] = (ONE_FLOAT_ / inv_kelvin) - KELVIN_OFFSET_;
+  }
+
+  return all_in_range;
+}
+
 //--------------------------------------
 //  Validation Functions
 //--------------------------------------
@@ -432,54 +665,33 @@ bool CalculateSteinhartHartCoefficients(
   const float temp2_kelvin = temp2_celsius + KELVIN_OFFSET_;
   const float temp3_kelvin = temp3_celsius + KELVIN_OFFSET_;
 
-  // Calculate natural logarithms of resistances
-  const float ln_R1 = std::log(resistance1_ohms);
-  const float ln_R2 = std::log(resistance2_ohms);
-  const float ln_R3 = std::log(resistance3_ohms);
-
-  // Calculate inverse temperatures
-  const float inv_T1 = ONE_FLOAT_ / temp1_kelvin;
-  const float inv_T2 = ONE_FLOAT_ / temp2_kelvin;
-  const float inv_T3 = ONE_FLOAT_ / temp3_kelvin;
-
-  // Solve the system of equations using Cramer's rule
-  // Matrix: [1 ln_R1 ln_R1^3] [A]   [1/T1]
-  //         [1 ln_R2 ln_R2^3] [B] = [1/T2]
-  //         [1 ln_R3 ln_R3^3] [C]   [1/T3]
-
-  const float det =
-      (ONE_FLOAT_ *
-       (ln_R2 * ln_R3 * ln_R3 * ln_R3 - ln_R3 * ln_R2 * ln_R2 * ln_R2)) +
-      (ln_R1 *
-       (ln_R3 * ln_R2 * ln_R2 * ln_R2 - ln_R2 * ln_R3 * ln_R3 * ln_R3)) +
-      (ln_R1 * ln_R1 * ln_R1 * (ln_R2 - ln_R3));
-
-  if (std::abs(det) < EPSILON_DOUBLE_) {
-    return false; // Singular matrix
-  }
-
-  const float det_a =
-      (inv_T1 *
-       (ln_R2 * ln_R3 * ln_R3 * ln_R3 - ln_R3 * ln_R2 * ln_R2 * ln_R2)) +
-      (inv_T2 *
-       (ln_R3 * ln_R1 * ln_R1 * ln_R1 - ln_R1 * ln_R3 * ln_R3 * ln_R3)) +
-      (inv_T3 *
-       (ln_R1 * ln_R2 * ln_R2 * ln_R2 - ln_R2 * ln_R1 * ln_R1 * ln_R1));
-
-  const float det_b =
-      (ONE_FLOAT_ *
-       (inv_T2 * ln_R3 * ln_R3 * ln_R3 - inv_T3 * ln_R2 * ln_R2 * ln_R2)) +
-      (ln_R1 *
-       (inv_T3 * ln_R1 * ln_R1 * ln_R1 - inv_T1 * ln_R3 * ln_R3 * ln_R3)) +
-      (ln_R1 * ln_R1 * ln_R1 * (inv_T1 - inv_T2));
-
-  const float det_c = (ONE_FLOAT_ * (ln_R2 * inv_T3 - ln_R3 * inv_T2)) +
-                      (ln_R1 * (ln_R3 * inv_T1 - ln_R1 * inv_T3)) +
-                      (ln_R1 * ln_R1 * ln_R1 * (inv_T2 - inv_T1));
-
-  *coeff_a = det_a / det;
-  *coeff_b = det_b / det;
-  *coeff_c = det_c / det;
+  // Solve 1/T = A + B*L + C*L^3 (L = ln R) through the divided differences
+  // of the three points; double precision because the terms nearly cancel
+  const double ln_r1 = std::log(static_cast<double>(resistance1_ohms));
+  const double ln_r2 = std::log(static_cast<double>(resistance2_ohms));
+  const double ln_r3 = std::log(static_cast<double>(resistance3_ohms));
+  const double inv_t1 = 1.0 / static_cast<double>(temp1_kelvin);
+  const double inv_t2 = 1.0 / static_cast<double>(temp2_kelvin);
+  const double inv_t3 = 1.0 / static_cast<double>(temp3_kelvin);
+
+  const double ln_sum = ln_r1 + ln_r2 + ln_r3;
+  if (std::abs(ln_r2 - ln_r1) < EPSILON_DOUBLE_ ||
+      std::abs(ln_r3 - ln_r1) < EPSILON_DOUBLE_ ||
+      std::abs(ln_r3 - ln_r2) < EPSILON_DOUBLE_ ||
+      std::abs(ln_sum) < EPSILON_DOUBLE_) {
+    return false; // Singular system
+  }
+
+  const double gamma2 = (inv_t2 - inv_t1) / (ln_r2 - ln_r1);
+  const double gamma3 = (inv_t3 - inv_t1) / (ln_r3 - ln_r1);
+  const double c = ((gamma3 - gamma2) / (ln_r3 - ln_r2)) / ln_sum;
+  const double b = gamma2 - (c * ((ln_r1 * ln_r1) + (ln_r1 * ln_r2) +
+                                  (ln_r2 * ln_r2)));
+  const double a = inv_t1 - ((b + (c * ln_r1 * ln_r1)) * ln_r1);
+
+  *coeff_a = static_cast<float>(a);
+  *coeff_b = static_cast<float>(b);
+  *coeff_c = static_cast<float>(c);
 
   return ValidateSteinhartHartCoefficients(*coeff_a, *coeff_b, *coeff_c);
 }
@@ -0,0 +1,203 @@
+/**
+ * @file ntc_history.cpp
+ * @brief Temperature history implementation.
+ *
+ * This file contains the implementation of the NtcHistory class that keeps
+ * windowed statistics of recent readings up to date incrementally.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ *
+ * @note This file is included by ntc_history.hpp for template instantiation.
+ *       It should not be compiled separately when included.
+ */
+
+#ifndef NTC_HISTORY_IMPL
+#define NTC_HISTORY_IMPL
+
+// When included from header, use relative path; when compiled directly, use
+// standard include
+#ifdef NTC_HISTORY_HEADER_INCLUDED
+#include "../inc/ntc_history.hpp"
+#else
+#include "ntc_history.hpp"
+#endif
+
+#include <functional>
+
+//--------------------------------------
+//  CONSTRUCTORS
+//--------------------------------------
+
+template <size_t Capacity>
+NtcHistory<Capacity>::NtcHistory() noexcept
+    : temperatures_(), timestamps_(), next_(0U), count_(0U), sum_(0.0),
+      weighted_sum_(0.0), min_slots_(), max_slots_() {}
+
+//--------------------------------------
+//  RECORDING
+//--------------------------------------
+
+template <size_t Capacity>
+void NtcHistory<Capacity>::Push(float temperature_celsius,
+                                uint64_t timestamp_us) noexcept {
+  const size_t slot = next_;
+
+  // Evict the oldest reading; every remaining x moves down by one
+  if (count_ == Capacity) {
+    sum_ -= static_cast<double>(temperatures_[slot]);
+    weighted_sum_ -= sum_;
+    count_--;
+    expireSlot(&min_slots_, slot);
+    expireSlot(&max_slots_, slot);
+  }
+
+  temperatures_[slot] = temperature_celsius;
+  timestamps_[slot] = timestamp_us;
+  sum_ += static_cast<double>(temperature_celsius);
+  weighted_sum_ +=
+      static_cast<double>(count_) * static_cast<double>(temperature_celsius);
+  count_++;
+
+  appendSlot<std::less<float>>(&min_slots_, slot);
+  appendSlot<std::greater<float>>(&max_slots_, slot);
+
+  next_ = (slot + 1U) % Capacity;
+  if (next_ == 0U) {
+    resyncSums();
+  }
+}
+
+template <size_t Capacity> void NtcHistory<Capacity>::Clear() noexcept {
+  next_ = 0U;
+  count_ = 0U;
+  sum_ = 0.0;
+  weighted_sum_ = 0.0;
+  min_slots_.size = 0U;
+  max_slots_.size = 0U;
+}
+
+//--------------------------------------
+//  ACCESS
+//--------------------------------------
+
+template <size_t Capacity>
+size_t NtcHistory<Capacity>::Size() const noexcept {
+  return count_;
+}
+
+template <size_t Capacity>
+bool NtcHistory<Capacity>::IsFull() const noexcept {
+  return count_ == Capacity;
+}
+
+template <size_t Capacity>
+NtcError NtcHistory<Capacity>::GetReading(size_t age,
+                                          float *temperature_celsius,
+                                          uint64_t *timestamp_us) const
+    noexcept {
+  if (temperature_celsius == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (age >= count_) {
+    return NtcError::InvalidParameter;
+  }
+
+  const size_t slot = slotOfAge(age);
+  *temperature_celsius = temperatures_[slot];
+  if (timestamp_us != nullptr) {
+    *timestamp_us = timestamps_[slot];
+  }
+  return NtcError::Success;
+}
+
+template <size_t Capacity>
+NtcError
+NtcHistory<Capacity>::GetStats(ntc_history_stats_t *stats) const noexcept {
+  if (stats == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (count_ == 0U) {
+    return NtcError::NotInitialized;
+  }
+
+  const auto n = static_cast<double>(count_);
+  stats->count = static_cast<uint32_t>(count_);
+  stats->min_celsius = temperatures_[min_slots_.slots[min_slots_.front]];
+  stats->max_celsius = temperatures_[max_slots_.slots[max_slots_.front]];
+  stats->mean_celsius = static_cast<float>(sum_ / n);
+  stats->slope_celsius_per_sample = 0.0F;
+  stats->rate_celsius_per_second = 0.0F;
+
+  if (count_ < 2U) {
+    return NtcError::Success;
+  }
+
+  // Least-squares slope over x = 0..n-1:
+  // (n * Sxy - Sx * Sy) / (n * Sxx - Sx^2), denominator n^2 (n^2 - 1) / 12
+  const double sum_x = n * (n - 1.0) / 2.0;
+  const double slope = ((n * weighted_sum_) - (sum_x * sum_)) /
+                       ((n * n) * ((n * n) - 1.0) / 12.0);
+  stats->slope_celsius_per_sample = static_cast<float>(slope);
+
+  // Scale by the mean reading interval when readings carry timestamps
+  constexpr double MICROSECONDS_PER_SECOND_ = 1e6;
+  const uint64_t newest_us = timestamps_[slotOfAge(0U)];
+  const uint64_t oldest_us = timestamps_[slotOfAge(count_ - 1U)];
+  if (newest_us > oldest_us) {
+    const double interval_s = static_cast<double>(newest_us - oldest_us) /
+                              MICROSECONDS_PER_SECOND_ / (n - 1.0);
+    stats->rate_celsius_per_second = static_cast<float>(slope / interval_s);
+  }
+
+  return NtcError::Success;
+}
+
+//--------------------------------------
+//  PRIVATE HELPER METHODS
+//--------------------------------------
+
+template <size_t Capacity>
+size_t NtcHistory<Capacity>::slotOfAge(size_t age) const noexcept {
+  return (next_ + Capacity - 1U - age) % Capacity;
+}
+
+template <size_t Capacity> void NtcHistory<Capacity>::resyncSums() noexcept {
+  sum_ = 0.0;
+  weighted_sum_ = 0.0;
+  for (size_t x = 0; x < count_; ++x) {
+    const auto temperature =
+        static_cast<double>(temperatures_[slotOfAge(count_ - 1U - x)]);
+    sum_ += temperature;
+    weighted_sum_ += static_cast<double>(x) * temperature;
+  }
+}
+
+template <size_t Capacity>
+void NtcHistory<Capacity>::expireSlot(SlotDeque *deque, size_t slot) noexcept {
+  if (deque->size > 0U && deque->slots[deque->front] == slot) {
+    deque->front = (deque->front + 1U) % Capacity;
+    deque->size--;
+  }
+}
+
+template <size_t Capacity>
+template <typename Keep>
+void NtcHistory<Capacity>::appendSlot(SlotDeque *deque, size_t slot) noexcept {
+  const float temperature = temperatures_[slot];
+  while (deque->size > 0U) {
+    const size_t back = (deque->front + deque->size - 1U) % Capacity;
+    if (Keep()(temperatures_[deque->slots[back]], temperature)) {
+      break;
+    }
+    deque->size--;
+  }
+  deque->slots[(deque->front + deque->size) % Capacity] =
+      static_cast<uint16_t>(slot);
+  deque->size++;
+}
+
+#endif // NTC_HISTORY_IMPL
@@ -12,281 +12,379 @@
  */
 
 #include "ntc_lookup_table.hpp"
+#include "ntc_table_generator.hpp"
 #include "ntc_types.hpp"
 #include <algorithm>
 #include <array>
 #include <cmath>
 
-using NTC::ntc_lookup_entry_t;
-using NTC::ntc_lookup_table_t;
+namespace NTC {
 
 //--------------------------------------
-//  NTCG163JFT103FT1S Lookup Table
+//  Shared Curves
 //--------------------------------------
 
-// Pre-calculated temperature-resistance pairs for NTCG163JFT103FT1S (10kΩ @
-// 25°C, β=3435K) Temperature range: -40°C to +125°C, step: 1°C
-static constexpr std::array<ntc_lookup_entry_t, 166> NTCG163JFT103FT1S_TABLE = {
-    {// -40°C to -30°C
-     {336.7F, -40.0F},
-     {312.1F, -39.0F},
-     {289.2F, -38.0F},
-     {267.9F, -37.0F},
-     {248.1F, -36.0F},
-     {229.8F, -35.0F},
-     {212.8F, -34.0F},
-     {197.1F, -33.0F},
-     {182.6F, -32.0F},
-     {169.2F, -31.0F},
-     {156.8F, -30.0F},
-
-     // -29°C to -20°C
-     {145.4F, -29.0F},
-     {134.9F, -28.0F},
-     {125.2F, -27.0F},
-     {116.2F, -26.0F},
-     {107.9F, -25.0F},
-     {100.2F, -24.0F},
-     {93.1F, -23.0F},
-     {86.5F, -22.0F},
-     {80.4F, -21.0F},
-     {74.8F, -20.0F},
-
-     // -19°C to -10°C
-     {69.6F, -19.0F},
-     {64.8F, -18.0F},
-     {60.4F, -17.0F},
-     {56.3F, -16.0F},
-     {52.6F, -15.0F},
-     {49.1F, -14.0F},
-     {45.9F, -13.0F},
-     {43.0F, -12.0F},
-     {40.3F, -11.0F},
-     {37.8F, -10.0F},
-
-     // -9°C to 0°C
-     {35.5F, -9.0F},
-     {33.4F, -8.0F},
-     {31.4F, -7.0F},
-     {29.6F, -6.0F},
-     {27.9F, -5.0F},
-     {26.3F, -4.0F},
-     {24.8F, -3.0F},
-     {23.4F, -2.0F},
-     {22.1F, -1.0F},
-     {20.9F, 0.0F},
-
-     // 1°C to 10°C
-     {19.8F, 1.0F},
-     {18.7F, 2.0F},
-     {17.7F, 3.0F},
-     {16.8F, 4.0F},
-     {15.9F, 5.0F},
-     {15.1F, 6.0F},
-     {14.3F, 7.0F},
-     {13.6F, 8.0F},
-     {12.9F, 9.0F},
-     {12.3F, 10.0F},
-
-     // 11°C to 20°C
-     {11.7F, 11.0F},
-     {11.1F, 12.0F},
-     {10.6F, 13.0F},
-     {10.1F, 14.0F},
-     {9.6F, 15.0F},
-     {9.2F, 16.0F},
-     {8.8F, 17.0F},
-     {8.4F, 18.0F},
-     {8.0F, 19.0F},
-     {7.7F, 20.0F},
-
-     // 21°C to 30°C
-     {7.4F, 21.0F},
-     {7.1F, 22.0F},
-     {6.8F, 23.0F},
-     {6.5F, 24.0F},
-     {6.3F, 25.0F},
-     {6.0F, 26.0F},
-     {5.8F, 27.0F},
-     {5.6F, 28.0F},
-     {5.4F, 29.0F},
-     {5.2F, 30.0F},
-
-     // 31°C to 40°C
-     {5.0F, 31.0F},
-     {4.8F, 32.0F},
-     {4.6F, 33.0F},
-     {4.4F, 34.0F},
-     {4.3F, 35.0F},
-     {4.1F, 36.0F},
-     {4.0F, 37.0F},
-     {3.8F, 38.0F},
-     {3.7F, 39.0F},
-     {3.6F, 40.0F},
-
-     // 41°C to 50°C
-     {3.4F, 41.0F},
-     {3.3F, 42.0F},
-     {3.2F, 43.0F},
-     {3.1F, 44.0F},
-     {3.0F, 45.0F},
-     {2.9F, 46.0F},
-     {2.8F, 47.0F},
-     {2.7F, 48.0F},
-     {2.6F, 49.0F},
-     {2.5F, 50.0F},
-
-     // 51°C to 60°C
-     {2.4F, 51.0F},
-     {2.3F, 52.0F},
-     {2.2F, 53.0F},
-     {2.1F, 54.0F},
-     {2.0F, 55.0F},
-     {1.9F, 56.0F},
-     {1.8F, 57.0F},
-     {1.7F, 58.0F},
-     {1.6F, 59.0F},
-     {1.5F, 60.0F},
-
-     // 61°C to 70°C
-     {1.4F, 61.0F},
-     {1.3F, 62.0F},
-     {1.2F, 63.0F},
-     {1.1F, 64.0F},
-     {1.0F, 65.0F},
-     {0.9F, 66.0F},
-     {0.8F, 67.0F},
-     {0.7F, 68.0F},
-     {0.6F, 69.0F},
-     {0.5F, 70.0F},
-
-     // 71°C to 80°C
-     {0.4F, 71.0F},
-     {0.3F, 72.0F},
-     {0.2F, 73.0F},
-     {0.1F, 74.0F},
-     {0.0F, 75.0F},
-     {-0.1F, 76.0F},
-     {-0.2F, 77.0F},
-     {-0.3F, 78.0F},
-     {-0.4F, 79.0F},
-     {-0.5F, 80.0F},
-
-     // 81°C to 90°C
-     {-0.6F, 81.0F},
-     {-0.7F, 82.0F},
-     {-0.8F, 83.0F},
-     {-0.9F, 84.0F},
-     {-1.0F, 85.0F},
-     {-1.1F, 86.0F},
-     {-1.2F, 87.0F},
-     {-1.3F, 88.0F},
-     {-1.4F, 89.0F},
-     {-1.5F, 90.0F},
-
-     // 91°C to 100°C
-     {-1.6F, 91.0F},
-     {-1.7F, 92.0F},
-     {-1.8F, 93.0F},
-     {-1.9F, 94.0F},
-     {-2.0F, 95.0F},
-     {-2.1F, 96.0F},
-     {-2.2F, 97.0F},
-     {-2.3F, 98.0F},
-     {-2.4F, 99.0F},
-     {-2.5F, 100.0F},
-
-     // 101°C to 110°C
-     {-2.6F, 101.0F},
-     {-2.7F, 102.0F},
-     {-2.8F, 103.0F},
-     {-2.9F, 104.0F},
-     {-3.0F, 105.0F},
-     {-3.1F, 106.0F},
-     {-3.2F, 107.0F},
-     {-3.3F, 108.0F},
-     {-3.4F, 109.0F},
-     {-3.5F, 110.0F},
-
-     // 111°C to 120°C
-     {-3.6F, 111.0F},
-     {-3.7F, 112.0F},
-     {-3.8F, 113.0F},
-     {-3.9F, 114.0F},
-     {-4.0F, 115.0F},
-     {-4.1F, 116.0F},
-     {-4.2F, 117.0F},
-     {-4.3F, 118.0F},
-     {-4.4F, 119.0F},
-     {-4.5F, 120.0F},
-
-     // 121°C to 125°C
-     {-4.6F, 121.0F},
-     {-4.7F, 122.0F},
-     {-4.8F, 123.0F},
-     {-4.9F, 124.0F},
-     {-5.0F, 125.0F}}};
-
-static const ntc_lookup_table_t NTCG163JFT103FT1S_LOOKUP_TABLE = {
-    .entries = NTCG163JFT103FT1S_TABLE.data(),
-    .entry_count = NTCG163JFT103FT1S_TABLE.size(),
-    .min_resistance = 0.0F, // Will be calculated
-    .max_resistance = 336.7F,
-    .min_temperature = -40.0F,
-    .max_temperature = 125.0F,
-    .resistance_step = 1.0F};
+// One curve per distinct resistance characteristic; part types map onto
+// these in NTC_PART_TABLES, so parts sharing a curve share its storage.
+// Generated at compile time, -40°C to +125°C, 32 entries per resistance
+// octave (uniform resistance key spacing, O(1) lookup), resistances in ohms
+
+#if NTC_COMPACT_LOOKUP_TABLES
+// 10kΩ @ 25°C, β=3435K, uint16_t temperature codes
+static constexpr const ntc_lookup_table_t *NTC_10K_3435_CURVE =
+    MakeNtcCompactTable<10000U, 3435U, -40, 125, 32U>();
+#else
+// 10kΩ @ 25°C, β=3435K
+static constexpr const ntc_lookup_table_t *NTC_10K_3435_CURVE =
+    MakeNtcLogTable<10000U, 3435U, -40, 125, 32U>();
+#endif
 
 //--------------------------------------
-//  NTCG164JF103FT1S Lookup Table (same as NTCG163JFT103FT1S)
+//  Part Registry
 //--------------------------------------
 
-static const ntc_lookup_table_t NTCG164JF103FT1S_LOOKUP_TABLE = {
-    .entries = NTCG163JFT103FT1S_TABLE.data(), // Same table
-    .entry_count = NTCG163JFT103FT1S_TABLE.size(),
-    .min_resistance = 0.0F, // Will be calculated
-    .max_resistance = 336.7F,
-    .min_temperature = -40.0F,
-    .max_temperature = 125.0F,
-    .resistance_step = 1.0F};
+/**
+ * @brief Part type to curve mapping
+ */
+struct ntc_part_table_t {
+  NtcType type;                    ///< Part type
+  const ntc_lookup_table_t *table; ///< Shared curve
+};
+
+// Adding a part with an existing curve costs one entry here, not a table
+static constexpr std::array<ntc_part_table_t, 3> NTC_PART_TABLES = {{
+    {NtcType::NtcG163Jft103Ft1S, NTC_10K_3435_CURVE},
+    {NtcType::NtcG164Jf103Ft1S, NTC_10K_3435_CURVE},
+    {NtcType::NtcG163Jf103Ft1S, NTC_10K_3435_CURVE},
+}};
 
 //--------------------------------------
-//  NTCG163JF103FT1S Lookup Table (same as NTCG163JFT103FT1S)
+//  Entry Decoding
 //--------------------------------------
 
-static const ntc_lookup_table_t NTCG163JF103FT1S_LOOKUP_TABLE = {
-    .entries = NTCG163JFT103FT1S_TABLE.data(), // Same table
-    .entry_count = NTCG163JFT103FT1S_TABLE.size(),
-    .min_resistance = 0.0F, // Will be calculated
-    .max_resistance = 336.7F,
-    .min_temperature = -40.0F,
-    .max_temperature = 125.0F,
-    .resistance_step = 1.0F};
+namespace {
+
+/**
+ * @brief Check that a table has regular or compact entry storage
+ * @param table Lookup table
+ * @return true if entries can be read
+ */
+bool hasEntries(const ntc_lookup_table_t *table) noexcept {
+  return table->entries != nullptr || (table->temperature_codes != nullptr &&
+                                       table->resistance_step > 0.0F);
+}
+
+/**
+ * @brief Get the temperature of an entry
+ * @param table Lookup table (regular or compact)
+ * @param index Entry index
+ * @return Entry temperature (°C)
+ */
+float temperatureAt(const ntc_lookup_table_t *table, size_t index) noexcept {
+  if (table->entries != nullptr) {
+    return table->entries[index].temperature_celsius;
+  }
+  return table->min_temperature +
+         (static_cast<float>(table->temperature_codes[index]) *
+          table->temperature_code_step);
+}
+
+/**
+ * @brief Get an entry of a table
+ * @param table Lookup table (regular or compact)
+ * @param index Entry index
+ * @return Entry (decoded for compact tables)
+ */
+ntc_lookup_entry_t entryAt(const ntc_lookup_table_t *table,
+                           size_t index) noexcept {
+  if (table->entries != nullptr) {
+    return table->entries[index];
+  }
+  const uint32_t key =
+      ResistanceKey(table->max_resistance) -
+      (static_cast<uint32_t>(index) *
+       static_cast<uint32_t>(table->resistance_step));
+  return {ResistanceFromKey(key), temperatureAt(table, index)};
+}
+
+//--------------------------------------
+//  Runtime Registration and Building
+//--------------------------------------
+
+/**
+ * @brief Runtime registered table
+ */
+struct ntc_registered_table_t {
+  int type;                        ///< NTC type value
+  const ntc_lookup_table_t *table; ///< Caller-owned table (nullptr: free)
+};
+
+/// Tables registered with RegisterNtcLookupTable()
+std::array<ntc_registered_table_t, MAX_REGISTERED_LOOKUP_TABLES_>
+    registered_tables = {};
+
+/**
+ * @brief Resistance key grid of a uniformly keyed table
+ */
+struct ntc_key_grid_t {
+  uint32_t first_key; ///< Key of entry 0 (largest resistance)
+  uint32_t key_step;  ///< Key spacing between entries
+  size_t entry_count; ///< Number of entries
+};
+
+/**
+ * @brief Compute the key grid covering a resistance range
+ * @param min_resistance Lowest resistance (ohms)
+ * @param max_resistance Highest resistance (ohms)
+ * @param segments_per_octave Entries per resistance octave (power of two)
+ * @param outward true to round the range outward, false to round inward
+ * @param grid Pointer to store the grid
+ * @return true if the grid holds at least two entries
+ */
+bool makeKeyGrid(float min_resistance, float max_resistance,
+                 uint32_t segments_per_octave, bool outward,
+                 ntc_key_grid_t *grid) noexcept {
+  constexpr uint32_t KEYS_PER_OCTAVE_ = 1UL << 23U;
+  if (segments_per_octave == 0U || segments_per_octave > KEYS_PER_OCTAVE_ ||
+      (segments_per_octave & (segments_per_octave - 1U)) != 0U ||
+      !(min_resistance > 0.0F) || !(max_resistance > min_resistance) ||
+      !std::isfinite(max_resistance)) {
+    return false;
+  }
+
+  const uint32_t step = KEYS_PER_OCTAVE_ / segments_per_octave;
+  const uint32_t max_key = ResistanceKey(max_resistance);
+  const uint32_t min_key = ResistanceKey(min_resistance);
+  const uint32_t first_key =
+      outward ? ((max_key / step) + ((max_key % step) != 0U ? 1U : 0U)) * step
+              : (max_key / step) * step;
+  const uint32_t last_key =
+      outward ? (min_key / step) * step
+              : ((min_key / step) + ((min_key % step) != 0U ? 1U : 0U)) * step;
+  if (first_key <= last_key) {
+    return false;
+  }
+
+  grid->first_key = first_key;
+  grid->key_step = step;
+  grid->entry_count = static_cast<size_t>((first_key - last_key) / step) + 1U;
+  return true;
+}
+
+/**
+ * @brief Fill the descriptor of a uniformly keyed table and validate it
+ * @param entries Filled entries
+ * @param grid Key grid of the entries
+ * @param table Pointer to store the descriptor
+ * @return true if the entries form a valid table
+ */
+bool describeKeyedTable(const ntc_lookup_entry_t *entries,
+                        const ntc_key_grid_t &grid,
+                        ntc_lookup_table_t *table) noexcept {
+  const size_t last = grid.entry_count - 1U;
+  const ntc_lookup_table_t built = {
+      .entries = entries,
+      .entry_count = grid.entry_count,
+      .min_resistance = entries[last].resistance_ohms,
+      .max_resistance = entries[0].resistance_ohms,
+      .min_temperature = entries[0].temperature_celsius,
+      .max_temperature = entries[last].temperature_celsius,
+      .resistance_step = static_cast<float>(grid.key_step),
+      .inverse_resistance_step = 1.0F / static_cast<float>(grid.key_step),
+      .inverse_temperature_step = 0.0F, // Temperature spacing is not uniform
+      .temperature_codes = nullptr,
+      .temperature_code_step = 0.0F,
+      .temperature_index = nullptr, // Runtime tables are bisected
+      .temperature_index_count = 0U,
+      .inverse_index_step = 0.0F};
+  if (!ValidateLookupTable(&built)) {
+    return false;
+  }
+  *table = built;
+  return true;
+}
+
+} // namespace
 
 //--------------------------------------
 //  Lookup Table Functions
 //--------------------------------------
 
 const ntc_lookup_table_t *GetNtcLookupTable(int ntc_type) noexcept {
-  switch (ntc_type) {
-  case static_cast<int>(NtcType::NtcG163Jft103Ft1S):
-    return &NTCG163JFT103FT1S_LOOKUP_TABLE;
-  case static_cast<int>(NtcType::NtcG164Jf103Ft1S):
-    return &NTCG164JF103FT1S_LOOKUP_TABLE;
-  case static_cast<int>(NtcType::NtcG163Jf103Ft1S):
-    return &NTCG163JF103FT1S_LOOKUP_TABLE;
-  default:
-    return nullptr;
+  for (const ntc_registered_table_t &registered : registered_tables) {
+    if (registered.table != nullptr && registered.type == ntc_type) {
+      return registered.table;
+    }
+  }
+  for (const ntc_part_table_t &part : NTC_PART_TABLES) {
+    if (static_cast<int>(part.type) == ntc_type) {
+      return part.table;
+    }
+  }
+  return nullptr;
+}
+
+bool RegisterNtcLookupTable(int ntc_type,
+                            const ntc_lookup_table_t *table) noexcept {
+  if (table != nullptr && !ValidateLookupTable(table)) {
+    return false;
+  }
+
+  // Replace or remove an existing registration for this type
+  ntc_registered_table_t *free_slot = nullptr;
+  for (ntc_registered_table_t &registered : registered_tables) {
+    if (registered.table != nullptr && registered.type == ntc_type) {
+      registered.table = table;
+      return true;
+    }
+    if (registered.table == nullptr && free_slot == nullptr) {
+      free_slot = &registered;
+    }
+  }
+
+  if (table == nullptr) {
+    return true; // Nothing registered
+  }
+  if (free_slot == nullptr) {
+    return false;
+  }
+  free_slot->type = ntc_type;
+  free_slot->table = table;
+  return true;
+}
+
+size_t LookupTableEntryCount(float min_resistance, float max_resistance,
+                             uint32_t segments_per_octave) noexcept {
+  ntc_key_grid_t grid = {};
+  if (!makeKeyGrid(min_resistance, max_resistance, segments_per_octave, true,
+                   &grid)) {
+    return 0U;
   }
+  return grid.entry_count;
+}
+
+bool BuildLookupTableSteinhartHart(float coeff_a, float coeff_b, float coeff_c,
+                                   float min_temperature, float max_temperature,
+                                   uint32_t segments_per_octave,
+                                   ntc_lookup_entry_t *entries, size_t capacity,
+                                   ntc_lookup_table_t *table) noexcept {
+  if (entries == nullptr || table == nullptr ||
+      !(max_temperature > min_temperature)) {
+    return false;
+  }
+
+  // Resistance range of the temperature range (NTC: R falls as T rises)
+  float min_resistance = 0.0F;
+  float max_resistance = 0.0F;
+  ntc_key_grid_t grid = {};
+  if (!ConvertTemperatureToResistanceSteinhartHart(
+          min_temperature, coeff_a, coeff_b, coeff_c, &max_resistance) ||
+      !ConvertTemperatureToResistanceSteinhartHart(
+          max_temperature, coeff_a, coeff_b, coeff_c, &min_resistance) ||
+      !makeKeyGrid(min_resistance, max_resistance, segments_per_octave, true,
+                   &grid) ||
+      grid.entry_count > capacity) {
+    return false;
+  }
+
+  for (size_t i = 0; i < grid.entry_count; ++i) {
+    const float resistance = ResistanceFromKey(
+        grid.first_key - (static_cast<uint32_t>(i) * grid.key_step));
+    entries[i].resistance_ohms = resistance;
+    if (!ConvertResistanceToTemperatureSteinhartHart(
+            resistance, coeff_a, coeff_b, coeff_c,
+            &entries[i].temperature_celsius)) {
+      return false;
+    }
+  }
+
+  return describeKeyedTable(entries, grid, table);
+}
+
+bool BuildLookupTableFromPoints(const ntc_lookup_entry_t *points,
+                                size_t point_count,
+                                uint32_t segments_per_octave,
+                                ntc_lookup_entry_t *entries, size_t capacity,
+                                ntc_lookup_table_t *table) noexcept {
+  if (entries == nullptr || table == nullptr) {
+    return false;
+  }
+
+  // Same ordering rules as a lookup table
+  const ntc_lookup_table_t measured = {.entries = points,
+                                       .entry_count = point_count,
+                                       .min_resistance = 0.0F,
+                                       .max_resistance = 0.0F,
+                                       .min_temperature = 0.0F,
+                                       .max_temperature = 0.0F,
+                                       .resistance_step = 0.0F,
+                                       .inverse_resistance_step = 0.0F,
+                                       .inverse_temperature_step = 0.0F,
+                                       .temperature_codes = nullptr,
+                                       .temperature_code_step = 0.0F,
+                                       .temperature_index = nullptr,
+                                       .temperature_index_count = 0U,
+                                       .inverse_index_step = 0.0F};
+  if (!ValidateLookupTable(&measured) ||
+      !(points[point_count - 1U].resistance_ohms > 0.0F)) {
+    return false;
+  }
+
+  ntc_key_grid_t grid = {};
+  if (!makeKeyGrid(points[point_count - 1U].resistance_ohms,
+                   points[0].resistance_ohms, segments_per_octave, false,
+                   &grid) ||
+      grid.entry_count > capacity) {
+    return false;
+  }
+
+  // Nodes descend in resistance, so the bracketing segment only moves forward
+  constexpr double KELVIN_OFFSET_ =
+      static_cast<double>(Constants::KELVIN_OFFSET_);
+  size_t segment = 0;
+  for (size_t i = 0; i < grid.entry_count; ++i) {
+    const float resistance = ResistanceFromKey(
+        grid.first_key - (static_cast<uint32_t>(i) * grid.key_step));
+    while (segment + 2U < point_count &&
+           points[segment + 1U].resistance_ohms > resistance) {
+      segment++;
+    }
+
+    const ntc_lookup_entry_t &upper = points[segment];
+    const ntc_lookup_entry_t &lower = points[segment + 1U];
+    const double log_upper =
+        std::log(static_cast<double>(upper.resistance_ohms));
+    const double log_lower =
+        std::log(static_cast<double>(lower.resistance_ohms));
+    const double inverse_upper =
+        1.0 / (static_cast<double>(upper.temperature_celsius) + KELVIN_OFFSET_);
+    const double inverse_lower =
+        1.0 / (static_cast<double>(lower.temperature_celsius) + KELVIN_OFFSET_);
+    const double ratio =
+        (std::log(static_cast<double>(resistance)) - log_upper) /
+        (log_lower - log_upper);
+
+    entries[i].resistance_ohms = resistance;
+    entries[i].temperature_celsius = static_cast<float>(
+        (1.0 / (inverse_upper + (ratio * (inverse_lower - inverse_upper)))) -
+        KELVIN_OFFSET_);
+  }
+
+  return describeKeyedTable(entries, grid, table);
 }
 
 bool FindTemperatureFromLookupTable(const ntc_lookup_table_t *table,
                                     float resistance_ohms,
                                     float *temperature_celsius) noexcept {
-  if (table == nullptr || temperature_celsius == nullptr) {
-    return false;
-  }
+  // O(n) per call: builds a ValidatedLookupTable every time
+  return FindTemperatureFromLookupTable(ValidatedLookupTable(table),
+                                        resistance_ohms, temperature_celsius);
+}
 
-  if (!ValidateLookupTable(table)) {
+bool FindTemperatureFromLookupTable(const ValidatedLookupTable &table,
+                                    float resistance_ohms,
+                                    float *temperature_celsius) noexcept {
+  if (!table.IsValid() || temperature_celsius == nullptr) {
     return false;
   }
 
@@ -296,17 +394,31 @@ bool FindTemperatureFromLookupTable(const ntc_lookup_table_t *table,
     return false;
   }
 
+  // Uniformly spaced tables: bucket from the resistance key, no search
+  if (table->inverse_resistance_step > 0.0F) {
+    size_t index = 0;
+    float fraction = 0.0F;
+    if (!UniformIndexLookupTable(table.Get(), resistance_ohms, &index,
+                                 &fraction)) {
+      return false;
+    }
+    const float temp_lower = temperatureAt(table.Get(), index);
+    const float temp_upper = temperatureAt(table.Get(), index + 1);
+    *temperature_celsius = temp_lower + (fraction * (temp_upper - temp_lower));
+    return true;
+  }
+
   // Find the two closest entries
   size_t lower_index = 0;
   size_t upper_index = 0;
-  if (!BinarySearchLookupTable(table, resistance_ohms, &lower_index,
+  if (!BinarySearchLookupTable(table.Get(), resistance_ohms, &lower_index,
                                &upper_index)) {
     return false;
   }
 
   // Interpolate between the two entries
-  const ntc_lookup_entry_t &entry1 = table->entries[lower_index];
-  const ntc_lookup_entry_t &entry2 = table->entries[upper_index];
+  const ntc_lookup_entry_t entry1 = entryAt(table.Get(), lower_index);
+  const ntc_lookup_entry_t entry2 = entryAt(table.Get(), upper_index);
 
   return InterpolateLookupEntries(entry1, entry2, resistance_ohms,
                                   temperature_celsius);
@@ -315,11 +427,15 @@ bool FindTemperatureFromLookupTable(const ntc_lookup_table_t *table,
 bool FindResistanceFromLookupTable(const ntc_lookup_table_t *table,
                                    float temperature_celsius,
                                    float *resistance_ohms) noexcept {
-  if (table == nullptr || resistance_ohms == nullptr) {
-    return false;
-  }
+  // O(n) per call: builds a ValidatedLookupTable every time
+  return FindResistanceFromLookupTable(ValidatedLookupTable(table),
+                                       temperature_celsius, resistance_ohms);
+}
 
-  if (!ValidateLookupTable(table)) {
+bool FindResistanceFromLookupTable(const ValidatedLookupTable &table,
+                                   float temperature_celsius,
+                                   float *resistance_ohms) noexcept {
+  if (!table.IsValid() || resistance_ohms == nullptr) {
     return false;
   }
 
@@ -329,36 +445,57 @@ bool FindResistanceFromLookupTable(const ntc_lookup_table_t *table,
     return false;
   }
 
-  // Find the two closest entries by temperature
+  // Uniformly stepped tables: bucket from the temperature, no search
+  const size_t last_segment = table->entry_count - 2;
   size_t lower_index = 0;
-  size_t upper_index = 0;
-  bool found = false;
-
-  for (size_t i = 0; i < table->entry_count - 1; i++) {
-    if (table->entries[i].temperature_celsius <= temperature_celsius &&
-        table->entries[i + 1].temperature_celsius >= temperature_celsius) {
-      lower_index = i;
-      upper_index = i + 1;
-      found = true;
-      break;
+  float ratio = 0.0F;
+  if (table->inverse_temperature_step > 0.0F) {
+    const float position =
+        (temperature_celsius - temperatureAt(table.Get(), 0)) *
+        table->inverse_temperature_step;
+    lower_index = std::min(static_cast<size_t>(std::max(position, 0.0F)),
+                           last_segment);
+    ratio = position - static_cast<float>(lower_index);
+  } else if (table->temperature_index != nullptr) {
+    // Reverse index: start at the bucket's entry, step over the few entries
+    // inside the bucket
+    const float first = temperatureAt(table.Get(), 0);
+    const float position =
+        (temperature_celsius - first) * table->inverse_index_step;
+    const size_t bucket =
+        std::min(static_cast<size_t>(std::max(position, 0.0F)),
+                 table->temperature_index_count - 1U);
+    lower_index = table->temperature_index[bucket];
+    while (lower_index < last_segment &&
+           temperatureAt(table.Get(), lower_index + 1) <=
+               temperature_celsius) {
+      lower_index++;
     }
-  }
-
-  if (!found) {
-    return false;
+    const float temp_lower = temperatureAt(table.Get(), lower_index);
+    ratio = (temperature_celsius - temp_lower) /
+            (temperatureAt(table.Get(), lower_index + 1) - temp_lower);
+  } else {
+    // Bisect while entries[left] <= temperature < entries[right]
+    size_t left = 0;
+    size_t right = table->entry_count - 1;
+    while (right - left > 1) {
+      const size_t mid = left + ((right - left) / 2);
+      if (temperatureAt(table.Get(), mid) <= temperature_celsius) {
+        left = mid;
+      } else {
+        right = mid;
+      }
+    }
+    lower_index = left;
+    const float temp_left = temperatureAt(table.Get(), left);
+    ratio = (temperature_celsius - temp_left) /
+            (temperatureAt(table.Get(), right) - temp_left);
   }
 
   // Interpolate between the two entries
-  const ntc_lookup_entry_t &entry1 = table->entries[lower_index];
-  const ntc_lookup_entry_t &entry2 = table->entries[upper_index];
+  const ntc_lookup_entry_t entry1 = entryAt(table.Get(), lower_index);
+  const ntc_lookup_entry_t entry2 = entryAt(table.Get(), lower_index + 1);
 
-  float temp_diff = entry2.temperature_celsius - entry1.temperature_celsius;
-  if (std::abs(temp_diff) < 1e-6F) {
-    *resistance_ohms = entry1.resistance_ohms;
-    return true;
-  }
-
-  float ratio = (temperature_celsius - entry1.temperature_celsius) / temp_diff;
   *resistance_ohms =
       entry1.resistance_ohms +
       (ratio * (entry2.resistance_ohms - entry1.resistance_ohms));
@@ -395,68 +532,83 @@ bool BinarySearchLookupTable(const ntc_lookup_table_t *table,
     return false;
   }
 
-  if (table->entry_count < 2) {
+  if (table->entry_count < 2 || !hasEntries(table)) {
     return false;
   }
 
-  size_t left = 0;
-  size_t right = table->entry_count - 1;
-
-  // Binary search for the closest resistance value
-  while (left <= right) {
-    size_t mid = left + ((right - left) / 2);
-    float mid_resistance = table->entries[mid].resistance_ohms;
-
-    if (std::abs(mid_resistance - resistance_ohms) < 1e-6F) {
-      // Exact match
-      *lower_index = mid;
-      *upper_index = mid;
-      return true;
-    }
+  // Entries are sorted by descending resistance (ascending temperature)
+  const size_t last = table->entry_count - 1;
+  if (resistance_ohms >= entryAt(table, 0).resistance_ohms) {
+    *lower_index = 0;
+    *upper_index = 1;
+    return true;
+  }
+  if (resistance_ohms <= entryAt(table, last).resistance_ohms) {
+    *lower_index = last - 1;
+    *upper_index = last;
+    return true;
+  }
 
-    if (mid_resistance < resistance_ohms) {
-      left = mid + 1;
+  // Bisect while entries[left] > resistance > entries[right]
+  size_t left = 0;
+  size_t right = last;
+  while (right - left > 1) {
+    const size_t mid = left + ((right - left) / 2);
+    if (entryAt(table, mid).resistance_ohms > resistance_ohms) {
+      left = mid;
     } else {
-      right = mid - 1;
+      right = mid;
     }
   }
 
-  // Find the two closest entries
-  if (right >= table->entry_count - 1) {
-    *lower_index = table->entry_count - 2;
-    *upper_index = table->entry_count - 1;
-  } else if (left == 0) {
-    *lower_index = 0;
-    *upper_index = 1;
-  } else {
-    *lower_index = right;
-    *upper_index = left;
-  }
-
+  *lower_index = left;
+  *upper_index = right;
   return true;
 }
 
-bool ValidateLookupTable(const ntc_lookup_table_t *table) noexcept {
-  if (table == nullptr) {
+bool UniformIndexLookupTable(const ntc_lookup_table_t *table,
+                             float resistance_ohms, size_t *lower_index,
+                             float *fraction) noexcept {
+  if (table == nullptr || lower_index == nullptr || fraction == nullptr) {
     return false;
   }
 
-  if (table->entries == nullptr) {
+  if (table->entry_count < 2 || !(table->inverse_resistance_step > 0.0F) ||
+      !(resistance_ohms > 0.0F) || !hasEntries(table)) {
     return false;
   }
 
-  if (table->entry_count < 2) {
+  // Keys descend with the entries; offset counts key units from entry 0
+  const uint32_t first_key = ResistanceKey(entryAt(table, 0).resistance_ohms);
+  const uint32_t key = ResistanceKey(resistance_ohms);
+  if (key > first_key) {
     return false;
   }
 
-  // Check that entries are sorted by resistance (descending for NTC)
-  for (size_t i = 1; i < table->entry_count; i++) {
-    if (table->entries[i].resistance_ohms >=
-        table->entries[i - 1].resistance_ohms) {
+  const float position =
+      static_cast<float>(first_key - key) * table->inverse_resistance_step;
+  const size_t last_segment = table->entry_count - 2;
+  auto index = static_cast<size_t>(position);
+  if (index > last_segment) {
+    if (position > static_cast<float>(last_segment + 1)) {
       return false;
     }
+    index = last_segment; // Exactly on the last entry
   }
 
+  *lower_index = index;
+  *fraction = position - static_cast<float>(index);
+  return true;
+}
+
+bool GetLookupTableEntry(const ntc_lookup_table_t *table, size_t index,
+                         ntc_lookup_entry_t *entry) noexcept {
+  if (table == nullptr || entry == nullptr || !hasEntries(table) ||
+      index >= table->entry_count) {
+    return false;
+  }
+
+  *entry = entryAt(table, index);
   return true;
 }
 
@@ -489,13 +641,15 @@ void GetLookupTableStats(const ntc_lookup_table_t *table, float *min_resistance,
 //--------------------------------------
 
 const ntc_lookup_table_t *GetNtcG163Jft103Ft1sLookupTable() noexcept {
-  return &NTCG163JFT103FT1S_LOOKUP_TABLE;
+  return NTC_10K_3435_CURVE;
 }
 
 const ntc_lookup_table_t *GetNtcG164Jf103Ft1sLookupTable() noexcept {
-  return &NTCG164JF103FT1S_LOOKUP_TABLE;
+  return NTC_10K_3435_CURVE;
 }
 
 const ntc_lookup_table_t *GetNtcG163Jf103Ft1sLookupTable() noexcept {
-  return &NTCG163JF103FT1S_LOOKUP_TABLE;
-}
\ No newline at end of file
+  return NTC_10K_3435_CURVE;
+}
+
+} // namespace NTC
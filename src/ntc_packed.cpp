@@ -0,0 +1,238 @@
+/**
+ * @file ntc_packed.cpp
+ * @brief Compact wire/log format for NTC readings.
+ *
+ * This file contains the packed reading encoder and decoder. Fields are
+ * written byte by byte, so the format is independent of host endianness and
+ * alignment.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ */
+
+#include "ntc_packed.hpp"
+#include "ntc_conversion.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+
+using NTC::Constants::CELSIUS_TO_FAHRENHEIT_MULTIPLIER_;
+using NTC::Constants::FAHRENHEIT_OFFSET_;
+using NTC::Constants::KELVIN_OFFSET_;
+using NTC::Packed::CENTI_DEGREES_PER_DEGREE_;
+using NTC::Packed::FIXED_BYTES_;
+using NTC::Packed::MAX_RECORD_BYTES_;
+using NTC::Packed::MAX_VARINT_BYTES_;
+
+namespace {
+
+constexpr uint8_t VARINT_CONTINUATION_ = 0x80U; ///< More varint bytes follow
+constexpr uint8_t VARINT_PAYLOAD_MASK_ = 0x7FU; ///< Payload bits of a byte
+constexpr uint32_t VARINT_PAYLOAD_BITS_ = 7U;   ///< Payload bits per byte
+constexpr uint32_t BITS_PER_BYTE_ = 8U;         ///< Bits per byte
+
+/**
+ * @brief Map a signed delta to unsigned so small magnitudes stay short
+ */
+uint64_t zigzagEncode(int64_t value) noexcept {
+  return (static_cast<uint64_t>(value) << 1U) ^
+         static_cast<uint64_t>(value >> 63U);
+}
+
+/**
+ * @brief Inverse of zigzagEncode()
+ */
+int64_t zigzagDecode(uint64_t value) noexcept {
+  return static_cast<int64_t>(value >> 1U) ^ -static_cast<int64_t>(value & 1U);
+}
+
+/**
+ * @brief Write a LEB128 varint
+ * @return Bytes written
+ */
+size_t writeVarint(uint64_t value, uint8_t *out) noexcept {
+  size_t length = 0;
+  while (value > VARINT_PAYLOAD_MASK_) {
+    out[length++] = static_cast<uint8_t>(value & VARINT_PAYLOAD_MASK_) |
+                    VARINT_CONTINUATION_;
+    value >>= VARINT_PAYLOAD_BITS_;
+  }
+  out[length++] = static_cast<uint8_t>(value);
+  return length;
+}
+
+/**
+ * @brief Read a LEB128 varint
+ * @return Bytes read (0 if truncated or longer than 10 bytes)
+ */
+size_t readVarint(const uint8_t *in, size_t available,
+                  uint64_t *value) noexcept {
+  uint64_t result = 0;
+  for (size_t i = 0; i < available && i < MAX_VARINT_BYTES_; ++i) {
+    result |= static_cast<uint64_t>(in[i] & VARINT_PAYLOAD_MASK_)
+              << (VARINT_PAYLOAD_BITS_ * i);
+    if ((in[i] & VARINT_CONTINUATION_) == 0U) {
+      *value = result;
+      return i + 1U;
+    }
+  }
+  return 0U;
+}
+
+void writeUint16(uint16_t value, uint8_t *out) noexcept {
+  out[0] = static_cast<uint8_t>(value);
+  out[1] = static_cast<uint8_t>(value >> BITS_PER_BYTE_);
+}
+
+uint16_t readUint16(const uint8_t *in) noexcept {
+  return static_cast<uint16_t>(in[0] | (in[1] << BITS_PER_BYTE_));
+}
+
+/**
+ * @brief Convert to saturated centi-degrees (non-finite values pack as 0)
+ */
+int16_t toCentiDegrees(float temperature_celsius) noexcept {
+  if (!std::isfinite(temperature_celsius)) {
+    return 0;
+  }
+
+  const float centi = temperature_celsius * CENTI_DEGREES_PER_DEGREE_;
+  if (centi >= static_cast<float>(INT16_MAX)) {
+    return INT16_MAX;
+  }
+  if (centi <= static_cast<float>(INT16_MIN)) {
+    return INT16_MIN;
+  }
+  return static_cast<int16_t>(std::lround(centi));
+}
+
+} // namespace
+
+//--------------------------------------
+//  NtcPackedEncoder
+//--------------------------------------
+
+NtcPackedEncoder::NtcPackedEncoder(uint8_t *buffer, size_t capacity) noexcept
+    : buffer_(buffer), capacity_(buffer == nullptr ? 0U : capacity), size_(0U),
+      records_(0U), last_timestamp_us_(0U) {}
+
+NtcError NtcPackedEncoder::Append(uint8_t channel,
+                                  const ntc_reading_t &reading) noexcept {
+  return Append(channel, reading.temperature_celsius, reading.adc_raw_value,
+                reading.timestamp_us, reading.error);
+}
+
+NtcError NtcPackedEncoder::Append(uint8_t channel, float temperature_celsius,
+                                  uint32_t adc_raw_value,
+                                  uint64_t timestamp_us,
+                                  NtcError error) noexcept {
+  if (buffer_ == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  // Build the record first so a full buffer is left untouched
+  std::array<uint8_t, MAX_RECORD_BYTES_> record = {};
+  record[0] = channel;
+  writeUint16(static_cast<uint16_t>(toCentiDegrees(temperature_celsius)),
+              &record[1]);
+  writeUint16(static_cast<uint16_t>(
+                  adc_raw_value > UINT16_MAX ? UINT16_MAX : adc_raw_value),
+              &record[3]);
+  record[5] = static_cast<uint8_t>(error);
+  const auto delta = static_cast<int64_t>(timestamp_us - last_timestamp_us_);
+  const size_t length =
+      FIXED_BYTES_ + writeVarint(zigzagEncode(delta), &record[FIXED_BYTES_]);
+
+  if (length > capacity_ - size_) {
+    return NtcError::OutOfMemory;
+  }
+
+  std::memcpy(buffer_ + size_, record.data(), length);
+  size_ += length;
+  records_++;
+  last_timestamp_us_ = timestamp_us;
+  return NtcError::Success;
+}
+
+void NtcPackedEncoder::Reset() noexcept {
+  size_ = 0U;
+  records_ = 0U;
+  last_timestamp_us_ = 0U;
+}
+
+const uint8_t *NtcPackedEncoder::Data() const noexcept { return buffer_; }
+
+size_t NtcPackedEncoder::Size() const noexcept { return size_; }
+
+size_t NtcPackedEncoder::Records() const noexcept { return records_; }
+
+//--------------------------------------
+//  NtcPackedDecoder
+//--------------------------------------
+
+NtcPackedDecoder::NtcPackedDecoder(const uint8_t *data, size_t size,
+                                   const ntc_config_t *config) noexcept
+    : data_(data), size_(data == nullptr ? 0U : size), position_(0U),
+      last_timestamp_us_(0U), config_(config) {}
+
+bool NtcPackedDecoder::HasNext() const noexcept { return position_ < size_; }
+
+NtcError NtcPackedDecoder::Next(uint8_t *channel,
+                                ntc_reading_t *reading) noexcept {
+  if (channel == nullptr || reading == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (!HasNext()) {
+    return NtcError::InvalidParameter;
+  }
+
+  const uint8_t *record = data_ + position_;
+  const size_t available = size_ - position_;
+  uint64_t zigzag_delta = 0;
+  const size_t varint_length =
+      available > FIXED_BYTES_
+          ? readVarint(record + FIXED_BYTES_, available - FIXED_BYTES_,
+                       &zigzag_delta)
+          : 0U;
+  if (varint_length == 0U ||
+      record[5] >= static_cast<uint8_t>(NtcError::Max)) {
+    position_ = size_; // Nothing after a corrupt record can be trusted
+    return NtcError::Failure;
+  }
+  position_ += FIXED_BYTES_ + varint_length;
+
+  const float temperature_celsius =
+      static_cast<float>(static_cast<int16_t>(readUint16(&record[1]))) /
+      CENTI_DEGREES_PER_DEGREE_;
+  last_timestamp_us_ += static_cast<uint64_t>(zigzagDecode(zigzag_delta));
+
+  *channel = record[0];
+  *reading = {};
+  reading->temperature_celsius = temperature_celsius;
+  reading->temperature_fahrenheit =
+      (temperature_celsius * CELSIUS_TO_FAHRENHEIT_MULTIPLIER_) +
+      FAHRENHEIT_OFFSET_;
+  reading->temperature_kelvin = temperature_celsius + KELVIN_OFFSET_;
+  reading->adc_raw_value = readUint16(&record[3]);
+  reading->timestamp_us = last_timestamp_us_;
+  reading->error = static_cast<NtcError>(record[5]);
+  reading->is_valid = reading->error == NtcError::Success;
+
+  // Voltage and resistance follow from the count and the divider
+  constexpr uint32_t MAX_ADC_RESOLUTION_BITS_ = 32U;
+  if (config_ != nullptr && config_->adc_resolution_bits > 0U &&
+      config_->adc_resolution_bits <= MAX_ADC_RESOLUTION_BITS_) {
+    const float full_scale = static_cast<float>(
+        (1ULL << config_->adc_resolution_bits) - 1ULL);
+    reading->voltage_volts = static_cast<float>(reading->adc_raw_value) *
+                             config_->reference_voltage / full_scale;
+    (void)NTC::CalculateThermistorResistance(
+        reading->voltage_volts, config_->reference_voltage,
+        config_->series_resistance, &reading->resistance_ohms);
+  }
+
+  return NtcError::Success;
+}
@@ -0,0 +1,395 @@
+/**
+ * @file ntc_scan_scheduler.cpp
+ * @brief Scan scheduler implementation.
+ *
+ * This file contains the implementation of the NtcScanScheduler class that
+ * releases thermistors periodically and orders their conversions on each ADC
+ * unit by priority and deadline.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ *
+ * @note This file is included by ntc_scan_scheduler.hpp for template
+ *       instantiation. It should not be compiled separately when included.
+ */
+
+#ifndef NTC_SCAN_SCHEDULER_IMPL
+#define NTC_SCAN_SCHEDULER_IMPL
+
+// When included from header, use relative path; when compiled directly, use
+// standard include
+#ifdef NTC_SCAN_SCHEDULER_HEADER_INCLUDED
+#include "../inc/ntc_scan_scheduler.hpp"
+#else
+#include "ntc_scan_scheduler.hpp"
+#endif
+
+#include <algorithm>
+#include <limits>
+
+//--------------------------------------
+//  CONSTRUCTORS
+//--------------------------------------
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+NtcScanScheduler<AdcType, Capacity, UnitCount>::NtcScanScheduler() noexcept
+    : sensors_{}, sensor_count_(0U), unit_sensor_{}, started_(false) {
+  unit_sensor_.fill(NO_SENSOR_);
+}
+
+//--------------------------------------
+//  SENSORS
+//--------------------------------------
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+NtcError NtcScanScheduler<AdcType, Capacity, UnitCount>::AddSensor(
+    NtcThermistor<AdcType> *thermistor, const ntc_scan_sensor_config_t &config,
+    size_t *index) noexcept {
+  if (thermistor == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (!thermistor->IsInitialized()) {
+    return NtcError::NotInitialized;
+  }
+
+  if (started_) {
+    return NtcError::Busy;
+  }
+
+  if (sensor_count_ >= Capacity) {
+    return NtcError::OutOfMemory;
+  }
+
+  if (config.period_us == 0U || config.adc_unit >= UnitCount) {
+    return NtcError::InvalidParameter;
+  }
+
+  // One thermistor runs one conversion at a time
+  for (size_t i = 0; i < sensor_count_; ++i) {
+    if (sensors_[i].thermistor == thermistor) {
+      return NtcError::InvalidParameter;
+    }
+  }
+
+  sensors_[sensor_count_] = {};
+  sensors_[sensor_count_].thermistor = thermistor;
+  sensors_[sensor_count_].config = config;
+  if (index != nullptr) {
+    *index = sensor_count_;
+  }
+  sensor_count_++;
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+size_t NtcScanScheduler<AdcType, Capacity, UnitCount>::GetSensorCount()
+    const noexcept {
+  return sensor_count_;
+}
+
+//--------------------------------------
+//  SCHEDULING
+//--------------------------------------
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+void NtcScanScheduler<AdcType, Capacity, UnitCount>::Start(
+    uint64_t now_us) noexcept {
+  Stop();
+
+  for (size_t i = 0; i < sensor_count_; ++i) {
+    sensors_[i].next_release_us = now_us + sensors_[i].config.phase_us;
+  }
+  started_ = true;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+void NtcScanScheduler<AdcType, Capacity, UnitCount>::Stop() noexcept {
+  for (size_t i = 0; i < sensor_count_; ++i) {
+    if (sensors_[i].active) {
+      sensors_[i].thermistor->CancelConversion();
+    }
+    sensors_[i].pending = false;
+    sensors_[i].active = false;
+  }
+  unit_sensor_.fill(NO_SENSOR_);
+  started_ = false;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+bool NtcScanScheduler<AdcType, Capacity, UnitCount>::IsStarted()
+    const noexcept {
+  return started_;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+uint32_t NtcScanScheduler<AdcType, Capacity, UnitCount>::Service(
+    uint64_t now_us) noexcept {
+  if (!started_) {
+    return 0U;
+  }
+
+  uint32_t completed = 0U;
+
+  // Finish running conversions first: a sensor that completes now is not
+  // overrun by a release at the same instant, and its unit is free again
+  for (size_t unit = 0; unit < UnitCount; ++unit) {
+    if (unit_sensor_[unit] != NO_SENSOR_ &&
+        pollSensor(unit_sensor_[unit], now_us)) {
+      completed++;
+    }
+  }
+
+  releaseDue(now_us);
+
+  for (size_t unit = 0; unit < UnitCount; ++unit) {
+    if (unit_sensor_[unit] != NO_SENSOR_) {
+      continue;
+    }
+
+    const uint16_t index = selectPending(unit);
+    if (index != NO_SENSOR_ && startSensor(index, now_us) &&
+        pollSensor(index, now_us)) {
+      completed++;
+    }
+  }
+
+  return completed;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+uint64_t
+NtcScanScheduler<AdcType, Capacity, UnitCount>::NextDueUs() const noexcept {
+  uint64_t due_us = std::numeric_limits<uint64_t>::max();
+  if (!started_) {
+    return due_us;
+  }
+
+  for (size_t i = 0; i < sensor_count_; ++i) {
+    const sensor_state_t &sensor = sensors_[i];
+    if (sensor.active) {
+      due_us = std::min(due_us, sensor.thermistor->NextSampleDueUs());
+    } else if (sensor.pending) {
+      // Waiting behind a running conversion is covered by that conversion
+      if (unit_sensor_[sensor.config.adc_unit] == NO_SENSOR_) {
+        due_us = std::min(due_us, sensor.release_us);
+      }
+    } else {
+      due_us = std::min(due_us, sensor.next_release_us);
+    }
+  }
+
+  return due_us;
+}
+
+//--------------------------------------
+//  READINGS AND STATISTICS
+//--------------------------------------
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+NtcError NtcScanScheduler<AdcType, Capacity, UnitCount>::GetReading(
+    size_t index, ntc_reading_t *reading) const noexcept {
+  if (reading == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (index >= sensor_count_) {
+    return NtcError::InvalidParameter;
+  }
+
+  if (!sensors_[index].has_reading) {
+    return NtcError::NotInitialized;
+  }
+
+  *reading = sensors_[index].reading;
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+NtcError NtcScanScheduler<AdcType, Capacity, UnitCount>::GetStats(
+    size_t index, ntc_scan_stats_t *stats) const noexcept {
+  if (stats == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (index >= sensor_count_) {
+    return NtcError::InvalidParameter;
+  }
+
+  *stats = sensors_[index].stats;
+  finishStats(sensors_[index].jitter_sum_us, sensors_[index].starts, stats);
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+NtcError NtcScanScheduler<AdcType, Capacity, UnitCount>::GetTotalStats(
+    ntc_scan_stats_t *stats) const noexcept {
+  if (stats == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  ntc_scan_stats_t total = {};
+  uint64_t jitter_sum_us = 0U;
+  uint32_t starts = 0U;
+  for (size_t i = 0; i < sensor_count_; ++i) {
+    const ntc_scan_stats_t &sensor = sensors_[i].stats;
+    total.releases += sensor.releases;
+    total.completed += sensor.completed;
+    total.overruns += sensor.overruns;
+    total.deadline_misses += sensor.deadline_misses;
+    total.errors += sensor.errors;
+    total.max_jitter_us = std::max(total.max_jitter_us, sensor.max_jitter_us);
+    total.max_response_us =
+        std::max(total.max_response_us, sensor.max_response_us);
+    jitter_sum_us += sensors_[i].jitter_sum_us;
+    starts += sensors_[i].starts;
+  }
+
+  finishStats(jitter_sum_us, starts, &total);
+  *stats = total;
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+void NtcScanScheduler<AdcType, Capacity, UnitCount>::ResetStats() noexcept {
+  for (size_t i = 0; i < sensor_count_; ++i) {
+    sensors_[i].stats = {};
+    sensors_[i].jitter_sum_us = 0U;
+    sensors_[i].starts = 0U;
+  }
+}
+
+//--------------------------------------
+//  PRIVATE HELPER METHODS
+//--------------------------------------
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+void NtcScanScheduler<AdcType, Capacity, UnitCount>::releaseDue(
+    uint64_t now_us) noexcept {
+  for (size_t i = 0; i < sensor_count_; ++i) {
+    sensor_state_t &sensor = sensors_[i];
+    if (now_us < sensor.next_release_us) {
+      continue;
+    }
+
+    // Catch up in one step after a late Service(); only the latest release
+    // can still be served
+    const uint64_t period_us = sensor.config.period_us;
+    const uint64_t releases =
+        ((now_us - sensor.next_release_us) / period_us) + 1U;
+    const uint64_t latest_us =
+        sensor.next_release_us + ((releases - 1U) * period_us);
+    sensor.next_release_us = latest_us + period_us;
+    sensor.stats.releases += static_cast<uint32_t>(releases);
+
+    if (sensor.pending || sensor.active) {
+      sensor.stats.overruns += static_cast<uint32_t>(releases);
+      continue;
+    }
+
+    sensor.stats.overruns += static_cast<uint32_t>(releases - 1U);
+    sensor.release_us = latest_us;
+    sensor.pending = true;
+  }
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+uint16_t NtcScanScheduler<AdcType, Capacity, UnitCount>::selectPending(
+    size_t unit) const noexcept {
+  uint16_t best = NO_SENSOR_;
+  for (size_t i = 0; i < sensor_count_; ++i) {
+    const sensor_state_t &sensor = sensors_[i];
+    if (!sensor.pending || sensor.config.adc_unit != unit) {
+      continue;
+    }
+
+    if (best == NO_SENSOR_ ||
+        sensor.config.priority > sensors_[best].config.priority ||
+        (sensor.config.priority == sensors_[best].config.priority &&
+         deadlineUs(sensor) < deadlineUs(sensors_[best]))) {
+      best = static_cast<uint16_t>(i);
+    }
+  }
+
+  return best;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+bool NtcScanScheduler<AdcType, Capacity, UnitCount>::startSensor(
+    uint16_t index, uint64_t now_us) noexcept {
+  sensor_state_t &sensor = sensors_[index];
+  sensor.pending = false;
+
+  const auto jitter_us = static_cast<uint32_t>(
+      std::min<uint64_t>(now_us - sensor.release_us, UINT32_MAX));
+  sensor.stats.max_jitter_us = std::max(sensor.stats.max_jitter_us, jitter_us);
+  sensor.jitter_sum_us += jitter_us;
+  sensor.starts++;
+
+  if (sensor.thermistor->StartConversion(now_us) != NtcError::Success) {
+    sensor.stats.errors++;
+    return false;
+  }
+
+  sensor.active = true;
+  unit_sensor_[sensor.config.adc_unit] = index;
+  return true;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+bool NtcScanScheduler<AdcType, Capacity, UnitCount>::pollSensor(
+    uint16_t index, uint64_t now_us) noexcept {
+  sensor_state_t &sensor = sensors_[index];
+
+  // Unchanged leaves the previous reading in place
+  const NtcConversionStatus status =
+      sensor.thermistor->Poll(now_us, &sensor.reading);
+  if (status == NtcConversionStatus::InProgress) {
+    return false;
+  }
+
+  sensor.active = false;
+  unit_sensor_[sensor.config.adc_unit] = NO_SENSOR_;
+
+  if (status == NtcConversionStatus::Idle) {
+    // Cancelled behind the scheduler's back (e.g. a configuration change)
+    sensor.stats.errors++;
+    return false;
+  }
+
+  if (status == NtcConversionStatus::Complete) {
+    sensor.has_reading = true;
+    if (sensor.reading.error != NtcError::Success) {
+      sensor.stats.errors++;
+    }
+  }
+
+  const auto response_us = static_cast<uint32_t>(
+      std::min<uint64_t>(now_us - sensor.release_us, UINT32_MAX));
+  sensor.stats.completed++;
+  sensor.stats.max_response_us =
+      std::max(sensor.stats.max_response_us, response_us);
+  if (now_us > deadlineUs(sensor)) {
+    sensor.stats.deadline_misses++;
+  }
+  return true;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+uint64_t NtcScanScheduler<AdcType, Capacity, UnitCount>::deadlineUs(
+    const sensor_state_t &sensor) noexcept {
+  const uint32_t deadline_us = (sensor.config.deadline_us != 0U)
+                                   ? sensor.config.deadline_us
+                                   : sensor.config.period_us;
+  return sensor.release_us + deadline_us;
+}
+
+template <typename AdcType, size_t Capacity, size_t UnitCount>
+void NtcScanScheduler<AdcType, Capacity, UnitCount>::finishStats(
+    uint64_t jitter_sum_us, uint32_t starts, ntc_scan_stats_t *stats) noexcept {
+  stats->mean_jitter_us =
+      (starts > 0U) ? static_cast<uint32_t>(jitter_sum_us / starts) : 0U;
+}
+
+#endif // NTC_SCAN_SCHEDULER_IMPL
@@ -0,0 +1,101 @@
+/**
+ * @file ntc_snapshot.cpp
+ * @brief Latest-value snapshot implementation.
+ *
+ * This file contains the implementation of the NtcSnapshot sequence lock.
+ * The value is stored as relaxed atomic words so concurrent copies are
+ * well-defined; the fences order them against the sequence counter.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ *
+ * @note This file is included by ntc_snapshot.hpp for template instantiation.
+ *       It should not be compiled separately when included.
+ */
+
+#ifndef NTC_SNAPSHOT_IMPL
+#define NTC_SNAPSHOT_IMPL
+
+// When included from header, use relative path; when compiled directly, use
+// standard include
+#ifdef NTC_SNAPSHOT_HEADER_INCLUDED
+#include "../inc/ntc_snapshot.hpp"
+#else
+#include "ntc_snapshot.hpp"
+#endif
+
+#include <cstring>
+
+//--------------------------------------
+//  CONSTRUCTORS
+//--------------------------------------
+
+template <typename T> NtcSnapshot<T>::NtcSnapshot() noexcept : sequence_(0U) {
+  for (auto &word : words_) {
+    word.store(0U, std::memory_order_relaxed);
+  }
+}
+
+//--------------------------------------
+//  PUBLISHING
+//--------------------------------------
+
+template <typename T> void NtcSnapshot<T>::Publish(const T &value) noexcept {
+  std::array<uint32_t, WORD_COUNT_> buffer = {};
+  std::memcpy(buffer.data(), &value, sizeof(T));
+
+  const uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+  sequence_.store(sequence + 1U, std::memory_order_relaxed);
+  // Readers that see any new word also see the odd sequence
+  std::atomic_thread_fence(std::memory_order_release);
+  for (size_t i = 0; i < WORD_COUNT_; ++i) {
+    words_[i].store(buffer[i], std::memory_order_relaxed);
+  }
+  // 0 means "never published", so the counter skips it when it wraps
+  const uint32_t published = (sequence + 2U == 0U) ? 2U : sequence + 2U;
+  sequence_.store(published, std::memory_order_release);
+}
+
+//--------------------------------------
+//  READING
+//--------------------------------------
+
+template <typename T>
+NtcError NtcSnapshot<T>::Read(T *value, uint32_t *sequence) const noexcept {
+  if (value == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  std::array<uint32_t, WORD_COUNT_> buffer = {};
+  for (uint32_t attempt = 0; attempt < MAX_READ_ATTEMPTS_; ++attempt) {
+    const uint32_t before = sequence_.load(std::memory_order_acquire);
+    if (before == 0U) {
+      return NtcError::NotInitialized;
+    }
+    if ((before & 1U) != 0U) {
+      continue; // Publish in progress
+    }
+
+    for (size_t i = 0; i < WORD_COUNT_; ++i) {
+      buffer[i] = words_[i].load(std::memory_order_relaxed);
+    }
+    // Orders the word loads before the sequence re-check
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence_.load(std::memory_order_relaxed) == before) {
+      std::memcpy(value, buffer.data(), sizeof(T));
+      if (sequence != nullptr) {
+        *sequence = before / 2U;
+      }
+      return NtcError::Success;
+    }
+  }
+
+  return NtcError::Busy;
+}
+
+template <typename T> uint32_t NtcSnapshot<T>::Sequence() const noexcept {
+  return sequence_.load(std::memory_order_acquire) / 2U;
+}
+
+#endif // NTC_SNAPSHOT_IMPL
@@ -21,9 +21,11 @@
 // standard include
 #ifdef NTC_THERMISTOR_HEADER_INCLUDED
 #include "../inc/ntc_thermistor.hpp"
+#include "../inc/ntc_acquisition.hpp"
 #include "../inc/ntc_conversion.hpp"
 #include "../inc/ntc_lookup_table.hpp"
 #else
+#include "ntc_acquisition.hpp"
 #include "ntc_conversion.hpp"
 #include "ntc_lookup_table.hpp"
 #include "ntc_thermistor.hpp"
@@ -32,11 +34,13 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <type_traits>
 
 using NTC::Constants::CELSIUS_TO_FAHRENHEIT_MULTIPLIER_;
 using NTC::Constants::FAHRENHEIT_OFFSET_;
 using NTC::Constants::FAHRENHEIT_TO_CELSIUS_MULTIPLIER_;
 using NTC::Constants::KELVIN_OFFSET_;
+using NTC::Constants::MICROSECONDS_PER_SECOND_;
 using NTC::Constants::MILLISECONDS_PER_SECOND_;
 using NTC::Constants::ONE_FLOAT_;
 using NTC::Constants::ZERO_FLOAT_;
@@ -49,17 +53,52 @@ template <typename AdcType>
 NtcThermistor<AdcType>::NtcThermistor(NtcType ntc_type,
                                       AdcType *adc_interface) noexcept
     : config_(), adc_interface_(adc_interface), initialized_(false),
-      filtered_temperature_(ZERO_FLOAT_), filter_initialized_(false) {
+      filtered_temperature_(ZERO_FLOAT_), filter_initialized_(false),
+      filter_lead_(ZERO_FLOAT_), filter_variance_(ZERO_FLOAT_),
+      filter_timestamp_us_(0U),
+      attached_lookup_table_(), lookup_table_(), context_(),
+      active_method_(NtcConversionMethod::Mathematical),
+      conversion_report_{NtcConversionMethod::Mathematical, ZERO_FLOAT_,
+                         NTC::ConversionCost::BETA_},
+      conversion_error_measured_(true), conversion_pending_(false),
+      last_adc_conversions_(0U), adc_count_table_(), adc_count_table_shift_(0U),
+      adc_count_table_valid_(false), async_active_(false),
+      async_samples_taken_(0U), async_count_sum_(0U), async_counts_(),
+      async_next_sample_us_(0U), async_first_sample_us_(0U),
+      async_last_error_(ntc::AdcError::Success), async_sample_(),
+      async_acquisition_cycles_(0U), history_(nullptr), history_push_(nullptr),
+      snapshot_(nullptr), reported_count_(0U), reported_valid_(false) {
 
   // Initialize configuration for NTC type
   initializeConfigForType(ntc_type, &config_);
+  updateLookupTable();
+  updateConversionContext();
+  (void)ResetStats();
 }
 
 template <typename AdcType>
 NtcThermistor<AdcType>::NtcThermistor(const ntc_config_t &config,
                                       AdcType *adc_interface) noexcept
     : config_(config), adc_interface_(adc_interface), initialized_(false),
-      filtered_temperature_(ZERO_FLOAT_), filter_initialized_(false) {}
+      filtered_temperature_(ZERO_FLOAT_), filter_initialized_(false),
+      filter_lead_(ZERO_FLOAT_), filter_variance_(ZERO_FLOAT_),
+      filter_timestamp_us_(0U),
+      attached_lookup_table_(), lookup_table_(), context_(),
+      active_method_(NtcConversionMethod::Mathematical),
+      conversion_report_{NtcConversionMethod::Mathematical, ZERO_FLOAT_,
+                         NTC::ConversionCost::BETA_},
+      conversion_error_measured_(true), conversion_pending_(false),
+      last_adc_conversions_(0U), adc_count_table_(), adc_count_table_shift_(0U),
+      adc_count_table_valid_(false), async_active_(false),
+      async_samples_taken_(0U), async_count_sum_(0U), async_counts_(),
+      async_next_sample_us_(0U), async_first_sample_us_(0U),
+      async_last_error_(ntc::AdcError::Success), async_sample_(),
+      async_acquisition_cycles_(0U), history_(nullptr), history_push_(nullptr),
+      snapshot_(nullptr), reported_count_(0U), reported_valid_(false) {
+  updateLookupTable();
+  updateConversionContext();
+  (void)ResetStats();
+}
 
 //--------------------------------------
 //  INITIALIZATION AND CONFIGURATION
@@ -71,8 +110,9 @@ template <typename AdcType> bool NtcThermistor<AdcType>::Initialize() noexcept {
   }
 
   // Validate configuration
-  NtcError validation_error = validateConfiguration(config_);
-  if (validation_error != NtcError::Success) {
+  NtcError validation_error = NTC::Acquisition::ValidateConfiguration(config_);
+  if (validation_error != NtcError::Success ||
+      (config_.enable_filtering && !hasFilterTimeBase(config_))) {
     return false;
   }
 
@@ -93,9 +133,17 @@ template <typename AdcType> bool NtcThermistor<AdcType>::Initialize() noexcept {
     return false;
   }
 
-  // Reset filter
+  // Reset filter and change detection
   filter_initialized_ = false;
   filtered_temperature_ = ZERO_FLOAT_;
+  reported_valid_ = false;
+
+  // Pick up tables registered since construction, then precompute the ADC
+  // count table and resolve the conversion method, or leave them to the
+  // first conversion when deferred
+  updateLookupTable();
+  updateConversionContext();
+  updateConversionMethod();
 
   initialized_ = true;
   return true;
@@ -110,6 +158,8 @@ bool NtcThermistor<AdcType>::Deinitialize() noexcept {
   initialized_ = false;
   filter_initialized_ = false;
   filtered_temperature_ = ZERO_FLOAT_;
+  async_active_ = false;
+  reported_valid_ = false;
 
   return true;
 }
@@ -134,16 +184,27 @@ template <typename AdcType>
 NtcError
 NtcThermistor<AdcType>::SetConfiguration(const ntc_config_t &config) noexcept {
   // Validate new configuration
-  NtcError validation_error = validateConfiguration(config);
+  NtcError validation_error = NTC::Acquisition::ValidateConfiguration(config);
   if (validation_error != NtcError::Success) {
     return validation_error;
   }
 
+  if (config.enable_filtering && !hasFilterTimeBase(config)) {
+    return NtcError::InvalidParameter;
+  }
+
   config_ = config;
 
-  // Reset filter when configuration changes
+  // Reset filter and change detection and abandon any conversion when
+  // configuration changes
   filter_initialized_ = false;
   filtered_temperature_ = ZERO_FLOAT_;
+  async_active_ = false;
+  reported_valid_ = false;
+
+  updateLookupTable();
+  updateConversionContext();
+  updateConversionMethod();
 
   return NtcError::Success;
 }
@@ -163,44 +224,18 @@ NtcError NtcThermistor<AdcType>::ReadTemperatureCelsius(
     return NtcError::NotInitialized;
   }
 
-  // Read voltage from ADC
-  float voltage_volts = 0.0F;
-  NtcError voltage_error = readAdcVoltage(&voltage_volts);
-  if (voltage_error != NtcError::Success) {
-    return voltage_error;
-  }
-
-  // Calculate resistance
-  float resistance_ohms = 0.0F;
-  NtcError resistance_error =
-      calculateResistance(voltage_volts, &resistance_ohms);
-  if (resistance_error != NtcError::Success) {
-    return resistance_error;
-  }
-
-  // Convert resistance to temperature
-  float raw_temperature = 0.0F;
-  NtcError conversion_error =
-      convertResistanceToTemperature(resistance_ohms, &raw_temperature);
-  if (conversion_error != NtcError::Success) {
-    return conversion_error;
-  }
-
-  // Apply calibration offset
-  *temperature_celsius = raw_temperature + config_.calibration_offset;
-
-  // Apply filtering if enabled
-  if (config_.enable_filtering) {
-    *temperature_celsius = applyFiltering(*temperature_celsius);
+  // Single acquisition, then voltage -> resistance -> temperature
+  ntc_adc_sample_t sample = {};
+  NtcError acquire_error = acquireSample(&sample);
+  if (acquire_error != NtcError::Success) {
+    return acquire_error;
   }
 
-  // Validate temperature range
-  if (!NTC::ValidateTemperature(*temperature_celsius, config_.min_temperature,
-                                config_.max_temperature)) {
-    return NtcError::TemperatureOutOfRange;
+  NtcError error = convertSample(sample, nullptr, temperature_celsius);
+  if (error == NtcError::Success) {
+    recordHistory(*temperature_celsius, sample.timestamp_us);
   }
-
-  return NtcError::Success;
+  return error;
 }
 
 template <typename AdcType>
@@ -240,39 +275,150 @@ NtcThermistor<AdcType>::ReadTemperature(ntc_reading_t *reading) noexcept {
     return NtcError::NullPointer;
   }
 
-  // Initialize reading structure
-  reading->error = NtcError::Success;
-  reading->is_valid = false;
-  reading->timestamp_us = 0;        // Implementer should provide timestamp
-  reading->accuracy_celsius = 0.5F; // Estimate based on typical NTC accuracy
+  ntc_adc_sample_t sample = {};
+  if (!initialized_) {
+    return completeReading(sample, NtcError::NotInitialized, reading);
+  }
+
+  // One acquisition feeds every field of the reading
+  NtcError error = acquireSample(&sample);
+  return completeReading(sample, error, reading);
+}
 
-  // Read temperature
-  float temperature_celsius = 0.0F;
-  NtcError error = ReadTemperatureCelsius(&temperature_celsius);
+template <typename AdcType>
+NtcConversionStatus NtcThermistor<AdcType>::ReadTemperatureIfChanged(
+    ntc_reading_t *reading) noexcept {
+  if (reading == nullptr) {
+    return NtcConversionStatus::Idle;
+  }
 
-  if (error == NtcError::Success) {
-    // Get additional data
-    float resistance_ohms = 0.0F;
-    GetResistance(&resistance_ohms);
+  ntc_adc_sample_t sample = {};
+  if (!initialized_) {
+    (void)completeReading(sample, NtcError::NotInitialized, reading);
+    return NtcConversionStatus::Complete;
+  }
 
-    float voltage_volts = 0.0F;
-    GetVoltage(&voltage_volts);
+  // Decide on the raw count, before any conversion work
+  NtcError error = acquireSample(&sample);
+  if (error == NtcError::Success && isUnchangedReading(sample)) {
+    return NtcConversionStatus::Unchanged;
+  }
+
+  (void)completeReading(sample, error, reading);
+  return NtcConversionStatus::Complete;
+}
+
+template <typename AdcType>
+uint32_t NtcThermistor<AdcType>::GetLastAdcConversionCount() const noexcept {
+  return last_adc_conversions_;
+}
+
+//--------------------------------------
+//  ASYNCHRONOUS READING
+//--------------------------------------
+
+template <typename AdcType>
+NtcError NtcThermistor<AdcType>::StartConversion(uint64_t now_us) noexcept {
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
 
-    uint32_t adc_raw = 0U;
-    GetRawAdcValue(&adc_raw);
+  if (adc_interface_ == nullptr) {
+    return NtcError::NullPointer;
+  }
 
-    // Fill reading structure
-    reading->temperature_celsius = temperature_celsius;
-    reading->temperature_fahrenheit = CelsiusToFahrenheit(temperature_celsius);
-    reading->temperature_kelvin = CelsiusToKelvin(temperature_celsius);
-    reading->resistance_ohms = resistance_ohms;
-    reading->voltage_volts = voltage_volts;
-    reading->adc_raw_value = adc_raw;
-    reading->is_valid = true;
+  if (async_active_) {
+    return NtcError::Busy;
   }
 
-  reading->error = error;
-  return error;
+  async_active_ = true;
+  async_samples_taken_ = 0U;
+  async_count_sum_ = 0U;
+  async_next_sample_us_ = now_us;
+  async_last_error_ = ntc::AdcError::Success;
+  async_sample_ = {};
+  async_acquisition_cycles_ = 0U;
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+NtcConversionStatus NtcThermistor<AdcType>::Poll(
+    uint64_t now_us, ntc_reading_t *reading) noexcept {
+  if (!async_active_ || reading == nullptr) {
+    return NtcConversionStatus::Idle;
+  }
+
+  NtcError error = NtcError::Success;
+  if (config_.sample_delay_ms == 0U) {
+    // Nothing to wait for: take the whole burst now
+    error = acquireSample(&async_sample_);
+    async_sample_.timestamp_us = now_us;
+  } else {
+    // Time only the sampling work of each Poll(), not the waits between
+    const uint32_t start_cycles = statsCycles();
+    const uint64_t sample_interval_us =
+        static_cast<uint64_t>(config_.sample_delay_ms) *
+        MILLISECONDS_PER_SECOND_;
+    while (async_samples_taken_ < config_.sample_count &&
+           now_us >= async_next_sample_us_) {
+      if (async_samples_taken_ == 0U) {
+        async_first_sample_us_ = now_us;
+      }
+      uint32_t sample_value = 0;
+      ntc::AdcError err =
+          adc_interface_->ReadChannelCount(config_.adc_channel, &sample_value);
+      async_sample_.conversions++;
+      if (err == ntc::AdcError::Success) {
+        async_count_sum_ += sample_value;
+        if (keepsSampleCounts()) {
+          async_counts_[async_sample_.valid_samples] = sample_value;
+        }
+        async_sample_.valid_samples++;
+      } else {
+        async_last_error_ = err;
+      }
+      async_samples_taken_++;
+      // Space samples from when they were actually taken
+      async_next_sample_us_ = now_us + sample_interval_us;
+    }
+
+    if (async_samples_taken_ < config_.sample_count) {
+      async_acquisition_cycles_ += statsCycles() - start_cycles;
+      return NtcConversionStatus::InProgress;
+    }
+
+    last_adc_conversions_ = async_sample_.conversions;
+    async_sample_.timestamp_us =
+        NTC::Acquisition::WindowMidpointUs(async_first_sample_us_, now_us);
+    error = finishSample(async_count_sum_, async_counts_.data(),
+                         async_last_error_, &async_sample_);
+    statsRecordSample(async_sample_);
+    async_acquisition_cycles_ += statsCycles() - start_cycles;
+    statsRecordCycles(StatsStage::Acquisition, async_acquisition_cycles_);
+  }
+
+  async_active_ = false;
+  if (error == NtcError::Success && isUnchangedReading(async_sample_)) {
+    return NtcConversionStatus::Unchanged;
+  }
+
+  completeReading(async_sample_, error, reading);
+  return NtcConversionStatus::Complete;
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::CancelConversion() noexcept {
+  async_active_ = false;
+}
+
+template <typename AdcType>
+bool NtcThermistor<AdcType>::IsConversionActive() const noexcept {
+  return async_active_;
+}
+
+template <typename AdcType>
+uint64_t NtcThermistor<AdcType>::NextSampleDueUs() const noexcept {
+  return async_next_sample_us_;
 }
 
 //--------------------------------------
@@ -290,13 +436,13 @@ NtcThermistor<AdcType>::GetResistance(float *resistance_ohms) noexcept {
     return NtcError::NotInitialized;
   }
 
-  float voltage_volts = 0.0F;
-  NtcError voltage_error = readAdcVoltage(&voltage_volts);
-  if (voltage_error != NtcError::Success) {
-    return voltage_error;
+  ntc_adc_sample_t sample = {};
+  NtcError acquire_error = acquireSample(&sample);
+  if (acquire_error != NtcError::Success) {
+    return acquire_error;
   }
 
-  return calculateResistance(voltage_volts, resistance_ohms);
+  return calculateResistance(sample.voltage_volts, resistance_ohms);
 }
 
 template <typename AdcType>
@@ -309,7 +455,14 @@ NtcError NtcThermistor<AdcType>::GetVoltage(float *voltage_volts) noexcept {
     return NtcError::NotInitialized;
   }
 
-  return readAdcVoltage(voltage_volts);
+  ntc_adc_sample_t sample = {};
+  NtcError acquire_error = acquireSample(&sample);
+  if (acquire_error != NtcError::Success) {
+    return acquire_error;
+  }
+
+  *voltage_volts = sample.voltage_volts;
+  return NtcError::Success;
 }
 
 template <typename AdcType>
@@ -322,75 +475,68 @@ NtcError NtcThermistor<AdcType>::GetRawAdcValue(uint32_t *adc_value) noexcept {
     return NtcError::NotInitialized;
   }
 
-  if (adc_interface_ == nullptr) {
-    return NtcError::NullPointer;
+  ntc_adc_sample_t sample = {};
+  NtcError acquire_error = acquireSample(&sample);
+  if (acquire_error != NtcError::Success) {
+    return acquire_error;
   }
 
-  // Convert AdcError to NtcError helper
-  auto convert_error = [](ntc::AdcError err) -> NtcError {
-    switch (err) {
-    case ntc::AdcError::Success:
-      return NtcError::Success;
-    case ntc::AdcError::NotInitialized:
-      return NtcError::NotInitialized;
-    case ntc::AdcError::InvalidChannel:
-      return NtcError::InvalidParameter;
-    case ntc::AdcError::ReadFailed:
-      return NtcError::AdcReadFailed;
-    case ntc::AdcError::Timeout:
-      return NtcError::Timeout;
-    case ntc::AdcError::HardwareError:
-      return NtcError::HardwareFault;
-    default:
-      return NtcError::AdcReadFailed;
-    }
-  };
+  *adc_value = sample.raw_count;
+  return NtcError::Success;
+}
 
-  // Perform sampling if configured
-  if (config_.sample_count > 1) {
-    uint64_t sum = 0;
-    uint32_t successful_samples = 0;
+template <typename AdcType>
+NtcError NtcThermistor<AdcType>::ConvertTemperaturesToAdcCounts(
+    const float *temperatures_celsius, uint32_t *adc_counts,
+    size_t count) const noexcept {
+  if (temperatures_celsius == nullptr || adc_counts == nullptr) {
+    return NtcError::NullPointer;
+  }
 
-    for (uint32_t i = 0; i < config_.sample_count; ++i) {
-      uint32_t sample_value = 0;
-      ntc::AdcError err =
-          adc_interface_->ReadChannelCount(config_.adc_channel, &sample_value);
-      if (err == ntc::AdcError::Success) {
-        sum += sample_value;
-        successful_samples++;
-      }
+  // The inverse follows the active method, which a deferred setup has not
+  // selected yet
+  if (!initialized_ || conversion_pending_) {
+    return NtcError::NotInitialized;
+  }
 
-      // Simple delay loop if delay is configured (not accurate but
-      // hardware-agnostic)
-      if (config_.sample_delay_ms > 0 && i < config_.sample_count - 1) {
-        // Simple busy-wait delay (approximate)
-        volatile uint32_t delay_count =
-            config_.sample_delay_ms *
-            static_cast<uint32_t>(MILLISECONDS_PER_SECOND_);
-        while (delay_count-- > 0) {
-          // Busy wait
-        }
-      }
+  // Scale and clamp in double: float(2^32 - 1) rounds up to 2^32, which
+  // does not convert to uint32_t
+  const uint64_t full_scale = (1ULL << config_.adc_resolution_bits) - 1ULL;
+  const double max_counts = static_cast<double>(full_scale);
+  const double counts_per_volt =
+      max_counts / static_cast<double>(config_.reference_voltage);
+
+  for (size_t i = 0; i < count; ++i) {
+    if (!NTC::ValidateTemperature(temperatures_celsius[i],
+                                  config_.min_temperature,
+                                  config_.max_temperature)) {
+      return NtcError::TemperatureOutOfRange;
     }
 
-    if (successful_samples == 0) {
-      return NtcError::AdcReadFailed;
+    // Readings add the calibration offset, so thresholds remove it
+    float resistance_ohms = 0.0F;
+    NtcError resistance_error = convertTemperatureToResistance(
+        temperatures_celsius[i] - config_.calibration_offset,
+        &resistance_ohms);
+    if (resistance_error != NtcError::Success) {
+      return resistance_error;
     }
 
-    *adc_value = static_cast<uint32_t>(sum / successful_samples);
-    return NtcError::Success;
-  }
-  // Single sample
-  {
-    uint32_t sample_value = 0;
-    ntc::AdcError err =
-        adc_interface_->ReadChannelCount(config_.adc_channel, &sample_value);
-    if (err != ntc::AdcError::Success) {
-      return convert_error(err);
+    float voltage_volts = 0.0F;
+    if (!NTC::CalculateThermistorVoltage(resistance_ohms,
+                                         config_.reference_voltage,
+                                         config_.series_resistance,
+                                         &voltage_volts)) {
+      return NtcError::ConversionFailed;
     }
-    *adc_value = sample_value;
-    return NtcError::Success;
+
+    const double counts =
+        std::round(static_cast<double>(voltage_volts) * counts_per_volt);
+    adc_counts[i] =
+        static_cast<uint32_t>(std::min(std::max(counts, 0.0), max_counts));
   }
+
+  return NtcError::Success;
 }
 
 //--------------------------------------
@@ -416,6 +562,7 @@ NtcError NtcThermistor<AdcType>::Calibrate(
 
   // Apply offset
   config_.calibration_offset = new_offset;
+  reported_valid_ = false;
 
   return NtcError::Success;
 }
@@ -424,6 +571,7 @@ template <typename AdcType>
 NtcError
 NtcThermistor<AdcType>::SetCalibrationOffset(float offset_celsius) noexcept {
   config_.calibration_offset = offset_celsius;
+  reported_valid_ = false;
   return NtcError::Success;
 }
 
@@ -451,6 +599,7 @@ template <typename AdcType>
 NtcError NtcThermistor<AdcType>::SetConversionMethod(
     NtcConversionMethod method) noexcept {
   config_.conversion_method = method;
+  updateConversionMethod();
   return NtcError::Success;
 }
 
@@ -462,6 +611,7 @@ NtcThermistor<AdcType>::SetVoltageDivider(float series_resistance) noexcept {
   }
 
   config_.series_resistance = series_resistance;
+  updateConversionMethod();
   return NtcError::Success;
 }
 
@@ -473,6 +623,8 @@ NtcThermistor<AdcType>::SetReferenceVoltage(float reference_voltage) noexcept {
   }
 
   config_.reference_voltage = reference_voltage;
+  updateConversionContext();
+  updateConversionMethod();
   return NtcError::Success;
 }
 
@@ -483,6 +635,8 @@ NtcError NtcThermistor<AdcType>::SetBetaValue(float beta_value) noexcept {
   }
 
   config_.beta_value = beta_value;
+  updateConversionContext();
+  updateConversionMethod();
   return NtcError::Success;
 }
 
@@ -494,21 +648,50 @@ NtcError NtcThermistor<AdcType>::SetAdcChannel(uint8_t adc_channel) noexcept {
   }
 
   config_.adc_channel = adc_channel;
+  reported_valid_ = false;
+  async_active_ = false; // Samples of a running conversion would mix channels
   return NtcError::Success;
 }
 
 template <typename AdcType>
 NtcError NtcThermistor<AdcType>::SetSamplingParameters(
     uint32_t sample_count, uint32_t sample_delay_ms) noexcept {
-  if (sample_count == 0) {
+  if (!NTC::Acquisition::IsValidSamplingPlan(sample_count,
+                                             config_.sampling_strategy)) {
     return NtcError::InvalidParameter;
   }
 
   config_.sample_count = sample_count;
   config_.sample_delay_ms = sample_delay_ms;
+  async_active_ = false; // Sample plan of a running conversion changed
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+NtcError NtcThermistor<AdcType>::SetSamplingStrategy(
+    NtcSamplingStrategy strategy) noexcept {
+  if (!NTC::Acquisition::IsValidSamplingPlan(config_.sample_count, strategy)) {
+    return NtcError::InvalidParameter;
+  }
+
+  config_.sampling_strategy = strategy;
+  async_active_ = false; // Sample plan of a running conversion changed
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+NtcError
+NtcThermistor<AdcType>::SetReportDeadband(uint32_t deadband_counts) noexcept {
+  config_.report_deadband_counts = deadband_counts;
+  reported_valid_ = false;
   return NtcError::Success;
 }
 
+template <typename AdcType>
+void NtcThermistor<AdcType>::ResetChangeReference() noexcept {
+  reported_valid_ = false;
+}
+
 template <typename AdcType>
 NtcError NtcThermistor<AdcType>::SetFiltering(bool enable,
                                               float alpha) noexcept {
@@ -518,6 +701,11 @@ NtcError NtcThermistor<AdcType>::SetFiltering(bool enable,
     return NtcError::InvalidParameter;
   }
 
+  if (enable && (!NTC::Acquisition::IsValidFilterMode(config_) ||
+                 !hasFilterTimeBase(config_))) {
+    return NtcError::InvalidParameter;
+  }
+
   config_.enable_filtering = enable;
   config_.filter_alpha = alpha;
 
@@ -528,203 +716,672 @@ NtcError NtcThermistor<AdcType>::SetFiltering(bool enable,
   return NtcError::Success;
 }
 
-//--------------------------------------
-//  UTILITY FUNCTIONS
-//--------------------------------------
-
 template <typename AdcType>
-float NtcThermistor<AdcType>::CelsiusToFahrenheit(float celsius) noexcept {
-  return (celsius * CELSIUS_TO_FAHRENHEIT_MULTIPLIER_) + FAHRENHEIT_OFFSET_;
+NtcError NtcThermistor<AdcType>::SetFilterMode(NtcFilterMode mode) noexcept {
+  ntc_config_t config = config_;
+  config.filter_mode = mode;
+  if (!NTC::Acquisition::IsValidFilterMode(config) ||
+      !hasFilterTimeBase(config)) {
+    return NtcError::InvalidParameter;
+  }
+
+  config_.filter_mode = mode;
+  filter_initialized_ = false;
+  filtered_temperature_ = ZERO_FLOAT_;
+  return NtcError::Success;
 }
 
 template <typename AdcType>
-float NtcThermistor<AdcType>::FahrenheitToCelsius(float fahrenheit) noexcept {
-  return (fahrenheit - FAHRENHEIT_OFFSET_) * FAHRENHEIT_TO_CELSIUS_MULTIPLIER_;
+NtcError NtcThermistor<AdcType>::SetLookupTable(
+    const NTC::ntc_lookup_table_t *table) noexcept {
+  const NTC::ValidatedLookupTable validated(table);
+  if (table != nullptr && !validated.IsValid()) {
+    return NtcError::LookupTableError;
+  }
+
+  return SetLookupTable(validated);
 }
 
 template <typename AdcType>
-float NtcThermistor<AdcType>::CelsiusToKelvin(float celsius) noexcept {
-  return celsius + KELVIN_OFFSET_;
+NtcError NtcThermistor<AdcType>::SetLookupTable(
+    const NTC::ValidatedLookupTable &table) noexcept {
+  attached_lookup_table_ = table;
+  updateLookupTable();
+  updateConversionContext();
+  updateConversionMethod();
+  return NtcError::Success;
 }
 
 template <typename AdcType>
-float NtcThermistor<AdcType>::KelvinToCelsius(float kelvin) noexcept {
-  return kelvin - KELVIN_OFFSET_;
+NtcError NtcThermistor<AdcType>::SetSteinhartHartCoefficients(
+    float coeff_a, float coeff_b, float coeff_c) noexcept {
+  const bool fit = coeff_a == ZERO_FLOAT_ && coeff_b == ZERO_FLOAT_ &&
+                   coeff_c == ZERO_FLOAT_;
+  if (!fit && !NTC::ValidateSteinhartHartCoefficients(coeff_a, coeff_b,
+                                                      coeff_c)) {
+    return NtcError::InvalidParameter;
+  }
+
+  config_.steinhart_hart_a = coeff_a;
+  config_.steinhart_hart_b = coeff_b;
+  config_.steinhart_hart_c = coeff_c;
+  updateConversionContext();
+  updateConversionMethod();
+  return NtcError::Success;
 }
 
 template <typename AdcType>
-const char *NtcThermistor<AdcType>::GetErrorString(NtcError error) noexcept {
-  switch (error) {
-  case NtcError::Success:
-    return "Success";
-  case NtcError::Failure:
-    return "General failure";
-  case NtcError::NotInitialized:
-    return "Not initialized";
-  case NtcError::AlreadyInitialized:
-    return "Already initialized";
-  case NtcError::InvalidParameter:
-    return "Invalid parameter";
-  case NtcError::NullPointer:
-    return "Null pointer";
-  case NtcError::OutOfMemory:
-    return "Out of memory";
-  case NtcError::AdcReadFailed:
-    return "ADC read failed";
-  case NtcError::InvalidResistance:
-    return "Invalid resistance value";
-  case NtcError::TemperatureOutOfRange:
-    return "Temperature out of range";
-  case NtcError::LookupTableError:
-    return "Lookup table error";
-  case NtcError::ConversionFailed:
-    return "Temperature conversion failed";
-  case NtcError::CalibrationFailed:
-    return "Calibration failed";
-  case NtcError::UnsupportedOperation:
-    return "Operation not supported";
-  case NtcError::Timeout:
-    return "Operation timeout";
-  case NtcError::HardwareFault:
-    return "Hardware fault";
-  default:
-    return "Unknown error";
-  }
+NtcConversionMethod
+NtcThermistor<AdcType>::GetActiveConversionMethod() const noexcept {
+  return conversion_pending_ ? NtcConversionMethod::Auto : active_method_;
 }
 
 template <typename AdcType>
-const char *NtcThermistor<AdcType>::GetTypeString(NtcType type) noexcept {
-  switch (type) {
-  case NtcType::Unknown:
-    return "Unknown";
-  case NtcType::NtcG163Jft103Ft1S:
-    return "NTCG163JFT103FT1S";
-  case NtcType::NtcG164Jf103Ft1S:
-    return "NTCG164JF103FT1S";
-  case NtcType::NtcG163Jf103Ft1S:
-    return "NTCG163JF103FT1S";
-  case NtcType::Custom:
-    return "Custom";
-  default:
-    return "Invalid";
+NtcError NtcThermistor<AdcType>::GetConversionReport(
+    ntc_conversion_report_t *report) const noexcept {
+  if (report == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (!initialized_ || conversion_pending_) {
+    return NtcError::NotInitialized;
   }
+
+  *report = conversion_report_;
+  report->max_error_celsius = activeConversionError();
+  return NtcError::Success;
 }
 
 //--------------------------------------
-//  PRIVATE HELPER METHODS
+//  STARTUP AND WARM START
 //--------------------------------------
 
 template <typename AdcType>
-NtcError NtcThermistor<AdcType>::validateConfiguration(
-    const ntc_config_t &config) const noexcept {
-  if (config.resistance_at_25c <= ZERO_FLOAT_) {
-    return NtcError::InvalidParameter;
+NtcError NtcThermistor<AdcType>::PrepareConversion() noexcept {
+  if (!initialized_) {
+    return NtcError::NotInitialized;
   }
 
-  if (!NTC::ValidateBetaValue(config.beta_value)) {
-    return NtcError::InvalidParameter;
-  }
+  ensureConversionMethod();
+  return NtcError::Success;
+}
 
-  if (config.reference_voltage <= ZERO_FLOAT_) {
-    return NtcError::InvalidParameter;
-  }
+template <typename AdcType>
+bool NtcThermistor<AdcType>::IsConversionPrepared() const noexcept {
+  return initialized_ && !conversion_pending_;
+}
 
-  if (config.series_resistance <= ZERO_FLOAT_) {
-    return NtcError::InvalidParameter;
+template <typename AdcType>
+NtcError NtcThermistor<AdcType>::SaveState(uint8_t *buffer,
+                                           size_t capacity) noexcept {
+  if (buffer == nullptr) {
+    return NtcError::NullPointer;
   }
 
-  if (config.sample_count == 0) {
-    return NtcError::InvalidParameter;
+  if (!initialized_) {
+    return NtcError::NotInitialized;
   }
 
-  if (config.min_temperature >= config.max_temperature) {
-    return NtcError::InvalidParameter;
+  if (capacity < STATE_BLOB_SIZE_) {
+    return NtcError::OutOfMemory;
   }
 
-  constexpr float MIN_FILTER_ALPHA_ = 0.0F;
-  constexpr float MAX_FILTER_ALPHA_ = 1.0F;
-  if (config.enable_filtering && (config.filter_alpha < MIN_FILTER_ALPHA_ ||
-                                  config.filter_alpha > MAX_FILTER_ALPHA_)) {
-    return NtcError::InvalidParameter;
+  ensureConversionMethod();
+
+  // Layout: header, calibration, filter, context, method, table, checksum
+  constexpr size_t BODY_SIZE_ = STATE_BLOB_SIZE_ - STATE_CHECKSUM_BYTES_;
+  const uint8_t *end = buffer + BODY_SIZE_;
+  uint8_t *out = buffer;
+  out = putState(out, end, STATE_MAGIC_);
+  out = putState(out, end, STATE_VERSION_);
+  out = putState(out, end, stateFingerprint());
+  out = putState(out, end, config_.calibration_offset);
+
+  out = putState(out, end, static_cast<uint8_t>(filter_initialized_ ? 1U : 0U));
+  out = putState(out, end, filtered_temperature_);
+  out = putState(out, end, filter_lead_);
+  out = putState(out, end, filter_variance_);
+
+  out = putState(out, end, context_.volts_per_count);
+  out = putState(out, end, context_.inverse_resistance_at_25c);
+  out = putState(out, end, context_.inverse_beta_value);
+  out = putState(out, end, context_.steinhart_hart_a);
+  out = putState(out, end, context_.steinhart_hart_b);
+  out = putState(out, end, context_.steinhart_hart_c);
+  out = putState(out, end,
+                 static_cast<uint8_t>(context_.steinhart_hart_valid ? 1U : 0U));
+
+  out = putState(out, end, static_cast<uint8_t>(active_method_));
+  out = putState(out, end, activeConversionError());
+  out = putState(out, end, conversion_report_.cost);
+
+  out = putState(out, end,
+                 static_cast<uint8_t>(adc_count_table_valid_ ? 1U : 0U));
+  out = putState(out, end, static_cast<uint8_t>(adc_count_table_shift_));
+  for (const int16_t node : adc_count_table_) {
+    out = putState(out, end, node);
   }
 
+  // The fields must fill the body exactly; STATE_BLOB_SIZE_ is stale if not
+  if (out != end) {
+    return NtcError::Failure;
+  }
+  (void)putState(out, end + STATE_CHECKSUM_BYTES_,
+                 hashBytes(HASH_OFFSET_BASIS_, buffer, BODY_SIZE_));
   return NtcError::Success;
 }
 
 template <typename AdcType>
-NtcError NtcThermistor<AdcType>::readAdcVoltage(float *voltage_volts) noexcept {
-  if (voltage_volts == nullptr) {
+NtcError NtcThermistor<AdcType>::RestoreState(const uint8_t *data,
+                                              size_t size) noexcept {
+  if (data == nullptr) {
     return NtcError::NullPointer;
   }
 
-  if (adc_interface_ == nullptr) {
-    return NtcError::NullPointer;
+  if (!initialized_) {
+    return NtcError::NotInitialized;
   }
 
-  // Convert AdcError to NtcError helper
-  auto convert_error = [](ntc::AdcError err) -> NtcError {
-    switch (err) {
-    case ntc::AdcError::Success:
-      return NtcError::Success;
-    case ntc::AdcError::NotInitialized:
-      return NtcError::NotInitialized;
-    case ntc::AdcError::InvalidChannel:
-      return NtcError::InvalidParameter;
-    case ntc::AdcError::ReadFailed:
-      return NtcError::AdcReadFailed;
-    case ntc::AdcError::Timeout:
-      return NtcError::Timeout;
-    case ntc::AdcError::HardwareError:
-      return NtcError::HardwareFault;
-    default:
-      return NtcError::AdcReadFailed;
-    }
-  };
-
-  // Perform sampling if configured
-  if (config_.sample_count > 1) {
-    float sum = ZERO_FLOAT_;
-    uint32_t successful_samples = 0;
+  if (size < STATE_BLOB_SIZE_) {
+    return NtcError::InvalidParameter;
+  }
 
-    for (uint32_t i = 0; i < config_.sample_count; ++i) {
-      float sample_voltage = ZERO_FLOAT_;
-      ntc::AdcError err =
-          adc_interface_->ReadChannelV(config_.adc_channel, &sample_voltage);
-      if (err == ntc::AdcError::Success) {
-        sum += sample_voltage;
-        successful_samples++;
-      }
+  // Check the envelope before trusting any field
+  constexpr size_t BODY_SIZE_ = STATE_BLOB_SIZE_ - STATE_CHECKSUM_BYTES_;
+  const uint8_t *end = data + BODY_SIZE_;
+  uint32_t magic = 0U;
+  uint16_t version = 0U;
+  uint32_t fingerprint = 0U;
+  uint32_t checksum = 0U;
+  const uint8_t *in = getState(data, end, &magic);
+  in = getState(in, end, &version);
+  in = getState(in, end, &fingerprint);
+  (void)getState(end, end + STATE_CHECKSUM_BYTES_, &checksum);
+  if (magic != STATE_MAGIC_ ||
+      checksum != hashBytes(HASH_OFFSET_BASIS_, data, BODY_SIZE_)) {
+    return NtcError::InvalidParameter;
+  }
+  if (version != STATE_VERSION_) {
+    return NtcError::UnsupportedOperation;
+  }
+  if (fingerprint != stateFingerprint()) {
+    return NtcError::InvalidParameter;
+  }
 
-      // Simple delay loop if delay is configured (not accurate but
-      // hardware-agnostic)
-      if (config_.sample_delay_ms > 0 && i < config_.sample_count - 1) {
-        // Simple busy-wait delay (approximate)
-        volatile uint32_t delay_count =
-            config_.sample_delay_ms *
-            static_cast<uint32_t>(MILLISECONDS_PER_SECOND_);
-        while (delay_count-- > 0) {
-          // Busy wait
-        }
-      }
+  float calibration_offset = ZERO_FLOAT_;
+  uint8_t filter_initialized = 0U;
+  float filtered_temperature = ZERO_FLOAT_;
+  float filter_lead = ZERO_FLOAT_;
+  float filter_variance = ZERO_FLOAT_;
+  in = getState(in, end, &calibration_offset);
+  in = getState(in, end, &filter_initialized);
+  in = getState(in, end, &filtered_temperature);
+  in = getState(in, end, &filter_lead);
+  in = getState(in, end, &filter_variance);
+
+  ntc_conversion_context_t context = {};
+  uint8_t steinhart_hart_valid = 0U;
+  in = getState(in, end, &context.volts_per_count);
+  in = getState(in, end, &context.inverse_resistance_at_25c);
+  in = getState(in, end, &context.inverse_beta_value);
+  in = getState(in, end, &context.steinhart_hart_a);
+  in = getState(in, end, &context.steinhart_hart_b);
+  in = getState(in, end, &context.steinhart_hart_c);
+  in = getState(in, end, &steinhart_hart_valid);
+  context.steinhart_hart_valid = steinhart_hart_valid != 0U;
+
+  uint8_t method = 0U;
+  ntc_conversion_report_t report = {};
+  in = getState(in, end, &method);
+  in = getState(in, end, &report.max_error_celsius);
+  in = getState(in, end, &report.cost);
+  report.method = static_cast<NtcConversionMethod>(method);
+
+  uint8_t table_valid = 0U;
+  uint8_t table_shift = 0U;
+  NTC::Acquisition::CountTable table = {};
+  in = getState(in, end, &table_valid);
+  in = getState(in, end, &table_shift);
+  for (int16_t &node : table) {
+    in = getState(in, end, &node);
+  }
+
+  const bool known_method =
+      report.method == NtcConversionMethod::LookupTable ||
+      report.method == NtcConversionMethod::Mathematical ||
+      report.method == NtcConversionMethod::SteinhartHart ||
+      report.method == NtcConversionMethod::AdcCountTable;
+  if (in != end || !known_method || table_shift >= 32U ||
+      !std::isfinite(calibration_offset) ||
+      !std::isfinite(filtered_temperature) || !std::isfinite(filter_lead) ||
+      !std::isfinite(filter_variance)) {
+    return NtcError::InvalidParameter;
+  }
+
+  // Everything checks out: apply
+  adc_count_table_ = table;
+  adc_count_table_shift_ = table_shift;
+  adc_count_table_valid_ = table_valid != 0U;
+  context_ = context;
+  active_method_ = report.method;
+  conversion_report_ = report;
+  conversion_error_measured_ = true;
+  conversion_pending_ = false;
+
+  config_.calibration_offset = calibration_offset;
+  filter_initialized_ = filter_initialized != 0U;
+  filtered_temperature_ = filtered_temperature;
+  filter_lead_ = filter_lead;
+  filter_variance_ = filter_variance;
+  filter_timestamp_us_ = 0U;
+  reported_valid_ = false;
+
+  return NtcError::Success;
+}
+
+//--------------------------------------
+//  HISTORY
+//--------------------------------------
+
+template <typename AdcType>
+template <size_t Capacity>
+NtcError
+NtcThermistor<AdcType>::AttachHistory(NtcHistory<Capacity> *history) noexcept {
+  if (history == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  history_ = history;
+  history_push_ = [](void *target, float temperature_celsius,
+                     uint64_t timestamp_us) noexcept {
+    static_cast<NtcHistory<Capacity> *>(target)->Push(temperature_celsius,
+                                                      timestamp_us);
+  };
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::DetachHistory() noexcept {
+  history_ = nullptr;
+  history_push_ = nullptr;
+}
+
+//--------------------------------------
+//  SNAPSHOT
+//--------------------------------------
+
+template <typename AdcType>
+NtcError
+NtcThermistor<AdcType>::AttachSnapshot(NtcReadingSnapshot *snapshot) noexcept {
+  if (snapshot == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  snapshot_ = snapshot;
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::DetachSnapshot() noexcept {
+  snapshot_ = nullptr;
+}
+
+//--------------------------------------
+//  STATISTICS
+//--------------------------------------
+
+template <typename AdcType>
+NtcError NtcThermistor<AdcType>::GetStats(ntc_stats_t *stats) const noexcept {
+  if (stats == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+#if NTC_ENABLE_STATS
+  *stats = stats_;
+  return NtcError::Success;
+#else
+  return NtcError::UnsupportedOperation;
+#endif
+}
+
+template <typename AdcType>
+NtcError NtcThermistor<AdcType>::ResetStats() noexcept {
+#if NTC_ENABLE_STATS
+  stats_ = {};
+  return NtcError::Success;
+#else
+  return NtcError::UnsupportedOperation;
+#endif
+}
+
+//--------------------------------------
+//  UTILITY FUNCTIONS
+//--------------------------------------
+
+template <typename AdcType>
+float NtcThermistor<AdcType>::CelsiusToFahrenheit(float celsius) noexcept {
+  return (celsius * CELSIUS_TO_FAHRENHEIT_MULTIPLIER_) + FAHRENHEIT_OFFSET_;
+}
+
+template <typename AdcType>
+float NtcThermistor<AdcType>::FahrenheitToCelsius(float fahrenheit) noexcept {
+  return (fahrenheit - FAHRENHEIT_OFFSET_) * FAHRENHEIT_TO_CELSIUS_MULTIPLIER_;
+}
+
+template <typename AdcType>
+float NtcThermistor<AdcType>::CelsiusToKelvin(float celsius) noexcept {
+  return celsius + KELVIN_OFFSET_;
+}
+
+template <typename AdcType>
+float NtcThermistor<AdcType>::KelvinToCelsius(float kelvin) noexcept {
+  return kelvin - KELVIN_OFFSET_;
+}
+
+template <typename AdcType>
+const char *NtcThermistor<AdcType>::GetErrorString(NtcError error) noexcept {
+  switch (error) {
+  case NtcError::Success:
+    return "Success";
+  case NtcError::Failure:
+    return "General failure";
+  case NtcError::NotInitialized:
+    return "Not initialized";
+  case NtcError::AlreadyInitialized:
+    return "Already initialized";
+  case NtcError::InvalidParameter:
+    return "Invalid parameter";
+  case NtcError::NullPointer:
+    return "Null pointer";
+  case NtcError::OutOfMemory:
+    return "Out of memory";
+  case NtcError::AdcReadFailed:
+    return "ADC read failed";
+  case NtcError::InvalidResistance:
+    return "Invalid resistance value";
+  case NtcError::TemperatureOutOfRange:
+    return "Temperature out of range";
+  case NtcError::LookupTableError:
+    return "Lookup table error";
+  case NtcError::ConversionFailed:
+    return "Temperature conversion failed";
+  case NtcError::CalibrationFailed:
+    return "Calibration failed";
+  case NtcError::UnsupportedOperation:
+    return "Operation not supported";
+  case NtcError::Timeout:
+    return "Operation timeout";
+  case NtcError::HardwareFault:
+    return "Hardware fault";
+  case NtcError::Busy:
+    return "Conversion in progress";
+  default:
+    return "Unknown error";
+  }
+}
+
+template <typename AdcType>
+const char *NtcThermistor<AdcType>::GetTypeString(NtcType type) noexcept {
+  switch (type) {
+  case NtcType::Unknown:
+    return "Unknown";
+  case NtcType::NtcG163Jft103Ft1S:
+    return "NTCG163JFT103FT1S";
+  case NtcType::NtcG164Jf103Ft1S:
+    return "NTCG164JF103FT1S";
+  case NtcType::NtcG163Jf103Ft1S:
+    return "NTCG163JF103FT1S";
+  case NtcType::Custom:
+    return "Custom";
+  default:
+    return "Invalid";
+  }
+}
+
+//--------------------------------------
+//  PRIVATE HELPER METHODS
+//--------------------------------------
+
+template <typename AdcType>
+NtcError
+NtcThermistor<AdcType>::acquireSample(ntc_adc_sample_t *sample) noexcept {
+  if (sample == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (adc_interface_ == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  const uint32_t start_cycles = statsCycles();
+  const uint64_t start_us = NTC::Acquisition::ReadTimestampUs(adc_interface_);
+  sample->raw_count = 0U;
+  sample->voltage_volts = ZERO_FLOAT_;
+  sample->conversions = 0U;
+  sample->valid_samples = 0U;
+  sample->timestamp_us = 0U;
+
+  // Accumulate raw counts; voltage is derived once from the reduced count
+  std::array<uint32_t, NTC::Acquisition::MAX_ORDERED_SAMPLES_> counts;
+  const NTC::Acquisition::ntc_count_sum_t acquired =
+      NTC::Acquisition::AcquireCounts(
+          adc_interface_, config_.adc_channel, config_.sample_count,
+          config_.sample_delay_ms,
+          keepsSampleCounts() ? counts.data() : nullptr);
+  sample->conversions = acquired.conversions;
+  sample->valid_samples = acquired.valid_samples;
+
+  last_adc_conversions_ = sample->conversions;
+  sample->timestamp_us = NTC::Acquisition::WindowMidpointUs(
+      start_us, NTC::Acquisition::ReadTimestampUs(adc_interface_));
+  const NtcError error =
+      finishSample(acquired.sum, counts.data(), acquired.last_error, sample);
+  statsRecordSample(*sample);
+  statsRecordStage(StatsStage::Acquisition, start_cycles);
+  return error;
+}
+
+template <typename AdcType>
+NtcError NtcThermistor<AdcType>::finishSample(
+    uint64_t count_sum, uint32_t *counts, ntc::AdcError last_error,
+    ntc_adc_sample_t *sample) noexcept {
+  if (sample->valid_samples == 0) {
+    return NTC::Acquisition::NoValidSampleError(config_.sample_count,
+                                                last_error);
+  }
+
+  uint32_t divisor = 1U;
+  const uint64_t reduced =
+      reduceCounts(count_sum, counts, sample->valid_samples, &divisor);
+  const float mean_count =
+      static_cast<float>(reduced) / static_cast<float>(divisor);
+  sample->raw_count = static_cast<uint32_t>(reduced / divisor);
+  sample->count_q = NTC::Acquisition::FixedPointCount(reduced, divisor);
+  sample->voltage_volts = countToVoltage(mean_count);
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+uint64_t NtcThermistor<AdcType>::reduceCounts(
+    uint64_t count_sum, uint32_t *counts, uint32_t valid_samples,
+    uint32_t *divisor) const noexcept {
+  switch (config_.sampling_strategy) {
+  case NtcSamplingStrategy::Decimate: {
+    // k extra bits from 4^k samples: (sum << k) / 4^k == sum >> k
+    uint32_t extra_bits = 0U;
+    while ((1ULL << (2U * (extra_bits + 1U))) <= valid_samples) {
+      extra_bits++;
     }
+    *divisor = 1U << extra_bits;
+    if (valid_samples == (1U << (2U * extra_bits))) {
+      return count_sum >> extra_bits;
+    }
+    // Failed samples: rescale the sum of the valid ones
+    return (count_sum << extra_bits) / valid_samples;
+  }
+  case NtcSamplingStrategy::Median: {
+    std::sort(counts, counts + valid_samples);
+    const uint32_t middle = valid_samples / 2U;
+    if ((valid_samples % 2U) != 0U) {
+      *divisor = 1U;
+      return counts[middle];
+    }
+    *divisor = 2U;
+    return static_cast<uint64_t>(counts[middle - 1U]) + counts[middle];
+  }
+  case NtcSamplingStrategy::TrimmedMean: {
+    // Drop the lowest and highest quarter
+    std::sort(counts, counts + valid_samples);
+    const uint32_t trimmed = valid_samples / 4U;
+    uint64_t sum = 0U;
+    for (uint32_t i = trimmed; i < valid_samples - trimmed; ++i) {
+      sum += counts[i];
+    }
+    *divisor = valid_samples - (2U * trimmed);
+    return sum;
+  }
+  case NtcSamplingStrategy::Mean:
+  default:
+    *divisor = valid_samples;
+    return count_sum;
+  }
+}
 
-    if (successful_samples == 0) {
-      return NtcError::AdcReadFailed;
+template <typename AdcType>
+bool NtcThermistor<AdcType>::keepsSampleCounts() const noexcept {
+  return config_.sampling_strategy == NtcSamplingStrategy::Median ||
+         config_.sampling_strategy == NtcSamplingStrategy::TrimmedMean;
+}
+
+template <typename AdcType>
+bool NtcThermistor<AdcType>::isUnchangedReading(
+    const ntc_adc_sample_t &sample) noexcept {
+  if (config_.report_deadband_counts == 0U || !reported_valid_) {
+    return false;
+  }
+
+  const uint32_t change = (sample.raw_count > reported_count_)
+                              ? sample.raw_count - reported_count_
+                              : reported_count_ - sample.raw_count;
+  if (change >= config_.report_deadband_counts) {
+    return false;
+  }
+
+#if NTC_ENABLE_STATS
+  stats_.unchanged_readings++;
+#endif
+  return true;
+}
+
+template <typename AdcType>
+NtcError NtcThermistor<AdcType>::completeReading(
+    const ntc_adc_sample_t &sample, NtcError acquire_error,
+    ntc_reading_t *reading) noexcept {
+  reading->timestamp_us = sample.timestamp_us;
+  reading->is_valid = false;
+  reading->accuracy_celsius = 0.5F; // Estimate based on typical NTC accuracy
+  reading->adc_conversions = sample.conversions;
+
+  NtcError error = acquire_error;
+  if (error == NtcError::Success) {
+    float resistance_ohms = 0.0F;
+    float temperature_celsius = 0.0F;
+    error = convertSample(sample, &resistance_ohms, &temperature_celsius);
+
+    if (error == NtcError::Success) {
+      reading->temperature_celsius = temperature_celsius;
+      reading->temperature_fahrenheit =
+          CelsiusToFahrenheit(temperature_celsius);
+      reading->temperature_kelvin = CelsiusToKelvin(temperature_celsius);
+      reading->resistance_ohms = resistance_ohms;
+      reading->voltage_volts = sample.voltage_volts;
+      reading->adc_raw_value = sample.raw_count;
+      reading->is_valid = true;
+      recordHistory(temperature_celsius, reading->timestamp_us);
     }
+  }
 
-    *voltage_volts = sum / static_cast<float>(successful_samples);
-    return NtcError::Success;
-  } // Single sample
-  float sample_voltage = 0.0F;
-  ntc::AdcError err =
-      adc_interface_->ReadChannelV(config_.adc_channel, &sample_voltage);
-  if (err != ntc::AdcError::Success) {
-    return convert_error(err);
+  reading->error = error;
+  reported_count_ = sample.raw_count;
+  reported_valid_ = reading->is_valid;
+  if (snapshot_ != nullptr) {
+    snapshot_->Publish(*reading);
+  }
+  return error;
+}
+
+template <typename AdcType>
+NtcError NtcThermistor<AdcType>::convertSample(
+    const ntc_adc_sample_t &sample, float *resistance_ohms,
+    float *temperature_celsius) noexcept {
+  if (temperature_celsius == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  // A deferred setup is built here, outside the conversion timing
+  ensureConversionMethod();
+
+  const uint32_t start_cycles = statsCycles();
+
+  // Resistance is only needed by the ADC count table path when the caller
+  // asks for it
+  float raw_temperature = 0.0F;
+  const bool from_count_table =
+      active_method_ == NtcConversionMethod::AdcCountTable &&
+      lookupAdcCountTable(sample.count_q, &raw_temperature);
+  if (from_count_table) {
+    statsRecordPath(StatsPath::TableHit);
+  }
+
+  if (!from_count_table || resistance_ohms != nullptr) {
+    float resistance = 0.0F;
+    NtcError resistance_error =
+        calculateResistance(sample.voltage_volts, &resistance);
+    if (resistance_error != NtcError::Success) {
+      statsRecordPath(StatsPath::Failure);
+      return resistance_error;
+    }
+    if (resistance_ohms != nullptr) {
+      *resistance_ohms = resistance;
+    }
+
+    // Convert resistance to temperature
+    if (!from_count_table) {
+      NtcError conversion_error =
+          convertResistanceToTemperature(resistance, &raw_temperature);
+      if (conversion_error != NtcError::Success) {
+        return conversion_error;
+      }
+    }
+  }
+
+  // Apply calibration offset
+  *temperature_celsius = raw_temperature + config_.calibration_offset;
+
+  // Apply filtering if enabled
+  if (config_.enable_filtering) {
+    *temperature_celsius =
+        applyFiltering(*temperature_celsius, sample.timestamp_us);
   }
-  *voltage_volts = sample_voltage;
+
+  statsRecordStage(StatsStage::Conversion, start_cycles);
+
+  // Validate temperature range
+  if (!NTC::ValidateTemperature(*temperature_celsius, config_.min_temperature,
+                                config_.max_temperature)) {
+    statsRecordPath(StatsPath::OutOfRange);
+    return NtcError::TemperatureOutOfRange;
+  }
+
   return NtcError::Success;
 }
 
+template <typename AdcType>
+float NtcThermistor<AdcType>::countToVoltage(float raw_count) const noexcept {
+  // Ratiometric divider: ADC full scale corresponds to the reference voltage
+  return raw_count * context_.volts_per_count;
+}
+
 template <typename AdcType>
 NtcError
 NtcThermistor<AdcType>::calculateResistance(float voltage_volts,
@@ -749,29 +1406,92 @@ NtcError NtcThermistor<AdcType>::convertResistanceToTemperature(
     return NtcError::NullPointer;
   }
 
-  // Choose conversion method
-  switch (config_.conversion_method) {
+  bool table_hit = false;
+  if (!convertResistanceWith(active_method_, resistance_ohms,
+                             temperature_celsius, &table_hit)) {
+    statsRecordPath(StatsPath::Failure);
+    return NtcError::ConversionFailed;
+  }
+
+  const bool table_method =
+      active_method_ == NtcConversionMethod::LookupTable ||
+      active_method_ == NtcConversionMethod::AdcCountTable;
+  statsRecordPath(table_hit      ? StatsPath::TableHit
+                  : table_method ? StatsPath::TableFallback
+                                 : StatsPath::Equation);
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+bool NtcThermistor<AdcType>::convertResistanceWith(
+    NtcConversionMethod method, float resistance_ohms,
+    float *temperature_celsius, bool *table_hit) const noexcept {
+  switch (method) {
   case NtcConversionMethod::LookupTable: {
-    const NTC::ntc_lookup_table_t *table =
-        NTC::GetNtcLookupTable(static_cast<int>(config_.type));
-    if (table != nullptr && FindTemperatureFromLookupTable(
-                                table, resistance_ohms, temperature_celsius)) {
-      return NtcError::Success;
+    if (NTC::FindTemperatureFromLookupTable(lookup_table_, resistance_ohms,
+                                            temperature_celsius)) {
+      if (table_hit != nullptr) {
+        *table_hit = true;
+      }
+      return true;
     }
     // Fall back to mathematical conversion if lookup fails
     break;
   }
 
+  case NtcConversionMethod::SteinhartHart: {
+    if (!context_.steinhart_hart_valid) {
+      break;
+    }
+    return config_.enable_fast_log
+               ? NTC::ConvertResistanceToTemperatureSteinhartHartFast(
+                     resistance_ohms, context_.steinhart_hart_a,
+                     context_.steinhart_hart_b, context_.steinhart_hart_c,
+                     temperature_celsius)
+               : NTC::ConvertResistanceToTemperatureSteinhartHart(
+                     resistance_ohms, context_.steinhart_hart_a,
+                     context_.steinhart_hart_b, context_.steinhart_hart_c,
+                     temperature_celsius);
+  }
+
   case NtcConversionMethod::Mathematical:
   case NtcConversionMethod::Auto:
+  case NtcConversionMethod::AdcCountTable:
   default:
     break;
   }
 
   // Use mathematical conversion (beta parameter)
-  if (!NTC::ConvertResistanceToTemperatureBeta(
-          resistance_ohms, config_.resistance_at_25c, config_.beta_value,
-          temperature_celsius)) {
+  return convertResistanceBeta(resistance_ohms, temperature_celsius);
+}
+
+template <typename AdcType>
+NtcError NtcThermistor<AdcType>::convertTemperatureToResistance(
+    float temperature_celsius, float *resistance_ohms) const noexcept {
+  if (resistance_ohms == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  // Mirror convertResistanceToTemperature() so thresholds match readings
+  if (active_method_ == NtcConversionMethod::LookupTable &&
+      NTC::FindResistanceFromLookupTable(lookup_table_, temperature_celsius,
+                                         resistance_ohms)) {
+    return NtcError::Success;
+  }
+
+  if (active_method_ == NtcConversionMethod::SteinhartHart) {
+    return NTC::ConvertTemperatureToResistanceSteinhartHart(
+               temperature_celsius, context_.steinhart_hart_a,
+               context_.steinhart_hart_b, context_.steinhart_hart_c,
+               resistance_ohms)
+               ? NtcError::Success
+               : NtcError::ConversionFailed;
+  }
+
+  // Use mathematical conversion (beta parameter)
+  if (!NTC::ConvertTemperatureToResistanceBeta(
+          temperature_celsius, config_.resistance_at_25c, config_.beta_value,
+          resistance_ohms)) {
     return NtcError::ConversionFailed;
   }
 
@@ -779,17 +1499,591 @@ NtcError NtcThermistor<AdcType>::convertResistanceToTemperature(
 }
 
 template <typename AdcType>
-float NtcThermistor<AdcType>::applyFiltering(float new_temperature) noexcept {
+void NtcThermistor<AdcType>::updateConversionContext() noexcept {
+  // Invalid parameters are rejected by ValidateConfiguration(); keep the
+  // constants finite until then
+  constexpr uint32_t MAX_ADC_RESOLUTION_BITS_ = 32U;
+  const bool resolution_valid =
+      config_.adc_resolution_bits > 0U &&
+      config_.adc_resolution_bits <= MAX_ADC_RESOLUTION_BITS_;
+  context_.volts_per_count =
+      resolution_valid
+          ? config_.reference_voltage /
+                static_cast<float>((1ULL << config_.adc_resolution_bits) -
+                                   1ULL)
+          : ZERO_FLOAT_;
+  context_.inverse_resistance_at_25c =
+      (config_.resistance_at_25c > ZERO_FLOAT_)
+          ? ONE_FLOAT_ / config_.resistance_at_25c
+          : ZERO_FLOAT_;
+  context_.inverse_beta_value =
+      (config_.beta_value > ZERO_FLOAT_) ? ONE_FLOAT_ / config_.beta_value
+                                         : ZERO_FLOAT_;
+
+  // Steinhart-Hart: configured coefficients, or a three-point fit at the
+  // ends and middle of the operating range (clamped to the lookup table)
+  context_.steinhart_hart_a = config_.steinhart_hart_a;
+  context_.steinhart_hart_b = config_.steinhart_hart_b;
+  context_.steinhart_hart_c = config_.steinhart_hart_c;
+  if (context_.steinhart_hart_a == ZERO_FLOAT_ &&
+      context_.steinhart_hart_b == ZERO_FLOAT_ &&
+      context_.steinhart_hart_c == ZERO_FLOAT_) {
+    float low_celsius = config_.min_temperature;
+    float high_celsius = config_.max_temperature;
+    if (lookup_table_.IsValid()) {
+      low_celsius = std::max(low_celsius, lookup_table_->min_temperature);
+      high_celsius = std::min(high_celsius, lookup_table_->max_temperature);
+    }
+    const std::array<float, 3> temperatures = {
+        low_celsius, 0.5F * (low_celsius + high_celsius), high_celsius};
+    std::array<float, 3> resistances = {};
+    bool resistances_valid = low_celsius < high_celsius;
+    for (size_t i = 0; i < temperatures.size() && resistances_valid; ++i) {
+      resistances_valid =
+          lookup_table_.IsValid()
+              ? NTC::FindResistanceFromLookupTable(
+                    lookup_table_, temperatures[i], &resistances[i])
+              : NTC::ConvertTemperatureToResistanceBeta(
+                    temperatures[i], config_.resistance_at_25c,
+                    config_.beta_value, &resistances[i]);
+    }
+    context_.steinhart_hart_valid =
+        resistances_valid &&
+        NTC::CalculateSteinhartHartCoefficients(
+            temperatures[0], resistances[0], temperatures[1], resistances[1],
+            temperatures[2], resistances[2], &context_.steinhart_hart_a,
+            &context_.steinhart_hart_b, &context_.steinhart_hart_c);
+  } else {
+    context_.steinhart_hart_valid = NTC::ValidateSteinhartHartCoefficients(
+        context_.steinhart_hart_a, context_.steinhart_hart_b,
+        context_.steinhart_hart_c);
+  }
+}
+
+template <typename AdcType>
+bool NtcThermistor<AdcType>::convertResistanceBeta(
+    float resistance_ohms, float *temperature_celsius) const noexcept {
+  if (!NTC::ValidateResistance(resistance_ohms,
+                               NTC::Constants::MIN_RESISTANCE_OHMS_,
+                               NTC::Constants::MAX_RESISTANCE_OHMS_)) {
+    return false;
+  }
+
+  // Beta equation: 1/T = 1/T0 + (1/β) * ln(R/R0)
+  constexpr float INVERSE_REFERENCE_KELVIN_ =
+      ONE_FLOAT_ / (NTC::Constants::REFERENCE_TEMPERATURE_C_ + KELVIN_OFFSET_);
+  const float ratio = resistance_ohms * context_.inverse_resistance_at_25c;
+  const float ln_ratio =
+      config_.enable_fast_log ? NTC::FastLog(ratio) : std::log(ratio);
+  const float inverse_kelvin =
+      INVERSE_REFERENCE_KELVIN_ + (ln_ratio * context_.inverse_beta_value);
+  if (inverse_kelvin <= ZERO_FLOAT_) {
+    return false;
+  }
+
+  *temperature_celsius = (ONE_FLOAT_ / inverse_kelvin) - KELVIN_OFFSET_;
+  return true;
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::recordHistory(float temperature_celsius,
+                                           uint64_t timestamp_us) noexcept {
+  if (history_ != nullptr) {
+    history_push_(history_, temperature_celsius, timestamp_us);
+  }
+}
+
+template <typename AdcType>
+uint32_t NtcThermistor<AdcType>::statsCycles() const noexcept {
+#if NTC_ENABLE_STATS
+  if constexpr (ntc::HasReadCycleCounter<AdcType>::value) {
+    if (adc_interface_ != nullptr) {
+      return adc_interface_->ReadCycleCounter();
+    }
+  }
+#endif
+  return 0U;
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::statsRecordStage(StatsStage stage,
+                                              uint32_t start_cycles) noexcept {
+  // Unsigned subtraction handles counter wrap-around
+  statsRecordCycles(stage, statsCycles() - start_cycles);
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::statsRecordCycles(StatsStage stage,
+                                               uint32_t cycles) noexcept {
+#if NTC_ENABLE_STATS
+  ntc_stage_stats_t &entry = (stage == StatsStage::Acquisition)
+                                 ? stats_.acquisition
+                                 : stats_.conversion;
+  if (entry.samples == 0U || cycles < entry.min_cycles) {
+    entry.min_cycles = cycles;
+  }
+  entry.max_cycles = std::max(entry.max_cycles, cycles);
+  entry.total_cycles += cycles;
+  entry.samples++;
+#else
+  (void)stage;
+  (void)cycles;
+#endif
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::statsRecordSample(
+    const ntc_adc_sample_t &sample) noexcept {
+#if NTC_ENABLE_STATS
+  stats_.adc_conversions += sample.conversions;
+  stats_.failed_samples += sample.conversions - sample.valid_samples;
+#else
+  (void)sample;
+#endif
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::statsRecordPath(StatsPath path) noexcept {
+#if NTC_ENABLE_STATS
+  switch (path) {
+  case StatsPath::TableHit:
+    stats_.table_hits++;
+    break;
+  case StatsPath::TableFallback:
+    stats_.table_fallbacks++;
+    break;
+  case StatsPath::Equation:
+    stats_.equation_conversions++;
+    break;
+  case StatsPath::Failure:
+    stats_.conversion_failures++;
+    break;
+  case StatsPath::OutOfRange:
+  default:
+    stats_.out_of_range++;
+    break;
+  }
+#else
+  (void)path;
+#endif
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::updateLookupTable() noexcept {
+  lookup_table_ =
+      attached_lookup_table_.IsValid()
+          ? attached_lookup_table_
+          : NTC::ValidatedLookupTable(
+                NTC::GetNtcLookupTable(static_cast<int>(config_.type)));
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::updateAdcCountTable() noexcept {
+  adc_count_table_valid_ = false;
+
+  if ((config_.conversion_method != NtcConversionMethod::AdcCountTable &&
+       config_.conversion_method != NtcConversionMethod::Auto) ||
+      NTC::Acquisition::ValidateConfiguration(config_) != NtcError::Success) {
+    return;
+  }
+
+  adc_count_table_shift_ =
+      NTC::Acquisition::CountTableShift(config_.adc_resolution_bits);
+  const auto convert = [this](float count,
+                              float *temperature_celsius) noexcept {
+    float resistance_ohms = 0.0F;
+    return NTC::CalculateThermistorResistance(
+               countToVoltage(count), config_.reference_voltage,
+               config_.series_resistance, &resistance_ohms) &&
+           NTC::ConvertResistanceToTemperatureBeta(
+               resistance_ohms, config_.resistance_at_25c, config_.beta_value,
+               temperature_celsius);
+  };
+  NTC::Acquisition::FillCountTable(adc_count_table_shift_, convert,
+                                   &adc_count_table_);
+
+  adc_count_table_valid_ = true;
+}
+
+template <typename AdcType>
+bool NtcThermistor<AdcType>::lookupAdcCountTable(
+    uint64_t count_q, float *temperature_celsius) const noexcept {
+  if (!adc_count_table_valid_) {
+    return false;
+  }
+
+  int32_t centi_degrees = 0;
+  if (!NTC::Acquisition::InterpolateCountTable(
+          adc_count_table_,
+          adc_count_table_shift_ + NTC::Acquisition::COUNT_FRACTION_BITS_,
+          count_q, &centi_degrees)) {
+    return false;
+  }
+
+  constexpr float DEGREES_PER_CENTI_DEGREE_ = 0.01F;
+  *temperature_celsius =
+      static_cast<float>(centi_degrees) * DEGREES_PER_CENTI_DEGREE_;
+  return true;
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::updateConversionMethod() noexcept {
+  // Counts map to different temperatures now: report the next reading
+  reported_valid_ = false;
+  if (config_.defer_conversion_setup) {
+    conversion_pending_ = true;
+    return;
+  }
+  buildConversionMethod();
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::ensureConversionMethod() noexcept {
+  if (conversion_pending_) {
+    buildConversionMethod();
+  }
+}
+
+template <typename AdcType>
+void NtcThermistor<AdcType>::buildConversionMethod() noexcept {
+  conversion_pending_ = false;
+  updateAdcCountTable();
+
+  const bool lookup_available = lookup_table_.IsValid();
+  const auto available = [&](NtcConversionMethod method) noexcept {
+    switch (method) {
+    case NtcConversionMethod::AdcCountTable:
+      return adc_count_table_valid_;
+    case NtcConversionMethod::LookupTable:
+      return lookup_available;
+    case NtcConversionMethod::SteinhartHart:
+      return context_.steinhart_hart_valid;
+    case NtcConversionMethod::Mathematical:
+      return true;
+    case NtcConversionMethod::Auto:
+    default:
+      return false;
+    }
+  };
+
+  NtcConversionMethod selected = NtcConversionMethod::Mathematical;
+  float selected_error = ZERO_FLOAT_;
+  bool error_measured = true;
+  if (config_.conversion_method != NtcConversionMethod::Auto) {
+    if (available(config_.conversion_method)) {
+      selected = config_.conversion_method;
+    }
+    // Nothing to choose: leave the error sweep to GetConversionReport()
+    error_measured = false;
+  } else {
+    // Cheapest first; the first candidate within both budgets wins,
+    // otherwise the most accurate one within the cost budget
+    constexpr NtcConversionMethod CANDIDATES_[] = {
+        NtcConversionMethod::AdcCountTable, NtcConversionMethod::LookupTable,
+        NtcConversionMethod::Mathematical, NtcConversionMethod::SteinhartHart};
+    bool found = false;
+    bool best_found = false;
+    NtcConversionMethod best = NtcConversionMethod::Mathematical;
+    float best_error = ZERO_FLOAT_;
+    for (const NtcConversionMethod candidate : CANDIDATES_) {
+      if (!available(candidate) ||
+          (config_.auto_max_cost != 0U &&
+           conversionCost(candidate) > config_.auto_max_cost)) {
+        continue;
+      }
+      const float error = measureConversionError(candidate);
+      if (error <= config_.auto_max_error_celsius) {
+        selected = candidate;
+        selected_error = error;
+        found = true;
+        break;
+      }
+      if (!best_found || error < best_error) {
+        best = candidate;
+        best_error = error;
+        best_found = true;
+      }
+    }
+    if (!found) {
+      // Nothing fits the cost budget: fall back to the cheapest method
+      selected = best_found ? best
+                            : (adc_count_table_valid_
+                                   ? NtcConversionMethod::AdcCountTable
+                                   : NtcConversionMethod::Mathematical);
+      selected_error =
+          best_found ? best_error : measureConversionError(selected);
+    }
+  }
+
+  active_method_ = selected;
+  conversion_report_.method = selected;
+  conversion_report_.max_error_celsius = selected_error;
+  conversion_report_.cost = conversionCost(selected);
+  conversion_error_measured_ = error_measured;
+}
+
+template <typename AdcType>
+float NtcThermistor<AdcType>::activeConversionError() const noexcept {
+  return conversion_error_measured_ ? conversion_report_.max_error_celsius
+                                    : measureConversionError(active_method_);
+}
+
+template <typename AdcType>
+float NtcThermistor<AdcType>::measureConversionError(
+    NtcConversionMethod method) const noexcept {
+  if (NTC::Acquisition::ValidateConfiguration(config_) != NtcError::Success) {
+    return ZERO_FLOAT_;
+  }
+
+  // Reference model: explicit Steinhart-Hart coefficients, the lookup table
+  // (measured data) or the Beta equation, always with the exact logarithm
+  const bool explicit_steinhart_hart =
+      context_.steinhart_hart_valid &&
+      (config_.steinhart_hart_a != ZERO_FLOAT_ ||
+       config_.steinhart_hart_b != ZERO_FLOAT_ ||
+       config_.steinhart_hart_c != ZERO_FLOAT_);
+  const auto reference = [&](float resistance_ohms,
+                             float *temperature_celsius) noexcept {
+    if (explicit_steinhart_hart) {
+      return NTC::ConvertResistanceToTemperatureSteinhartHart(
+          resistance_ohms, context_.steinhart_hart_a,
+          context_.steinhart_hart_b, context_.steinhart_hart_c,
+          temperature_celsius);
+    }
+    if (lookup_table_.IsValid()) {
+      return NTC::FindTemperatureFromLookupTable(
+          lookup_table_, resistance_ohms, temperature_celsius);
+    }
+    return NTC::ConvertResistanceToTemperatureBeta(
+        resistance_ohms, config_.resistance_at_25c, config_.beta_value,
+        temperature_celsius);
+  };
+
+  // Evaluate 4 counts per ADC count table segment across the ADC range, in
+  // fixed point so averaged counts between whole counts are covered too
+  constexpr uint64_t ERROR_POINTS_ =
+      NTC::Acquisition::COUNT_TABLE_SEGMENTS_ * 4U;
+  constexpr float COUNT_SCALE_ =
+      1.0F / static_cast<float>(1U << NTC::Acquisition::COUNT_FRACTION_BITS_);
+  const uint64_t full_scale_q = ((1ULL << config_.adc_resolution_bits) - 1ULL)
+                                << NTC::Acquisition::COUNT_FRACTION_BITS_;
+  // An odd step lands between whole counts
+  const uint64_t step_q = (full_scale_q / ERROR_POINTS_) | 1ULL;
+
+  float max_error = ZERO_FLOAT_;
+  for (uint64_t count_q = step_q; count_q < full_scale_q; count_q += step_q) {
+    const float voltage =
+        countToVoltage(static_cast<float>(count_q) * COUNT_SCALE_);
+    float resistance_ohms = 0.0F;
+    float expected = 0.0F;
+    if (!NTC::CalculateThermistorResistance(
+            voltage, config_.reference_voltage, config_.series_resistance,
+            &resistance_ohms) ||
+        !reference(resistance_ohms, &expected) ||
+        !NTC::ValidateTemperature(expected, config_.min_temperature,
+                                  config_.max_temperature)) {
+      continue;
+    }
+
+    float actual = 0.0F;
+    const bool converted =
+        (method == NtcConversionMethod::AdcCountTable &&
+         lookupAdcCountTable(count_q, &actual)) ||
+        convertResistanceWith(method, resistance_ohms, &actual);
+    if (converted) {
+      max_error = std::max(max_error, std::abs(actual - expected));
+    }
+  }
+
+  return max_error;
+}
+
+template <typename AdcType>
+uint32_t NtcThermistor<AdcType>::conversionCost(
+    NtcConversionMethod method) const noexcept {
+  switch (method) {
+  case NtcConversionMethod::AdcCountTable:
+    return NTC::ConversionCost::ADC_COUNT_TABLE_;
+  case NtcConversionMethod::LookupTable:
+    return NTC::ConversionCost::LOOKUP_TABLE_;
+  case NtcConversionMethod::SteinhartHart:
+    return config_.enable_fast_log
+               ? NTC::ConversionCost::STEINHART_HART_FAST_LOG_
+               : NTC::ConversionCost::STEINHART_HART_;
+  case NtcConversionMethod::Mathematical:
+  case NtcConversionMethod::Auto:
+  default:
+    return config_.enable_fast_log ? NTC::ConversionCost::BETA_FAST_LOG_
+                                   : NTC::ConversionCost::BETA_;
+  }
+}
+
+template <typename AdcType>
+uint32_t NtcThermistor<AdcType>::stateFingerprint() const noexcept {
+  // Field by field, hashing the little-endian bytes the blob uses, so the
+  // fingerprint is the same on either byte order (and padding is skipped)
+  uint32_t hash = HASH_OFFSET_BASIS_;
+  const auto mix = [&hash](auto value) noexcept {
+    std::array<uint8_t, sizeof(uint32_t)> bytes = {};
+    if constexpr (std::is_enum_v<decltype(value)>) {
+      (void)putState(bytes.data(), bytes.data() + bytes.size(),
+                     static_cast<std::underlying_type_t<decltype(value)>>(
+                         value));
+    } else {
+      (void)putState(bytes.data(), bytes.data() + bytes.size(), value);
+    }
+    hash = hashBytes(hash, bytes.data(), sizeof(value));
+  };
+  mix(config_.type);
+  mix(config_.resistance_at_25c);
+  mix(config_.beta_value);
+  mix(config_.reference_voltage);
+  mix(config_.series_resistance);
+  mix(config_.conversion_method);
+  mix(config_.adc_resolution_bits);
+  mix(config_.min_temperature);
+  mix(config_.max_temperature);
+  mix(config_.enable_filtering);
+  mix(config_.filter_alpha);
+  mix(config_.filter_mode);
+  mix(config_.filter_time_constant_s);
+  mix(config_.filter_process_noise);
+  mix(config_.filter_measurement_noise);
+  mix(config_.filter_sample_period_s);
+  mix(config_.enable_fast_log);
+  mix(config_.steinhart_hart_a);
+  mix(config_.steinhart_hart_b);
+  mix(config_.steinhart_hart_c);
+  mix(config_.auto_max_error_celsius);
+  mix(config_.auto_max_cost);
+
+  // The table the method was measured against, entry by entry: another
+  // table with the same extent must not restore a stale setup
+  const bool lookup_available = lookup_table_.IsValid();
+  mix(lookup_available);
+  if (lookup_available) {
+    mix(static_cast<uint32_t>(lookup_table_->entry_count));
+    for (size_t i = 0; i < lookup_table_->entry_count; ++i) {
+      NTC::ntc_lookup_entry_t entry = {};
+      (void)NTC::GetLookupTableEntry(lookup_table_.Get(), i, &entry);
+      mix(entry.resistance_ohms);
+      mix(entry.temperature_celsius);
+    }
+  }
+  return hash;
+}
+
+template <typename AdcType>
+uint32_t NtcThermistor<AdcType>::hashBytes(uint32_t hash, const void *data,
+                                           size_t size) noexcept {
+  const auto *bytes = static_cast<const uint8_t *>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * HASH_PRIME_;
+  }
+  return hash;
+}
+
+/// Unsigned integer with the size of T, for byte-order independent access
+template <typename T>
+using NtcStateBits = std::conditional_t<
+    sizeof(T) == 1U, uint8_t,
+    std::conditional_t<sizeof(T) == 2U, uint16_t,
+                       std::conditional_t<sizeof(T) == 4U, uint32_t, void>>>;
+
+template <typename AdcType>
+template <typename T>
+uint8_t *NtcThermistor<AdcType>::putState(uint8_t *out, const uint8_t *end,
+                                          T value) noexcept {
+  static_assert(std::is_arithmetic_v<T> && sizeof(T) <= sizeof(uint32_t),
+                "State fields are integers or floats up to 32 bits");
+  if (out == nullptr || static_cast<size_t>(end - out) < sizeof(T)) {
+    return nullptr;
+  }
+
+  NtcStateBits<T> bits = 0U;
+  std::memcpy(&bits, &value, sizeof(T));
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    out[i] = static_cast<uint8_t>(bits >> (8U * i));
+  }
+  return out + sizeof(T);
+}
+
+template <typename AdcType>
+template <typename T>
+const uint8_t *NtcThermistor<AdcType>::getState(const uint8_t *in,
+                                                const uint8_t *end,
+                                                T *value) noexcept {
+  static_assert(std::is_arithmetic_v<T> && sizeof(T) <= sizeof(uint32_t),
+                "State fields are integers or floats up to 32 bits");
+  if (in == nullptr || static_cast<size_t>(end - in) < sizeof(T)) {
+    return nullptr;
+  }
+
+  uint32_t bits = 0U;
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    bits |= static_cast<uint32_t>(in[i]) << (8U * i);
+  }
+  const auto narrowed = static_cast<NtcStateBits<T>>(bits);
+  std::memcpy(value, &narrowed, sizeof(T));
+  return in + sizeof(T);
+}
+
+template <typename AdcType>
+float NtcThermistor<AdcType>::applyFiltering(float new_temperature,
+                                             uint64_t timestamp_us) noexcept {
   if (!config_.enable_filtering) {
     return new_temperature;
   }
 
   if (!filter_initialized_) {
     filtered_temperature_ = new_temperature;
+    filter_lead_ = ZERO_FLOAT_;
+    filter_variance_ = config_.filter_measurement_noise;
+    filter_timestamp_us_ = timestamp_us;
     filter_initialized_ = true;
     return new_temperature;
   }
 
+  const float time_step_s = filterTimeStep(timestamp_us);
+  filter_timestamp_us_ = timestamp_us;
+
+  switch (config_.filter_mode) {
+  case NtcFilterMode::ThermalLag: {
+    // The sensor closes 1 - e^(-dt/tau) of the gap to the true temperature
+    // per step, so the true temperature is the previous reading plus the
+    // smoothed change scaled by the reciprocal. The lead is held while the
+    // clock does not advance.
+    const float previous = filtered_temperature_;
+    filtered_temperature_ =
+        (config_.filter_alpha * new_temperature) +
+        ((ONE_FLOAT_ - config_.filter_alpha) * filtered_temperature_);
+    if (time_step_s > ZERO_FLOAT_) {
+      const float response =
+          ONE_FLOAT_ -
+          std::exp(-time_step_s / config_.filter_time_constant_s);
+      const float lead = (filtered_temperature_ - previous) *
+                         ((ONE_FLOAT_ / response) - ONE_FLOAT_);
+      filter_lead_ = (config_.filter_alpha * lead) +
+                     ((ONE_FLOAT_ - config_.filter_alpha) * filter_lead_);
+    }
+    return filtered_temperature_ + filter_lead_;
+  }
+  case NtcFilterMode::Kalman: {
+    // Random walk: the estimate grows uncertain with time, then the gain
+    // weighs the reading against it
+    filter_variance_ += config_.filter_process_noise * time_step_s;
+    const float gain =
+        filter_variance_ /
+        (filter_variance_ + config_.filter_measurement_noise);
+    filtered_temperature_ += gain * (new_temperature - filtered_temperature_);
+    filter_variance_ *= ONE_FLOAT_ - gain;
+    return filtered_temperature_;
+  }
+  case NtcFilterMode::Ema:
+  default:
+    break;
+  }
+
   // Apply exponential moving average
   filtered_temperature_ =
       (config_.filter_alpha * new_temperature) +
@@ -798,6 +2092,29 @@ float NtcThermistor<AdcType>::applyFiltering(float new_temperature) noexcept {
   return filtered_temperature_;
 }
 
+template <typename AdcType>
+float NtcThermistor<AdcType>::filterTimeStep(uint64_t timestamp_us) const
+    noexcept {
+  if (timestamp_us == 0U || filter_timestamp_us_ == 0U) {
+    return config_.filter_sample_period_s; // No clock: nominal period
+  }
+
+  if (timestamp_us <= filter_timestamp_us_) {
+    return ZERO_FLOAT_;
+  }
+
+  return static_cast<float>(timestamp_us - filter_timestamp_us_) /
+         MICROSECONDS_PER_SECOND_;
+}
+
+template <typename AdcType>
+bool NtcThermistor<AdcType>::hasFilterTimeBase(
+    const ntc_config_t &config) noexcept {
+  return config.filter_mode == NtcFilterMode::Ema ||
+         ntc::HasReadTimestampUs<AdcType>::value ||
+         config.filter_sample_period_s > ZERO_FLOAT_;
+}
+
 template <typename AdcType>
 void NtcThermistor<AdcType>::initializeConfigForType(
     NtcType ntc_type, ntc_config_t *config) noexcept {
@@ -0,0 +1,421 @@
+/**
+ * @file ntc_thermistor_array.cpp
+ * @brief Multi-channel NTC thermistor driver implementation.
+ *
+ * This file contains the implementation of the NtcThermistorArray class that
+ * scans and converts several thermistors sharing one ADC.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ *
+ * @note This file is included by ntc_thermistor_array.hpp for template
+ *       instantiation. It should not be compiled separately when included.
+ */
+
+#ifndef NTC_THERMISTOR_ARRAY_IMPL
+#define NTC_THERMISTOR_ARRAY_IMPL
+
+// When included from header, use relative path; when compiled directly, use
+// standard include
+#ifdef NTC_THERMISTOR_ARRAY_HEADER_INCLUDED
+#include "../inc/ntc_acquisition.hpp"
+#include "../inc/ntc_conversion.hpp"
+#include "../inc/ntc_thermistor_array.hpp"
+#else
+#include "ntc_acquisition.hpp"
+#include "ntc_conversion.hpp"
+#include "ntc_thermistor_array.hpp"
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+//--------------------------------------
+//  CONSTRUCTORS
+//--------------------------------------
+
+template <typename AdcType, size_t ChannelCount>
+NtcThermistorArray<AdcType, ChannelCount>::NtcThermistorArray(
+    const ntc_config_t &config,
+    const std::array<ntc_channel_config_t, ChannelCount> &channels,
+    AdcType *adc_interface) noexcept
+    : config_(config), adc_interface_(adc_interface), initialized_(false),
+      adc_channels_(), resistance_at_25c_(), beta_values_(),
+      series_resistances_(), calibration_offsets_(), inverse_beta_values_(),
+      log_series_ratios_(), filtered_temperatures_(),
+      filter_initialized_mask_(0U), scan_counts_(), count_sums_(),
+      mean_counts_(), last_adc_conversions_(0U), last_scan_timestamp_us_(0U) {
+  for (size_t i = 0; i < ChannelCount; ++i) {
+    storeChannel(i, channels[i]);
+  }
+}
+
+//--------------------------------------
+//  INITIALIZATION
+//--------------------------------------
+
+template <typename AdcType, size_t ChannelCount>
+bool NtcThermistorArray<AdcType, ChannelCount>::Initialize() noexcept {
+  if (initialized_) {
+    return true;
+  }
+
+  // Validate shared configuration
+  if (NTC::Acquisition::ValidateConfiguration(config_) != NtcError::Success) {
+    return false;
+  }
+
+  // Scans are averaged per channel
+  if (config_.sampling_strategy != NtcSamplingStrategy::Mean) {
+    return false;
+  }
+
+  // Per-channel filter state is a moving average only
+  if (config_.enable_filtering && config_.filter_mode != NtcFilterMode::Ema) {
+    return false;
+  }
+
+  // Validate ADC interface
+  if (adc_interface_ == nullptr) {
+    return false;
+  }
+
+  // Initialize ADC interface if needed
+  if (!adc_interface_->IsInitialized()) {
+    if (!adc_interface_->EnsureInitialized()) {
+      return false;
+    }
+  }
+
+  // Validate channels
+  for (size_t i = 0; i < ChannelCount; ++i) {
+    const ntc_channel_config_t channel = {
+        .adc_channel = adc_channels_[i],
+        .resistance_at_25c = resistance_at_25c_[i],
+        .beta_value = beta_values_[i],
+        .series_resistance = series_resistances_[i],
+        .calibration_offset = calibration_offsets_[i]};
+    if (validateChannel(channel) != NtcError::Success ||
+        !adc_interface_->IsChannelAvailable(adc_channels_[i])) {
+      return false;
+    }
+  }
+
+  // Reset filters
+  filter_initialized_mask_ = 0U;
+  filtered_temperatures_.fill(0.0F);
+
+  initialized_ = true;
+  return true;
+}
+
+template <typename AdcType, size_t ChannelCount>
+bool NtcThermistorArray<AdcType, ChannelCount>::Deinitialize() noexcept {
+  if (!initialized_) {
+    return true;
+  }
+
+  initialized_ = false;
+  return true;
+}
+
+template <typename AdcType, size_t ChannelCount>
+bool NtcThermistorArray<AdcType, ChannelCount>::IsInitialized()
+    const noexcept {
+  return initialized_;
+}
+
+//--------------------------------------
+//  TEMPERATURE READING
+//--------------------------------------
+
+template <typename AdcType, size_t ChannelCount>
+NtcError NtcThermistorArray<AdcType, ChannelCount>::ReadTemperaturesCelsius(
+    float *temperatures_celsius, uint32_t *valid_mask) noexcept {
+  if (temperatures_celsius == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (valid_mask != nullptr) {
+    *valid_mask = 0U;
+  }
+
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
+
+  NtcError acquire_error = acquireScans();
+  if (acquire_error != NtcError::Success) {
+    return acquire_error;
+  }
+
+  // Choose the logarithm once per scan, not per channel
+  const uint32_t convertible_mask =
+      config_.enable_fast_log
+          ? convertScans(temperatures_celsius,
+                         [](float x) noexcept { return NTC::FastLog(x); })
+          : convertScans(temperatures_celsius,
+                         [](float x) noexcept { return std::log(x); });
+
+  // Filtering and range validation on the convertible channels
+  uint32_t in_range_mask = 0U;
+  for (size_t i = 0; i < ChannelCount; ++i) {
+    const uint32_t channel_bit = 1UL << i;
+    if ((convertible_mask & channel_bit) == 0U) {
+      continue;
+    }
+
+    if (config_.enable_filtering) {
+      if ((filter_initialized_mask_ & channel_bit) == 0U) {
+        filtered_temperatures_[i] = temperatures_celsius[i];
+        filter_initialized_mask_ |= channel_bit;
+      } else {
+        filtered_temperatures_[i] =
+            (config_.filter_alpha * temperatures_celsius[i]) +
+            ((1.0F - config_.filter_alpha) * filtered_temperatures_[i]);
+      }
+      temperatures_celsius[i] = filtered_temperatures_[i];
+    }
+
+    if (NTC::ValidateTemperature(temperatures_celsius[i],
+                                 config_.min_temperature,
+                                 config_.max_temperature)) {
+      in_range_mask |= channel_bit;
+    }
+  }
+
+  if (valid_mask != nullptr) {
+    *valid_mask = in_range_mask;
+  }
+
+  constexpr uint32_t ALL_CHANNELS_MASK_ =
+      static_cast<uint32_t>((1ULL << ChannelCount) - 1ULL);
+  if (convertible_mask != ALL_CHANNELS_MASK_) {
+    return NtcError::ConversionFailed;
+  }
+  if (in_range_mask != ALL_CHANNELS_MASK_) {
+    return NtcError::TemperatureOutOfRange;
+  }
+
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t ChannelCount>
+NtcError NtcThermistorArray<AdcType, ChannelCount>::GetRawAdcValues(
+    uint32_t *adc_values) noexcept {
+  if (adc_values == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
+
+  NtcError acquire_error = acquireScans();
+  if (acquire_error != NtcError::Success) {
+    return acquire_error;
+  }
+
+  for (size_t i = 0; i < ChannelCount; ++i) {
+    adc_values[i] = static_cast<uint32_t>(mean_counts_[i]);
+  }
+
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t ChannelCount>
+uint32_t NtcThermistorArray<AdcType, ChannelCount>::GetLastAdcConversionCount()
+    const noexcept {
+  return last_adc_conversions_;
+}
+
+template <typename AdcType, size_t ChannelCount>
+uint64_t NtcThermistorArray<AdcType, ChannelCount>::GetLastScanTimestampUs()
+    const noexcept {
+  return last_scan_timestamp_us_;
+}
+
+//--------------------------------------
+//  CHANNEL CONFIGURATION
+//--------------------------------------
+
+template <typename AdcType, size_t ChannelCount>
+NtcError NtcThermistorArray<AdcType, ChannelCount>::SetChannelConfiguration(
+    size_t channel_index, const ntc_channel_config_t &channel) noexcept {
+  if (channel_index >= ChannelCount) {
+    return NtcError::InvalidParameter;
+  }
+
+  NtcError validation_error = validateChannel(channel);
+  if (validation_error != NtcError::Success) {
+    return validation_error;
+  }
+
+  if (initialized_ && !adc_interface_->IsChannelAvailable(channel.adc_channel)) {
+    return NtcError::InvalidParameter;
+  }
+
+  storeChannel(channel_index, channel);
+
+  // The filter state belongs to the previous sensor parameters
+  filter_initialized_mask_ &= ~(1UL << channel_index);
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t ChannelCount>
+NtcError NtcThermistorArray<AdcType, ChannelCount>::GetChannelConfiguration(
+    size_t channel_index, ntc_channel_config_t *channel) const noexcept {
+  if (channel == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (channel_index >= ChannelCount) {
+    return NtcError::InvalidParameter;
+  }
+
+  channel->adc_channel = adc_channels_[channel_index];
+  channel->resistance_at_25c = resistance_at_25c_[channel_index];
+  channel->beta_value = beta_values_[channel_index];
+  channel->series_resistance = series_resistances_[channel_index];
+  channel->calibration_offset = calibration_offsets_[channel_index];
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t ChannelCount>
+NtcError NtcThermistorArray<AdcType, ChannelCount>::SetCalibrationOffset(
+    size_t channel_index, float offset_celsius) noexcept {
+  if (channel_index >= ChannelCount) {
+    return NtcError::InvalidParameter;
+  }
+
+  calibration_offsets_[channel_index] = offset_celsius;
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t ChannelCount>
+NtcError NtcThermistorArray<AdcType, ChannelCount>::GetCalibrationOffset(
+    size_t channel_index, float *offset_celsius) const noexcept {
+  if (offset_celsius == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (channel_index >= ChannelCount) {
+    return NtcError::InvalidParameter;
+  }
+
+  *offset_celsius = calibration_offsets_[channel_index];
+  return NtcError::Success;
+}
+
+//--------------------------------------
+//  PRIVATE HELPER METHODS
+//--------------------------------------
+
+template <typename AdcType, size_t ChannelCount>
+NtcError NtcThermistorArray<AdcType, ChannelCount>::validateChannel(
+    const ntc_channel_config_t &channel) noexcept {
+  if (channel.resistance_at_25c <= 0.0F ||
+      channel.series_resistance <= 0.0F ||
+      !NTC::ValidateBetaValue(channel.beta_value)) {
+    return NtcError::InvalidParameter;
+  }
+
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t ChannelCount>
+void NtcThermistorArray<AdcType, ChannelCount>::storeChannel(
+    size_t channel_index, const ntc_channel_config_t &channel) noexcept {
+  adc_channels_[channel_index] = channel.adc_channel;
+  resistance_at_25c_[channel_index] = channel.resistance_at_25c;
+  beta_values_[channel_index] = channel.beta_value;
+  series_resistances_[channel_index] = channel.series_resistance;
+  calibration_offsets_[channel_index] = channel.calibration_offset;
+
+  // Invalid parameters are rejected by Initialize(); keep the terms finite
+  inverse_beta_values_[channel_index] =
+      (channel.beta_value > 0.0F) ? 1.0F / channel.beta_value : 0.0F;
+  log_series_ratios_[channel_index] =
+      (channel.resistance_at_25c > 0.0F && channel.series_resistance > 0.0F)
+          ? std::log(channel.series_resistance / channel.resistance_at_25c)
+          : 0.0F;
+}
+
+template <typename AdcType, size_t ChannelCount>
+NtcError NtcThermistorArray<AdcType, ChannelCount>::acquireScans() noexcept {
+  if (adc_interface_ == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  const uint64_t start_us = NTC::Acquisition::ReadTimestampUs(adc_interface_);
+  count_sums_.fill(0U);
+  uint32_t valid_scans = 0U;
+  ntc::AdcError last_error = ntc::AdcError::Success;
+
+  NTC::Acquisition::RunPacedReads(
+      config_.sample_count, config_.sample_delay_ms, [&]() noexcept {
+        ntc::AdcError err = adc_interface_->ReadChannelsCount(
+            adc_channels_.data(), scan_counts_.data(), ChannelCount);
+        if (err == ntc::AdcError::Success) {
+          for (size_t i = 0; i < ChannelCount; ++i) {
+            count_sums_[i] += scan_counts_[i];
+          }
+          valid_scans++;
+        } else {
+          last_error = err;
+        }
+      });
+
+  last_adc_conversions_ =
+      config_.sample_count * static_cast<uint32_t>(ChannelCount);
+  last_scan_timestamp_us_ = NTC::Acquisition::WindowMidpointUs(
+      start_us, NTC::Acquisition::ReadTimestampUs(adc_interface_));
+
+  if (valid_scans == 0U) {
+    return NTC::Acquisition::NoValidSampleError(config_.sample_count,
+                                                last_error);
+  }
+
+  const float inverse_scans = 1.0F / static_cast<float>(valid_scans);
+  for (size_t i = 0; i < ChannelCount; ++i) {
+    mean_counts_[i] = static_cast<float>(count_sums_[i]) * inverse_scans;
+  }
+
+  return NtcError::Success;
+}
+
+template <typename AdcType, size_t ChannelCount>
+template <typename LogFn>
+uint32_t NtcThermistorArray<AdcType, ChannelCount>::convertScans(
+    float *temperatures_celsius, LogFn log_fn) const noexcept {
+  // Ratiometric divider, thermistor on the low side:
+  //   R / R25 = (Rs / R25) * c / (FS - c)
+  //   1/T = 1/T0 + ln(R / R25) / beta
+  const float full_scale =
+      static_cast<float>((1ULL << config_.adc_resolution_bits) - 1ULL);
+  const float inverse_reference_kelvin =
+      1.0F / (NTC::Constants::REFERENCE_TEMPERATURE_C_ +
+              NTC::Constants::KELVIN_OFFSET_);
+
+  uint32_t convertible_mask = 0U;
+  for (size_t i = 0; i < ChannelCount; ++i) {
+    const float count = mean_counts_[i];
+    convertible_mask |=
+        static_cast<uint32_t>(count > 0.0F && count < full_scale) << i;
+
+    // Rail counts (open or shorted sensor) are clamped and masked out
+    const float clamped = std::min(std::max(count, 1.0F), full_scale - 1.0F);
+    const float log_ratio =
+        log_fn(clamped / (full_scale - clamped)) + log_series_ratios_[i];
+    const float inverse_kelvin =
+        inverse_reference_kelvin + (inverse_beta_values_[i] * log_ratio);
+    temperatures_celsius[i] = (1.0F / inverse_kelvin) -
+                              NTC::Constants::KELVIN_OFFSET_ +
+                              calibration_offsets_[i];
+  }
+
+  return convertible_mask;
+}
+
+#endif // NTC_THERMISTOR_ARRAY_IMPL
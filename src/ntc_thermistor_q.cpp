@@ -0,0 +1,431 @@
+/**
+ * @file ntc_thermistor_q.cpp
+ * @brief Fixed-point NTC thermistor driver implementation.
+ *
+ * This file contains the implementation of the NtcThermistorQ class that
+ * converts raw ADC counts to centi-degrees Celsius with integer arithmetic.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ *
+ * @note This file is included by ntc_thermistor_q.hpp for template
+ *       instantiation. It should not be compiled separately when included.
+ */
+
+#ifndef NTC_THERMISTOR_Q_IMPL
+#define NTC_THERMISTOR_Q_IMPL
+
+// When included from header, use relative path; when compiled directly, use
+// standard include
+#ifdef NTC_THERMISTOR_Q_HEADER_INCLUDED
+#include "../inc/ntc_acquisition.hpp"
+#include "../inc/ntc_conversion.hpp"
+#include "../inc/ntc_thermistor_q.hpp"
+#else
+#include "ntc_acquisition.hpp"
+#include "ntc_conversion.hpp"
+#include "ntc_thermistor_q.hpp"
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+//--------------------------------------
+//  CONSTRUCTORS
+//--------------------------------------
+
+template <typename AdcType>
+NtcThermistorQ<AdcType>::NtcThermistorQ(const ntc_config_t &config,
+                                        AdcType *adc_interface) noexcept
+    : config_(config), adc_interface_(adc_interface), initialized_(false),
+      calibration_offset_centi_(0), min_temperature_centi_(0),
+      max_temperature_centi_(0), filter_alpha_q_(0U),
+      filtered_temperature_q_(0), filter_initialized_(false),
+      last_adc_conversions_(0U), table_(), table_shift_(0U),
+      lookup_table_() {}
+
+//--------------------------------------
+//  INITIALIZATION
+//--------------------------------------
+
+template <typename AdcType>
+bool NtcThermistorQ<AdcType>::Initialize() noexcept {
+  if (initialized_) {
+    return true;
+  }
+
+  // Validate ADC interface
+  if (adc_interface_ == nullptr) {
+    return false;
+  }
+
+  // Initialize ADC interface if needed
+  if (!adc_interface_->IsInitialized()) {
+    if (!adc_interface_->EnsureInitialized()) {
+      return false;
+    }
+  }
+
+  if (!adc_interface_->IsChannelAvailable(config_.adc_channel)) {
+    return false;
+  }
+
+  if (buildTables() != NtcError::Success) {
+    return false;
+  }
+
+  filter_initialized_ = false;
+  filtered_temperature_q_ = 0;
+
+  initialized_ = true;
+  return true;
+}
+
+template <typename AdcType>
+bool NtcThermistorQ<AdcType>::Deinitialize() noexcept {
+  if (!initialized_) {
+    return true;
+  }
+
+  initialized_ = false;
+  return true;
+}
+
+template <typename AdcType>
+bool NtcThermistorQ<AdcType>::IsInitialized() const noexcept {
+  return initialized_;
+}
+
+//--------------------------------------
+//  TEMPERATURE READING
+//--------------------------------------
+
+template <typename AdcType>
+NtcError NtcThermistorQ<AdcType>::ReadTemperatureCentiCelsius(
+    int32_t *temperature_centi_celsius) noexcept {
+  if (temperature_centi_celsius == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
+
+  uint64_t count_q = 0U;
+  NtcError acquire_error = acquireCount(&count_q);
+  if (acquire_error != NtcError::Success) {
+    return acquire_error;
+  }
+
+  int32_t temperature_centi = 0;
+  if (!interpolate(count_q, &temperature_centi)) {
+    return NtcError::ConversionFailed;
+  }
+  temperature_centi += calibration_offset_centi_;
+
+  // Integer exponential moving average; the state keeps
+  // COUNT_FRACTION_BITS_ extra bits so small alphas still converge
+  if (config_.enable_filtering) {
+    const int64_t sample_q = static_cast<int64_t>(temperature_centi)
+                             << COUNT_FRACTION_BITS_;
+    if (!filter_initialized_) {
+      filtered_temperature_q_ = sample_q;
+      filter_initialized_ = true;
+    } else {
+      filtered_temperature_q_ +=
+          (static_cast<int64_t>(filter_alpha_q_) *
+           (sample_q - filtered_temperature_q_)) >>
+          FILTER_ALPHA_BITS_;
+    }
+    temperature_centi =
+        static_cast<int32_t>(filtered_temperature_q_ >> COUNT_FRACTION_BITS_);
+  }
+
+  *temperature_centi_celsius = temperature_centi;
+
+  if (temperature_centi < min_temperature_centi_ ||
+      temperature_centi > max_temperature_centi_) {
+    return NtcError::TemperatureOutOfRange;
+  }
+
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+NtcError NtcThermistorQ<AdcType>::GetRawAdcValue(uint32_t *adc_value) noexcept {
+  if (adc_value == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
+
+  uint64_t count_q = 0U;
+  NtcError acquire_error = acquireCount(&count_q);
+  if (acquire_error != NtcError::Success) {
+    return acquire_error;
+  }
+
+  *adc_value = static_cast<uint32_t>(count_q >> COUNT_FRACTION_BITS_);
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+NtcError NtcThermistorQ<AdcType>::ConvertCountToCentiCelsius(
+    uint64_t count_q, int32_t *temperature_centi_celsius) const noexcept {
+  if (temperature_centi_celsius == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
+
+  int32_t temperature_centi = 0;
+  if (!interpolate(count_q, &temperature_centi)) {
+    return NtcError::ConversionFailed;
+  }
+  temperature_centi += calibration_offset_centi_;
+
+  *temperature_centi_celsius = temperature_centi;
+
+  if (temperature_centi < min_temperature_centi_ ||
+      temperature_centi > max_temperature_centi_) {
+    return NtcError::TemperatureOutOfRange;
+  }
+
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+uint32_t NtcThermistorQ<AdcType>::GetLastAdcConversionCount() const noexcept {
+  return last_adc_conversions_;
+}
+
+//--------------------------------------
+//  CONFIGURATION
+//--------------------------------------
+
+template <typename AdcType>
+NtcError
+NtcThermistorQ<AdcType>::GetConfiguration(ntc_config_t *config) const noexcept {
+  if (config == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  *config = config_;
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+NtcError
+NtcThermistorQ<AdcType>::SetConfiguration(const ntc_config_t &config) noexcept {
+  if (NTC::Acquisition::ValidateConfiguration(config) !=
+      NtcError::Success) {
+    return NtcError::InvalidParameter;
+  }
+
+  // The integer path averages its samples and filters with a Q15 EMA
+  if (config.sampling_strategy != NtcSamplingStrategy::Mean ||
+      (config.enable_filtering && config.filter_mode != NtcFilterMode::Ema)) {
+    return NtcError::UnsupportedOperation;
+  }
+
+  config_ = config;
+
+  // Rebuild the integer form; the filter state belongs to the previous one
+  filter_initialized_ = false;
+  if (initialized_) {
+    return buildTables();
+  }
+
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+NtcError NtcThermistorQ<AdcType>::ResetFilter() noexcept {
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
+
+  filter_initialized_ = false;
+  filtered_temperature_q_ = 0;
+  return NtcError::Success;
+}
+
+//--------------------------------------
+//  ACCURACY
+//--------------------------------------
+
+template <typename AdcType>
+NtcError NtcThermistorQ<AdcType>::MeasureConversionError(
+    uint32_t *max_error_centi_celsius) const noexcept {
+  if (max_error_centi_celsius == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
+
+  constexpr float CENTI_DEGREES_PER_DEGREE_ = 100.0F;
+  const uint32_t segment_shift = table_shift_ + COUNT_FRACTION_BITS_;
+  const float count_scale =
+      1.0F / static_cast<float>(1U << COUNT_FRACTION_BITS_);
+  const uint64_t point_step =
+      std::max<uint64_t>((1ULL << segment_shift) / ERROR_POINTS_PER_SEGMENT_,
+                         1ULL);
+
+  float max_error = 0.0F;
+  for (uint32_t segment = 0; segment < NTC::Acquisition::COUNT_TABLE_SEGMENTS_;
+       ++segment) {
+    if (table_[segment] == NTC::Acquisition::COUNT_TABLE_INVALID_ ||
+        table_[segment + 1U] == NTC::Acquisition::COUNT_TABLE_INVALID_) {
+      continue;
+    }
+
+    const uint64_t segment_start = static_cast<uint64_t>(segment)
+                                   << segment_shift;
+    for (uint32_t point = 0; point < ERROR_POINTS_PER_SEGMENT_; ++point) {
+      const uint64_t count_q = segment_start + (point * point_step);
+
+      int32_t fixed_centi = 0;
+      float reference_celsius = 0.0F;
+      if (!interpolate(count_q, &fixed_centi) ||
+          !convertCountFloat(static_cast<float>(count_q) * count_scale,
+                             &reference_celsius) ||
+          !NTC::ValidateTemperature(reference_celsius, config_.min_temperature,
+                                    config_.max_temperature)) {
+        continue;
+      }
+
+      const float error =
+          static_cast<float>(fixed_centi) -
+          (reference_celsius * CENTI_DEGREES_PER_DEGREE_);
+      max_error = std::max(max_error, std::fabs(error));
+    }
+  }
+
+  *max_error_centi_celsius = static_cast<uint32_t>(std::ceil(max_error));
+  return NtcError::Success;
+}
+
+//--------------------------------------
+//  PRIVATE HELPER METHODS
+//--------------------------------------
+
+template <typename AdcType>
+NtcError NtcThermistorQ<AdcType>::buildTables() noexcept {
+  NtcError validation_error =
+      NTC::Acquisition::ValidateConfiguration(config_);
+  if (validation_error != NtcError::Success) {
+    return validation_error;
+  }
+
+  if (config_.sampling_strategy != NtcSamplingStrategy::Mean ||
+      (config_.enable_filtering && config_.filter_mode != NtcFilterMode::Ema)) {
+    return NtcError::UnsupportedOperation;
+  }
+
+  constexpr float CENTI_DEGREES_PER_DEGREE_ = 100.0F;
+  constexpr float FILTER_ALPHA_SCALE_ =
+      static_cast<float>(1U << FILTER_ALPHA_BITS_);
+
+  calibration_offset_centi_ = static_cast<int32_t>(
+      std::lround(config_.calibration_offset * CENTI_DEGREES_PER_DEGREE_));
+  min_temperature_centi_ = static_cast<int32_t>(
+      std::lround(config_.min_temperature * CENTI_DEGREES_PER_DEGREE_));
+  max_temperature_centi_ = static_cast<int32_t>(
+      std::lround(config_.max_temperature * CENTI_DEGREES_PER_DEGREE_));
+  filter_alpha_q_ = static_cast<uint32_t>(
+      std::lround(config_.filter_alpha * FILTER_ALPHA_SCALE_));
+
+  lookup_table_ =
+      (config_.conversion_method == NtcConversionMethod::LookupTable)
+          ? NTC::ValidatedLookupTable(
+                NTC::GetNtcLookupTable(static_cast<int>(config_.type)))
+          : NTC::ValidatedLookupTable();
+
+  table_shift_ =
+      NTC::Acquisition::CountTableShift(config_.adc_resolution_bits);
+  NTC::Acquisition::FillCountTable(
+      table_shift_,
+      [this](float count, float *temperature_celsius) noexcept {
+        return convertCountFloat(count, temperature_celsius);
+      },
+      &table_);
+
+  return NtcError::Success;
+}
+
+template <typename AdcType>
+bool NtcThermistorQ<AdcType>::convertCountFloat(
+    float count, float *temperature_celsius) const noexcept {
+  // Ratiometric divider: ADC full scale corresponds to the reference voltage
+  const float full_scale =
+      static_cast<float>((1ULL << config_.adc_resolution_bits) - 1ULL);
+  const float voltage_volts = count * config_.reference_voltage / full_scale;
+
+  float resistance_ohms = 0.0F;
+  if (!NTC::CalculateThermistorResistance(
+          voltage_volts, config_.reference_voltage, config_.series_resistance,
+          &resistance_ohms)) {
+    return false;
+  }
+
+  // Explicit Steinhart-Hart coefficients take precedence when selected
+  if (config_.conversion_method == NtcConversionMethod::SteinhartHart &&
+      NTC::ValidateSteinhartHartCoefficients(config_.steinhart_hart_a,
+                                             config_.steinhart_hart_b,
+                                             config_.steinhart_hart_c)) {
+    return NTC::ConvertResistanceToTemperatureSteinhartHart(
+        resistance_ohms, config_.steinhart_hart_a, config_.steinhart_hart_b,
+        config_.steinhart_hart_c, temperature_celsius);
+  }
+
+  // Same fallback as NtcThermistor: lookup table first, then beta
+  if (lookup_table_.IsValid() &&
+      NTC::FindTemperatureFromLookupTable(lookup_table_, resistance_ohms,
+                                          temperature_celsius)) {
+    return true;
+  }
+
+  return NTC::ConvertResistanceToTemperatureBeta(
+      resistance_ohms, config_.resistance_at_25c, config_.beta_value,
+      temperature_celsius);
+}
+
+template <typename AdcType>
+bool NtcThermistorQ<AdcType>::interpolate(
+    uint64_t count_q, int32_t *temperature_centi_celsius) const noexcept {
+  return NTC::Acquisition::InterpolateCountTable(
+      table_, table_shift_ + COUNT_FRACTION_BITS_, count_q,
+      temperature_centi_celsius);
+}
+
+template <typename AdcType>
+NtcError NtcThermistorQ<AdcType>::acquireCount(uint64_t *count_q) noexcept {
+  if (adc_interface_ == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  const NTC::Acquisition::ntc_count_sum_t acquired =
+      NTC::Acquisition::AcquireCounts(adc_interface_, config_.adc_channel,
+                                      config_.sample_count,
+                                      config_.sample_delay_ms, nullptr);
+  last_adc_conversions_ = acquired.conversions;
+
+  if (acquired.valid_samples == 0U) {
+    return NTC::Acquisition::NoValidSampleError(config_.sample_count,
+                                                acquired.last_error);
+  }
+
+  // Rounded mean with COUNT_FRACTION_BITS_ fractional bits
+  *count_q =
+      NTC::Acquisition::FixedPointCount(acquired.sum, acquired.valid_samples);
+  return NtcError::Success;
+}
+
+#endif // NTC_THERMISTOR_Q_IMPL
@@ -0,0 +1,426 @@
+/**
+ * @file ntc_thermistor_static.cpp
+ * @brief NTC thermistor driver implementation for build-time configurations.
+ *
+ * This file contains the implementation of the StaticNtcThermistor class
+ * whose conversion path is specialized at compile time.
+ *
+ * @author Nebiyu Tadesse
+ * @date 2025
+ * @copyright HardFOC
+ *
+ * @note This file is included by ntc_thermistor_static.hpp for template
+ *       instantiation. It should not be compiled separately when included.
+ */
+
+#ifndef NTC_THERMISTOR_STATIC_IMPL
+#define NTC_THERMISTOR_STATIC_IMPL
+
+// When included from header, use relative path; when compiled directly, use
+// standard include
+#ifdef NTC_THERMISTOR_STATIC_HEADER_INCLUDED
+#include "../inc/ntc_acquisition.hpp"
+#include "../inc/ntc_conversion.hpp"
+#include "../inc/ntc_thermistor_static.hpp"
+#else
+#include "ntc_acquisition.hpp"
+#include "ntc_conversion.hpp"
+#include "ntc_thermistor_static.hpp"
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+//--------------------------------------
+//  CONSTRUCTORS
+//--------------------------------------
+
+template <typename AdcType, typename Config>
+StaticNtcThermistor<AdcType, Config>::StaticNtcThermistor(
+    AdcType *adc_interface) noexcept
+    : adc_interface_(adc_interface), initialized_(false),
+      filtered_temperature_(0.0F), filter_initialized_(false),
+      lookup_table_(), last_adc_conversions_(0U) {}
+
+//--------------------------------------
+//  INITIALIZATION
+//--------------------------------------
+
+template <typename AdcType, typename Config>
+bool StaticNtcThermistor<AdcType, Config>::Initialize() noexcept {
+  if (initialized_) {
+    return true;
+  }
+
+  // Validate ADC interface
+  if (adc_interface_ == nullptr) {
+    return false;
+  }
+
+  // Initialize ADC interface if needed
+  if (!adc_interface_->IsInitialized()) {
+    if (!adc_interface_->EnsureInitialized()) {
+      return false;
+    }
+  }
+
+  // Validate ADC channel
+  if (!adc_interface_->IsChannelAvailable(CONFIG.adc_channel)) {
+    return false;
+  }
+
+  // Resolve the lookup table now so registrations since construction apply
+  if constexpr (CONFIG.conversion_method ==
+                NtcConversionMethod::LookupTable) {
+    lookup_table_ = NTC::ValidatedLookupTable(
+        NTC::GetNtcLookupTable(static_cast<int>(CONFIG.type)));
+  }
+
+  // Reset filter
+  filter_initialized_ = false;
+  filtered_temperature_ = 0.0F;
+
+  initialized_ = true;
+  return true;
+}
+
+template <typename AdcType, typename Config>
+bool StaticNtcThermistor<AdcType, Config>::Deinitialize() noexcept {
+  if (!initialized_) {
+    return true;
+  }
+
+  initialized_ = false;
+  return true;
+}
+
+template <typename AdcType, typename Config>
+bool StaticNtcThermistor<AdcType, Config>::IsInitialized() const noexcept {
+  return initialized_;
+}
+
+//--------------------------------------
+//  TEMPERATURE READING
+//--------------------------------------
+
+template <typename AdcType, typename Config>
+NtcError StaticNtcThermistor<AdcType, Config>::ReadTemperatureCelsius(
+    float *temperature_celsius) noexcept {
+  if (temperature_celsius == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
+
+  ntc_adc_sample_t sample = {};
+  NtcError acquire_error = acquireSample(&sample);
+  if (acquire_error != NtcError::Success) {
+    return acquire_error;
+  }
+
+  return convertSample(sample, nullptr, temperature_celsius);
+}
+
+template <typename AdcType, typename Config>
+NtcError StaticNtcThermistor<AdcType, Config>::ReadTemperature(
+    ntc_reading_t *reading) noexcept {
+  if (reading == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  reading->timestamp_us = 0U;
+  reading->is_valid = false;
+  reading->accuracy_celsius = 0.5F; // Estimate based on typical NTC accuracy
+  reading->adc_conversions = 0U;
+
+  NtcError error = NtcError::NotInitialized;
+  if (initialized_) {
+    // One acquisition feeds every field of the reading
+    ntc_adc_sample_t sample = {};
+    error = acquireSample(&sample);
+    reading->adc_conversions = sample.conversions;
+    reading->timestamp_us = sample.timestamp_us;
+
+    float resistance_ohms = 0.0F;
+    float temperature_celsius = 0.0F;
+    if (error == NtcError::Success) {
+      error = convertSample(sample, &resistance_ohms, &temperature_celsius);
+    }
+
+    if (error == NtcError::Success) {
+      reading->temperature_celsius = temperature_celsius;
+      reading->temperature_fahrenheit =
+          NtcThermistor<AdcType>::CelsiusToFahrenheit(temperature_celsius);
+      reading->temperature_kelvin =
+          NtcThermistor<AdcType>::CelsiusToKelvin(temperature_celsius);
+      reading->resistance_ohms = resistance_ohms;
+      reading->voltage_volts = sample.voltage_volts;
+      reading->adc_raw_value = sample.raw_count;
+      reading->is_valid = true;
+    }
+  }
+
+  reading->error = error;
+  return error;
+}
+
+template <typename AdcType, typename Config>
+NtcError StaticNtcThermistor<AdcType, Config>::GetRawAdcValue(
+    uint32_t *adc_value) noexcept {
+  if (adc_value == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
+
+  ntc_adc_sample_t sample = {};
+  NtcError acquire_error = acquireSample(&sample);
+  if (acquire_error != NtcError::Success) {
+    return acquire_error;
+  }
+
+  *adc_value = sample.raw_count;
+  return NtcError::Success;
+}
+
+template <typename AdcType, typename Config>
+uint32_t StaticNtcThermistor<AdcType, Config>::GetLastAdcConversionCount()
+    const noexcept {
+  return last_adc_conversions_;
+}
+
+template <typename AdcType, typename Config>
+NtcError StaticNtcThermistor<AdcType, Config>::ResetFilter() noexcept {
+  if (!initialized_) {
+    return NtcError::NotInitialized;
+  }
+
+  filter_initialized_ = false;
+  filtered_temperature_ = 0.0F;
+  return NtcError::Success;
+}
+
+//--------------------------------------
+//  PRIVATE HELPER METHODS
+//--------------------------------------
+
+template <typename AdcType, typename Config>
+constexpr NTC::Acquisition::CountTable
+StaticNtcThermistor<AdcType, Config>::generateAdcCountTable() noexcept {
+  constexpr double CENTI_DEGREES_PER_DEGREE_ = 100.0;
+  constexpr double MAX_TABLE_CENTI_DEGREES_ = 32767.0;
+  constexpr double ROUNDING_ = 0.5;
+  constexpr double FULL_SCALE_COUNT_ = static_cast<double>(FULL_SCALE_);
+
+  NTC::Acquisition::CountTable table = {};
+  for (uint32_t node = 0; node <= NTC::Acquisition::COUNT_TABLE_SEGMENTS_;
+       ++node) {
+    table[node] = NTC::Acquisition::COUNT_TABLE_INVALID_;
+
+    // Ratiometric divider, thermistor on the low side: R = Rs * c / (FS - c)
+    const double count = static_cast<double>(static_cast<uint64_t>(node)
+                                             << ADC_COUNT_TABLE_SHIFT_);
+    if (count <= 0.0 || count >= FULL_SCALE_COUNT_) {
+      continue;
+    }
+    const double resistance_ohms =
+        static_cast<double>(CONFIG.series_resistance) * count /
+        (FULL_SCALE_COUNT_ - count);
+    if (resistance_ohms <
+            static_cast<double>(NTC::Constants::MIN_RESISTANCE_OHMS_) ||
+        resistance_ohms >
+            static_cast<double>(NTC::Constants::MAX_RESISTANCE_OHMS_)) {
+      continue;
+    }
+
+    const double centi_degrees =
+        NTC::Generator::BetaTemperature(
+            resistance_ohms, static_cast<double>(CONFIG.resistance_at_25c),
+            static_cast<double>(CONFIG.beta_value)) *
+        CENTI_DEGREES_PER_DEGREE_;
+    const double rounded = (centi_degrees >= 0.0) ? centi_degrees + ROUNDING_
+                                                  : centi_degrees - ROUNDING_;
+    if (rounded > -MAX_TABLE_CENTI_DEGREES_ &&
+        rounded < MAX_TABLE_CENTI_DEGREES_) {
+      table[node] = static_cast<int16_t>(rounded);
+    }
+  }
+
+  return table;
+}
+
+template <typename AdcType, typename Config>
+NtcError StaticNtcThermistor<AdcType, Config>::acquireSample(
+    ntc_adc_sample_t *sample) noexcept {
+  if (adc_interface_ == nullptr) {
+    return NtcError::NullPointer;
+  }
+
+  const uint64_t start_us = NTC::Acquisition::ReadTimestampUs(adc_interface_);
+  sample->raw_count = 0U;
+  sample->voltage_volts = 0.0F;
+  sample->timestamp_us = 0U;
+
+  const NTC::Acquisition::ntc_count_sum_t acquired =
+      NTC::Acquisition::AcquireCounts(adc_interface_, CONFIG.adc_channel,
+                                      CONFIG.sample_count,
+                                      CONFIG.sample_delay_ms, nullptr);
+  sample->conversions = acquired.conversions;
+  sample->valid_samples = acquired.valid_samples;
+
+  last_adc_conversions_ = sample->conversions;
+  sample->timestamp_us = NTC::Acquisition::WindowMidpointUs(
+      start_us, NTC::Acquisition::ReadTimestampUs(adc_interface_));
+
+  if (sample->valid_samples == 0) {
+    return NTC::Acquisition::NoValidSampleError(CONFIG.sample_count,
+                                                acquired.last_error);
+  }
+
+  const uint64_t sum = acquired.sum;
+  float mean_count = 0.0F;
+  if constexpr (CONFIG.sample_count == 1U) {
+    sample->raw_count = static_cast<uint32_t>(sum);
+    mean_count = static_cast<float>(sum);
+  } else {
+    mean_count = static_cast<float>(sum) /
+                 static_cast<float>(sample->valid_samples);
+    sample->raw_count = static_cast<uint32_t>(sum / sample->valid_samples);
+  }
+  sample->count_q =
+      NTC::Acquisition::FixedPointCount(sum, sample->valid_samples);
+  sample->voltage_volts = mean_count * VOLTS_PER_COUNT_;
+  return NtcError::Success;
+}
+
+template <typename AdcType, typename Config>
+NtcError StaticNtcThermistor<AdcType, Config>::convertSample(
+    const ntc_adc_sample_t &sample, float *resistance_ohms,
+    float *temperature_celsius) noexcept {
+  float raw_temperature = 0.0F;
+  bool converted = false;
+
+  if constexpr (CONFIG.conversion_method ==
+                NtcConversionMethod::AdcCountTable) {
+    converted = lookupAdcCountTable(sample.count_q, &raw_temperature);
+  }
+
+  // Resistance is only needed by the ADC count table path when the caller
+  // asks for it
+  if (!converted || resistance_ohms != nullptr) {
+    float resistance = 0.0F;
+    if (!NTC::CalculateThermistorResistance(
+            sample.voltage_volts, CONFIG.reference_voltage,
+            CONFIG.series_resistance, &resistance)) {
+      return NtcError::ConversionFailed;
+    }
+    if (resistance_ohms != nullptr) {
+      *resistance_ohms = resistance;
+    }
+
+    if constexpr (CONFIG.conversion_method ==
+                  NtcConversionMethod::LookupTable) {
+      if (!converted) {
+        converted = NTC::FindTemperatureFromLookupTable(
+            lookup_table_, resistance, &raw_temperature);
+      }
+    }
+
+    if constexpr (CONFIG.conversion_method ==
+                  NtcConversionMethod::SteinhartHart) {
+      if constexpr (CONFIG.enable_fast_log) {
+        converted = NTC::ConvertResistanceToTemperatureSteinhartHartFast(
+            resistance, CONFIG.steinhart_hart_a, CONFIG.steinhart_hart_b,
+            CONFIG.steinhart_hart_c, &raw_temperature);
+      } else {
+        converted = NTC::ConvertResistanceToTemperatureSteinhartHart(
+            resistance, CONFIG.steinhart_hart_a, CONFIG.steinhart_hart_b,
+            CONFIG.steinhart_hart_c, &raw_temperature);
+      }
+    }
+
+    // Beta equation for the remaining methods and as the fallback
+    if (!converted && !convertResistanceBeta(resistance, &raw_temperature)) {
+      return NtcError::ConversionFailed;
+    }
+  }
+
+  // Apply calibration offset
+  *temperature_celsius = raw_temperature + CONFIG.calibration_offset;
+
+  // Apply filtering if enabled
+  if constexpr (CONFIG.enable_filtering) {
+    if (!filter_initialized_) {
+      filtered_temperature_ = *temperature_celsius;
+      filter_initialized_ = true;
+    } else {
+      filtered_temperature_ =
+          (CONFIG.filter_alpha * *temperature_celsius) +
+          ((1.0F - CONFIG.filter_alpha) * filtered_temperature_);
+    }
+    *temperature_celsius = filtered_temperature_;
+  }
+
+  // Validate temperature range
+  if (!NTC::ValidateTemperature(*temperature_celsius, CONFIG.min_temperature,
+                                CONFIG.max_temperature)) {
+    return NtcError::TemperatureOutOfRange;
+  }
+
+  return NtcError::Success;
+}
+
+template <typename AdcType, typename Config>
+bool StaticNtcThermistor<AdcType, Config>::convertResistanceBeta(
+    float resistance_ohms, float *temperature_celsius) noexcept {
+  if (!NTC::ValidateResistance(resistance_ohms,
+                               NTC::Constants::MIN_RESISTANCE_OHMS_,
+                               NTC::Constants::MAX_RESISTANCE_OHMS_)) {
+    return false;
+  }
+
+  // Beta equation: 1/T = 1/T0 + (1/β) * ln(R/R0)
+  const float ratio = resistance_ohms * INVERSE_RESISTANCE_AT_25C_;
+  float ln_ratio = 0.0F;
+  if constexpr (CONFIG.enable_fast_log) {
+    ln_ratio = NTC::FastLog(ratio);
+  } else {
+    ln_ratio = std::log(ratio);
+  }
+  const float inverse_kelvin =
+      INVERSE_REFERENCE_KELVIN_ + (ln_ratio * INVERSE_BETA_VALUE_);
+  if (inverse_kelvin <= 0.0F) {
+    return false;
+  }
+
+  *temperature_celsius =
+      (1.0F / inverse_kelvin) - NTC::Constants::KELVIN_OFFSET_;
+  return true;
+}
+
+template <typename AdcType, typename Config>
+bool StaticNtcThermistor<AdcType, Config>::lookupAdcCountTable(
+    uint64_t count_q, float *temperature_celsius) noexcept {
+  // Generated at compile time; only instantiated for the AdcCountTable method
+  static constexpr NTC::Acquisition::CountTable TABLE =
+      generateAdcCountTable();
+
+  int32_t centi_degrees = 0;
+  constexpr uint32_t SEGMENT_SHIFT_ =
+      ADC_COUNT_TABLE_SHIFT_ + NTC::Acquisition::COUNT_FRACTION_BITS_;
+  if (!NTC::Acquisition::InterpolateCountTable(TABLE, SEGMENT_SHIFT_, count_q,
+                                               &centi_degrees)) {
+    return false;
+  }
+
+  constexpr float DEGREES_PER_CENTI_DEGREE_ = 0.01F;
+  *temperature_celsius =
+      static_cast<float>(centi_degrees) * DEGREES_PER_CENTI_DEGREE_;
+  return true;
+}
+
+#endif // NTC_THERMISTOR_STATIC_IMPL